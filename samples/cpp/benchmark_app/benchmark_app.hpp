@@ -74,6 +74,19 @@ static const char maximum_inference_rate_message[] =
 /// @brief message for execution time
 static const char execution_time_message[] = "Optional. Time in seconds to execute topology.";
 
+/// @brief message for arrival process
+static const char arrival_message[] =
+    "Optional. Enables the open-loop load: the requests arrive by the schedule regardless of the completion of the "
+    "previous ones and the latency is counted from the scheduled arrival. \"constant\" - evenly spaced arrivals, "
+    "\"poisson\" - Poisson process, \"trace:<path>\" - replay of the arrival timestamps (seconds, one per line) of "
+    "the file. Requires the async API and the inference only mode. The -t/-niter limits apply to every rate.";
+
+/// @brief message for request rates
+static const char rates_message[] =
+    "Optional. Comma separated request rates per second swept by the open-loop load, e.g. \"100,200,400\". "
+    "Required for the constant and Poisson arrivals, the trace is scaled to every rate. The throughput and latency "
+    "percentiles of every rate are stored to the load curve report if -report_type is set.";
+
 static const char batch_size_message[] =
     "Optional. Batch size value. If not specified, the batch size value is determined from "
     "Intermediate Representation.";
@@ -281,6 +294,12 @@ DEFINE_uint64(niter, 0, iterations_count_message);
 /// @brief Time to execute topology in seconds
 DEFINE_uint64(t, 0, execution_time_message);
 
+/// @brief Define parameter for the arrival process of the open-loop load <br>
+DEFINE_string(arrival, "", arrival_message);
+
+/// @brief Define parameter for the request rates of the open-loop load <br>
+DEFINE_string(rates, "", rates_message);
+
 /// @brief Define parameter for batch size <br>
 /// Default is 0 (that means don't specify)
 DEFINE_uint64(b, 0, batch_size_message);
@@ -403,6 +422,8 @@ static void show_usage() {
     std::cout << "    -niter  <integer>             " << iterations_count_message << std::endl;
     std::cout << "    -max_irate \"<float>\"        " << maximum_inference_rate_message << std::endl;
     std::cout << "    -t                            " << execution_time_message << std::endl;
+    std::cout << "    -arrival  <process>           " << arrival_message << std::endl;
+    std::cout << "    -rates  \"<float,...>\"         " << rates_message << std::endl;
     std::cout << std::endl;
     std::cout << "Input shapes" << std::endl;
     std::cout << "    -b  <integer>                 " << batch_size_message << std::endl;
@@ -50,6 +50,12 @@ public:
         _request.start_async();
     }
 
+    // the latency of the open-loop load is counted from the scheduled arrival, including the wait for the request
+    void start_async(const Time::time_point& arrivalTime) {
+        _startTime = arrivalTime;
+        _request.start_async();
+    }
+
     void wait() {
         _request.wait();
     }
@@ -0,0 +1,196 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// clang-format off
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <numeric>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "load_generator.hpp"
+// clang-format on
+
+namespace {
+constexpr char trace_prefix[] = "trace:";
+
+double get_percentile(const std::vector<double>& sorted_latencies, double percentile) {
+    const auto rank = static_cast<size_t>(std::ceil(percentile / 100.0 * sorted_latencies.size()));
+    return sorted_latencies[std::min(std::max<size_t>(rank, 1), sorted_latencies.size()) - 1];
+}
+
+std::vector<double> read_trace(const std::string& path) {
+    std::ifstream file(path);
+    if (!file) {
+        throw std::logic_error("Cannot open the arrival trace file " + path);
+    }
+    std::vector<double> trace;
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.find_first_not_of(" \t\r") == std::string::npos) {
+            continue;
+        }
+        trace.push_back(std::stod(line));
+    }
+    if (trace.empty()) {
+        throw std::logic_error("The arrival trace file " + path + " is empty");
+    }
+    if (!std::is_sorted(trace.begin(), trace.end())) {
+        throw std::logic_error("The timestamps of the arrival trace file " + path + " must be ascending");
+    }
+    const auto origin = trace.front();
+    for (auto& timestamp : trace) {
+        timestamp -= origin;
+    }
+    return trace;
+}
+}  // namespace
+
+OpenLoopLoad::OpenLoopLoad(const std::string& arrival, const std::string& rates) {
+    if (arrival == "constant") {
+        _arrival = Arrival::CONSTANT;
+    } else if (arrival == "poisson") {
+        _arrival = Arrival::POISSON;
+    } else if (arrival.rfind(trace_prefix, 0) == 0) {
+        _arrival = Arrival::TRACE;
+        _trace = read_trace(arrival.substr(std::string(trace_prefix).size()));
+    } else {
+        throw std::logic_error("Incorrect arrival process. Please set -arrival option to `constant`, `poisson` or "
+                               "`trace:<path>` value.");
+    }
+
+    for (const auto& rate : split(rates, ',')) {
+        if (rate.empty()) {
+            continue;
+        }
+        _rates.push_back(std::stod(rate));
+        if (_rates.back() <= 0) {
+            throw std::logic_error("The request rates of -rates option must be positive.");
+        }
+    }
+    if (_rates.empty() && _arrival != Arrival::TRACE) {
+        throw std::logic_error("The request rates must be set by -rates option for the " + arrival + " arrivals.");
+    }
+}
+
+std::string OpenLoopLoad::to_string() const {
+    std::stringstream ss;
+    ss << (_arrival == Arrival::CONSTANT ? "constant" : _arrival == Arrival::POISSON ? "poisson" : "trace")
+       << " arrivals";
+    if (_rates.empty()) {
+        ss << " as recorded";
+    } else {
+        ss << " at ";
+        for (size_t i = 0; i < _rates.size(); i++) {
+            ss << (i ? ", " : "") << double_to_string(_rates[i]);
+        }
+        ss << " requests/s";
+    }
+    return ss.str();
+}
+
+std::vector<Time::duration> OpenLoopLoad::schedule(double rate, uint64_t duration_ns, uint64_t niter) const {
+    std::vector<double> arrivals;  // seconds
+    if (_arrival == Arrival::TRACE) {
+        // the trace is stretched or compressed in time to the average rate requested
+        double scale = 1.0;
+        if (rate > 0 && _trace.back() > 0) {
+            scale = (_trace.size() - 1) / _trace.back() / rate;
+        }
+        for (const auto& timestamp : _trace) {
+            arrivals.push_back(timestamp * scale);
+        }
+        if (niter != 0 && arrivals.size() > niter) {
+            arrivals.resize(niter);
+        }
+    } else {
+        // the fixed seed makes the Poisson arrivals the same from run to run
+        std::mt19937_64 generator(0);
+        std::exponential_distribution<double> interval(rate);
+        const double duration = duration_ns * 1.0e-9;
+        double arrival = 0;
+        while ((niter != 0 && arrivals.size() < niter) || (niter == 0 && arrival < duration)) {
+            arrivals.push_back(arrival);
+            arrival += _arrival == Arrival::POISSON ? interval(generator) : 1.0 / rate;
+        }
+    }
+
+    std::vector<Time::duration> schedule;
+    schedule.reserve(arrivals.size());
+    for (const auto& arrival : arrivals) {
+        schedule.push_back(std::chrono::duration_cast<Time::duration>(std::chrono::duration<double>(arrival)));
+    }
+    return schedule;
+}
+
+LoadCurvePoint OpenLoopLoad::run_point(InferRequestsQueue& requests,
+                                       const std::vector<Time::duration>& arrivals,
+                                       double rate,
+                                       size_t batch_size) const {
+    requests.reset_times();
+    const auto start_time = Time::now();
+    for (const auto& arrival : arrivals) {
+        const auto arrival_time = start_time + arrival;
+        std::this_thread::sleep_until(arrival_time);
+        // the arrivals queue up here while all the infer requests are busy
+        requests.get_idle_request()->start_async(arrival_time);
+    }
+    requests.wait_all();
+
+    auto latencies = requests.get_latencies();
+    if (latencies.empty()) {
+        throw std::logic_error("No requests were run by the open-loop load.");
+    }
+    std::sort(latencies.begin(), latencies.end());
+
+    LoadCurvePoint point;
+    point.offered_rate = rate;
+    point.count = latencies.size();
+    point.throughput = 1000.0 * latencies.size() * batch_size / requests.get_duration_in_milliseconds();
+    point.latency_avg = std::accumulate(latencies.begin(), latencies.end(), 0.0) / latencies.size();
+    point.latency_p50 = get_percentile(latencies, 50);
+    point.latency_p99 = get_percentile(latencies, 99);
+    point.latency_p999 = get_percentile(latencies, 99.9);
+    point.latency_max = latencies.back();
+    return point;
+}
+
+std::vector<LoadCurvePoint> OpenLoopLoad::run(InferRequestsQueue& requests,
+                                              uint64_t duration_ns,
+                                              uint64_t niter,
+                                              size_t batch_size) const {
+    std::vector<LoadCurvePoint> curve;
+    if (_rates.empty()) {
+        // the trace replayed as recorded
+        const auto arrivals = schedule(0, duration_ns, niter);
+        const double span = std::chrono::duration<double>(arrivals.back()).count();
+        const double rate = span > 0 ? (arrivals.size() - 1) / span : 0;
+        curve.push_back(run_point(requests, arrivals, rate, batch_size));
+        return curve;
+    }
+    for (const auto& rate : _rates) {
+        slog::info << "Open-loop load at " << double_to_string(rate) << " requests/s" << slog::endl;
+        curve.push_back(run_point(requests, schedule(rate, duration_ns, niter), rate, batch_size));
+    }
+    return curve;
+}
+
+void print_load_curve(const std::vector<LoadCurvePoint>& curve) {
+    slog::info << "Load curve (latencies in ms):" << slog::endl;
+    slog::info << "   Offered rate   Throughput   Count     Average   Median    P99       P99.9     Max" << slog::endl;
+    for (const auto& point : curve) {
+        std::stringstream ss;
+        ss << std::fixed << std::setprecision(2) << "   " << std::setw(12) << point.offered_rate << "   "
+           << std::setw(10) << point.throughput << "   " << std::setw(7) << point.count << "   " << std::setw(7)
+           << point.latency_avg << "   " << std::setw(7) << point.latency_p50 << "   " << std::setw(7)
+           << point.latency_p99 << "   " << std::setw(7) << point.latency_p999 << "   " << std::setw(7)
+           << point.latency_max;
+        slog::info << ss.str() << slog::endl;
+    }
+}
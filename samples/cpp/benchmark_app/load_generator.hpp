@@ -0,0 +1,53 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// clang-format off
+#include "infer_request_wrap.hpp"
+#include "statistics_report.hpp"
+#include "utils.hpp"
+// clang-format on
+
+/// @brief Generates the open-loop load: the requests arrive by the schedule of the arrival process regardless of the
+/// completion of the previous ones. The latency is counted from the scheduled arrival, so the time spent waiting for
+/// an idle infer request is included and the overload is not hidden by the coordinated omission.
+class OpenLoopLoad {
+public:
+    enum class Arrival { CONSTANT, POISSON, TRACE };
+
+    /// @param arrival - "constant", "poisson" or "trace:<path>" to the file with one arrival timestamp in seconds per
+    /// line
+    /// @param rates - comma separated request rates per second to sweep. Required for the constant and Poisson
+    /// arrivals, the trace is scaled to every rate or replayed as recorded if no rates are set.
+    OpenLoopLoad(const std::string& arrival, const std::string& rates);
+
+    /// @brief Runs the load at every rate of the sweep.
+    /// @param duration_ns - duration of every rate point, ignored for the trace
+    /// @param niter - number of the requests of every rate point, 0 means no limit
+    std::vector<LoadCurvePoint> run(InferRequestsQueue& requests,
+                                    uint64_t duration_ns,
+                                    uint64_t niter,
+                                    size_t batch_size) const;
+
+    std::string to_string() const;
+
+private:
+    std::vector<Time::duration> schedule(double rate, uint64_t duration_ns, uint64_t niter) const;
+    LoadCurvePoint run_point(InferRequestsQueue& requests,
+                             const std::vector<Time::duration>& arrivals,
+                             double rate,
+                             size_t batch_size) const;
+
+    Arrival _arrival;
+    std::vector<double> _rates;
+    // seconds since the first arrival
+    std::vector<double> _trace;
+};
+
+void print_load_curve(const std::vector<LoadCurvePoint>& curve);
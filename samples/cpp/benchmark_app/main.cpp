@@ -32,6 +32,7 @@
 #include "benchmark_app.hpp"
 #include "infer_request_wrap.hpp"
 #include "inputs_filling.hpp"
+#include "load_generator.hpp"
 #include "remote_tensors_filling.hpp"
 #include "statistics_report.hpp"
 #include "utils.hpp"
@@ -152,6 +153,12 @@ bool parse_and_check_command_line(int argc, char* argv[]) {
                 "Number of iterations should be greater than number of infer requests when using sync API.");
         }
     }
+    if (!FLAGS_arrival.empty() && FLAGS_api != "async") {
+        throw std::logic_error("The open-loop load (-arrival option) is available for async API only.");
+    }
+    if (FLAGS_arrival.empty() && !FLAGS_rates.empty()) {
+        throw std::logic_error("-rates option requires the open-loop load to be enabled by -arrival option.");
+    }
     if (!FLAGS_hint.empty() && FLAGS_hint != "throughput" && FLAGS_hint != "tput" && FLAGS_hint != "latency" &&
         FLAGS_hint != "cumulative_throughput" && FLAGS_hint != "ctput" && FLAGS_hint != "none") {
         throw std::logic_error("Incorrect performance hint. Please set -hint option to"
@@ -346,6 +353,12 @@ int main(int argc, char* argv[]) {
             return 0;
         }
 
+        // the arrival trace is read before the model is compiled to report its issues early
+        std::shared_ptr<OpenLoopLoad> openLoopLoad;
+        if (!FLAGS_arrival.empty()) {
+            openLoopLoad = std::make_shared<OpenLoopLoad>(FLAGS_arrival, FLAGS_rates);
+        }
+
         bool isNetworkCompiled = fileExt(FLAGS_m) == "blob";
         if (isNetworkCompiled) {
             slog::info << "Model is compiled" << slog::endl;
@@ -933,6 +946,9 @@ int main(int argc, char* argv[]) {
             }
             inferenceOnly = isFlagSetInCommandLine("inference_only") && inferenceOnly && app_inputs_info.size() == 1;
         }
+        if (openLoopLoad && !inferenceOnly) {
+            throw std::logic_error("The open-loop load (-arrival option) is available in the inference only mode only.");
+        }
 
         // ----------------- 8. Querying optimal runtime parameters
         // -----------------------------------------------------
@@ -1129,6 +1145,10 @@ int main(int argc, char* argv[]) {
             }
             ss << niter << " iterations";
         }
+        if (openLoopLoad) {
+            ss << (niter != 0 || duration_seconds > 0 ? " per rate" : "") << ", open-loop load of "
+               << openLoopLoad->to_string();
+        }
 
         next_step(ss.str());
 
@@ -1223,6 +1243,22 @@ int main(int argc, char* argv[]) {
             slog::info << "Skipping warmup inference due to -no_warmup flag" << slog::endl;
         }
 
+        if (openLoopLoad) {
+            // the niter is not aligned by the number of requests as there is no closed loop
+            const auto curve = openLoopLoad->run(inferRequestsQueue, duration_nanoseconds, FLAGS_niter, batchSize);
+
+            // ----------------- 11. Dumping statistics report
+            // -------------------------------------------------------------
+            next_step();
+
+            if (statistics) {
+                statistics->dump_load_curve(curve);
+                statistics->dump();
+            }
+            print_load_curve(curve);
+            return 0;
+        }
+
         size_t processedFramesN = 0;
         auto startTime = Time::now();
         auto execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
@@ -190,6 +190,25 @@ void StatisticsReport::dump_performance_counters(const std::vector<PerformanceCo
     slog::info << "Performance counters report is stored to " << dumper.getFilename() << slog::endl;
 }
 
+void StatisticsReport::dump_load_curve(const std::vector<LoadCurvePoint>& curve) {
+    CsvDumper dumper(true, _config.report_folder + _separator + "benchmark_load_curve.csv", 3);
+    dumper << "offered rate (req/s)"
+           << "throughput (FPS)"
+           << "count"
+           << "avg latency (ms)"
+           << "p50 latency (ms)"
+           << "p99 latency (ms)"
+           << "p99.9 latency (ms)"
+           << "max latency (ms)";
+    dumper.endLine();
+    for (const auto& point : curve) {
+        dumper << point.offered_rate << point.throughput << point.count << point.latency_avg << point.latency_p50
+               << point.latency_p99 << point.latency_p999 << point.latency_max;
+        dumper.endLine();
+    }
+    slog::info << "Load curve is stored to " << dumper.getFilename() << slog::endl;
+}
+
 void StatisticsReportJSON::dump_parameters(nlohmann::json& js, const StatisticsReport::Parameters& parameters) {
     for (auto& parameter : parameters) {
         parameter.write_to_json(js);
@@ -255,6 +274,29 @@ void StatisticsReportJSON::dump_performance_counters(const std::vector<Performan
     slog::info << "Performance counters report is stored to " << name << slog::endl;
 }
 
+void StatisticsReportJSON::dump_load_curve(const std::vector<LoadCurvePoint>& curve) {
+    nlohmann::json js;
+    std::string name = _config.report_folder + _separator + "benchmark_load_curve.json";
+
+    js["load_curve"] = nlohmann::json::array();
+    for (const auto& point : curve) {
+        nlohmann::json item;
+        item["offered_rate"] = point.offered_rate;
+        item["throughput"] = point.throughput;
+        item["count"] = point.count;
+        item["latency_avg"] = point.latency_avg;
+        item["latency_p50"] = point.latency_p50;
+        item["latency_p99"] = point.latency_p99;
+        item["latency_p999"] = point.latency_p999;
+        item["latency_max"] = point.latency_max;
+        js["load_curve"].push_back(item);
+    }
+
+    std::ofstream out_stream(name);
+    out_stream << std::setw(4) << js << std::endl;
+    slog::info << "Load curve is stored to " << name << slog::endl;
+}
+
 const nlohmann::json StatisticsReportJSON::perf_counters_to_json(
     const StatisticsReport::PerformanceCounters& perfCounts) {
     std::chrono::microseconds total = std::chrono::microseconds::zero();
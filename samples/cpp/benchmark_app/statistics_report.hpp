@@ -85,6 +85,18 @@ public:
     void write_to_json(nlohmann::json& js) const;
 };
 
+/// @brief Measurements of the open-loop load at one request rate
+struct LoadCurvePoint {
+    double offered_rate = 0;  // requests per second
+    double throughput = 0;    // frames per second
+    size_t count = 0;
+    double latency_avg = 0;  // ms
+    double latency_p50 = 0;
+    double latency_p99 = 0;
+    double latency_p999 = 0;
+    double latency_max = 0;
+};
+
 /// @brief Responsible for collecting of statistics and dumping to .csv file
 class StatisticsReport {
 public:
@@ -121,6 +133,8 @@ public:
 
     virtual void dump_performance_counters(const std::vector<PerformanceCounters>& perfCounts);
 
+    virtual void dump_load_curve(const std::vector<LoadCurvePoint>& curve);
+
 private:
     void dump_performance_counters_request(CsvDumper& dumper, const PerformanceCounters& perfCounts);
     void dump_sort_performance_counters_request(CsvDumper& dumper, const PerformanceCounters& perfCounts);
@@ -148,6 +162,7 @@ public:
 
     void dump() override;
     void dump_performance_counters(const std::vector<PerformanceCounters>& perfCounts) override;
+    void dump_load_curve(const std::vector<LoadCurvePoint>& curve) override;
 
 private:
     void dump_parameters(nlohmann::json& js, const StatisticsReport::Parameters& parameters);
@@ -515,9 +515,16 @@ class AsyncInferQueue(AsyncInferQueueBase):
                               Note: Use with extra care, shared data can be modified during runtime!
                               Note: Using `share_inputs` may result in extra memory overhead.
 
+                              When every input is a `numpy.ndarray` which matches the element type
+                              and the shape of its input, the arrays are passed to the request
+                              without creating intermediate Tensors and kept alive until the request
+                              is started again.
+
                               Default value: False
         :type share_inputs: bool, optional
         """
+        if share_inputs and super()._start_async_shared(inputs, userdata):
+            return
         super().start_async(
             _data_dispatch(
                 self[self.get_idle_request_id()],
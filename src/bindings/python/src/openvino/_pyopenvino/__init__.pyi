@@ -49,6 +49,20 @@ class AsyncInferQueue:
         """
     def __repr__(self) -> str:
         ...
+    def _start_async_shared(self, inputs: typing.Any, userdata: typing.Any) -> bool:
+        """
+                    Run asynchronous inference on numpy arrays without copying them.
+        
+                    Every array has to be C contiguous, writable and match the element type and the shape
+                    of its input. The arrays are kept alive until the request is started again.
+        
+                    :param inputs: Single numpy array or dict of numpy arrays.
+                    :type inputs: Union[numpy.ndarray, dict[Union[int, str, openvino.ConstOutput] : numpy.ndarray]]
+                    :param userdata: Any data that will be passed to a callback
+                    :type userdata: Any
+                    :return: False if any of the inputs can't be shared, the inference isn't started in this case.
+                    :rtype: bool
+        """
     def get_idle_request_id(self) -> int:
         """
                     Returns next free id of InferRequest from queue's pool.
@@ -68,6 +82,30 @@ class AsyncInferQueue:
                     :return: If there is at least one free InferRequest in a pool, returns True.
                     :rtype: bool
         """
+    def set_batch_callback(self, callback: collections.abc.Callable) -> None:
+        """
+                    Sets callback which receives the InferRequests of the queue's pool completed since
+                    the previous call. Signature of such function should have one argument, a list of
+                    pairs of InferRequest object and userdata connected to it.
+        
+                    The GIL is acquired once per call instead of once per InferRequest, so it is the
+                    preferable way to process a large number of small inferences.
+        
+                    The requests of the list become idle after the callback has returned, so start_async()
+                    called from the callback waits for a request which is not in the list. wait_all()
+                    returns after the callback has been called for all the completed requests.
+        
+                    .. code-block:: python
+        
+                        def f(completed):
+                            for request, userdata in completed:
+                                results[userdata] = request.output_tensors[0].data.copy()
+        
+                        async_infer_queue.set_batch_callback(f)
+        
+                    :param callback: Any Python defined function that matches callback's requirements.
+                    :type callback: function
+        """
     def set_callback(self, arg0: collections.abc.Callable) -> None:
         """
                     Sets unified callback on all InferRequests from queue's pool.
@@ -83,6 +121,9 @@ class AsyncInferQueue:
         
                         async_infer_queue.set_callback(f)
         
+                    The callback is called on the completion thread of the request, its wait() and
+                    wait_all() return and the request becomes idle after the callback has returned.
+        
                     :param callback: Any Python defined function that matches callback's requirements.
                     :type callback: function
         """
@@ -1562,6 +1603,14 @@ class InferRequest:
                     :return: list of profiling information for operations in model.
                     :rtype: list[openvino.ProfilingInfo]
         """
+    def get_property(self, property: str) -> typing.Any:
+        """
+                    Gets properties for the infer request.
+        
+                    :param name: Property name.
+                    :type name: str
+                    :rtype: Any
+        """
     @typing.overload
     def get_tensor(self, name: str) -> Tensor:
         """
@@ -1727,6 +1776,24 @@ class InferRequest:
                     :type outputs: dict[int, openvino.Tensor]
         """
     @typing.overload
+    def set_property(self, properties: collections.abc.Mapping[str, typing.Any]) -> None:
+        """
+                    Sets properties for the infer request, for example
+                    openvino.properties.hint.request_priority and openvino.properties.hint.request_deadline.
+        
+                    :param properties: dict of pairs: (property name, property value)
+                    :type properties: dict
+                    :rtype: None
+        """
+    @typing.overload
+    def set_property(self, property: tuple[str, typing.Any]) -> None:
+        """
+                    Sets properties for the infer request.
+        
+                    :param property: tuple of (property name, matching property value).
+                    :type property: tuple
+        """
+    @typing.overload
     def set_tensor(self, name: str, tensor: RemoteTensor) -> None:
         """
                     Sets input/output tensor of InferRequest.
@@ -12,6 +12,8 @@ from openvino._pyopenvino.properties.hint import PerformanceMode
 # Properties
 from openvino._pyopenvino.properties.hint import inference_precision
 from openvino._pyopenvino.properties.hint import model_priority
+from openvino._pyopenvino.properties.hint import request_priority
+from openvino._pyopenvino.properties.hint import request_deadline
 from openvino._pyopenvino.properties.hint import performance_mode
 from openvino._pyopenvino.properties.hint import enable_cpu_pinning
 from openvino._pyopenvino.properties.hint import scheduling_core_type
@@ -6,8 +6,13 @@
 #include <pybind11/functional.h>
 #include <pybind11/stl.h>
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <memory>
 #include <mutex>
 #include <queue>
 #include <string>
@@ -19,6 +24,135 @@
 
 namespace py = pybind11;
 
+namespace {
+// Bounded multi-producer multi-consumer ring of the request handles. Every handle is stored in the ring
+// at most once, so the ring never overflows when its capacity is not less than the number of requests.
+// Based on the Dmitry Vyukov's bounded MPMC queue: each cell has a sequence number which tells
+// whether the cell is ready to be written (sequence == position) or read (sequence == position + 1).
+class HandleRing {
+public:
+    // The ring has to be resized before use, the cells are not movable
+    void resize(size_t capacity) {
+        size_t size = 1;
+        while (size < capacity) {
+            size <<= 1;
+        }
+        m_mask = size - 1;
+        m_cells.reset(new Cell[size]);
+        for (size_t i = 0; i < size; i++) {
+            m_cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    void push(size_t handle) {
+        auto position = m_tail.load(std::memory_order_relaxed);
+        while (true) {
+            auto& cell = m_cells[position & m_mask];
+            const auto sequence = cell.sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(sequence - position);
+            if (diff == 0) {
+                if (m_tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    cell.handle.store(handle, std::memory_order_relaxed);
+                    cell.sequence.store(position + 1, std::memory_order_release);
+                    return;
+                }
+            } else {
+                OPENVINO_ASSERT(diff > 0, "AsyncInferQueue handle ring overflow");
+                position = m_tail.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool pop(size_t& handle) {
+        auto position = m_head.load(std::memory_order_relaxed);
+        while (true) {
+            auto& cell = m_cells[position & m_mask];
+            const auto sequence = cell.sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(sequence - (position + 1));
+            if (diff == 0) {
+                if (m_head.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    handle = cell.handle.load(std::memory_order_relaxed);
+                    cell.sequence.store(position + m_mask + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                position = m_head.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Returns the handle which would be popped next without removing it from the ring
+    bool front(size_t& handle) const {
+        const auto position = m_head.load(std::memory_order_acquire);
+        const auto& cell = m_cells[position & m_mask];
+        if (cell.sequence.load(std::memory_order_acquire) != position + 1) {
+            return false;
+        }
+        handle = cell.handle.load(std::memory_order_relaxed);
+        return true;
+    }
+
+    bool empty() const {
+        size_t handle;
+        return !front(handle);
+    }
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence{0};
+        std::atomic<size_t> handle{0};
+    };
+
+    std::unique_ptr<Cell[]> m_cells;
+    size_t m_mask = 0;
+    alignas(64) std::atomic<size_t> m_head{0};
+    alignas(64) std::atomic<size_t> m_tail{0};
+};
+
+bool find_input_port(const InferRequestWrapper& request, const py::handle& key, ov::Output<const ov::Node>& port) {
+    if (py::isinstance<ov::Output<const ov::Node>>(key)) {
+        port = key.cast<ov::Output<const ov::Node>>();
+        return true;
+    } else if (py::isinstance<py::int_>(key)) {
+        const auto index = key.cast<size_t>();
+        if (index < request.m_inputs.size()) {
+            port = request.m_inputs[index];
+            return true;
+        }
+    } else if (py::isinstance<py::str>(key)) {
+        const auto name = key.cast<std::string>();
+        for (const auto& input : request.m_inputs) {
+            if (input.get_names().count(name)) {
+                port = input;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+// The array can be shared with the request only if the request is able to read it as is
+bool is_shareable(const py::handle& value, const ov::Output<const ov::Node>& port) {
+    if (!py::isinstance<py::array>(value)) {
+        return false;
+    }
+    const auto array = py::reinterpret_borrow<py::array>(value);
+    const auto type = Common::type_helpers::get_ov_type(array);
+    return type != ov::element::string && type == port.get_element_type() &&
+           Common::array_helpers::is_contiguous(array) && array.writeable() &&
+           port.get_partial_shape().compatible(ov::PartialShape(Common::array_helpers::get_shape(array)));
+}
+
+ov::Tensor tensor_from_array(const py::handle& value, const ov::Output<const ov::Node>& port) {
+    const auto array = py::reinterpret_borrow<py::array>(value);
+    return ov::Tensor(port.get_element_type(),
+                      Common::array_helpers::get_shape(array),
+                      const_cast<void*>(array.data()));
+}
+}  // namespace
+
 class AsyncInferQueue {
 public:
     AsyncInferQueue(ov::CompiledModel& model, size_t jobs) {
@@ -28,6 +162,11 @@ public:
 
         m_requests.reserve(jobs);
         m_user_ids.reserve(jobs);
+        m_user_inputs.resize(jobs, py::none());
+        m_failed.resize(jobs, 0);
+        m_holds.reset(new std::atomic<int>[jobs]());
+        m_idle_handles.resize(jobs);
+        m_completed_handles.resize(jobs);
 
         for (size_t handle = 0; handle < jobs; handle++) {
             // Create new "empty" InferRequestWrapper without pre-defined callback and
@@ -47,27 +186,18 @@ public:
     bool _is_ready() {
         // Check if any request has finished already
         ConditionalGILScopedRelease release;
-        // acquire the mutex to access m_errors and m_idle_handles
-        std::lock_guard<std::mutex> lock(m_mutex);
-        if (m_errors.size() > 0)
-            throw m_errors.front();
-        return !(m_idle_handles.empty());
+        check_errors();
+        return !m_idle_handles.empty();
     }
 
     size_t get_idle_request_id() {
         // Wait for any request to complete and return its id
         // release GIL to avoid deadlock on python callback
         ConditionalGILScopedRelease release;
-        // acquire the mutex to access m_errors and m_idle_handles
-        std::unique_lock<std::mutex> lock(m_mutex);
-        m_cv.wait(lock, [this] {
-            return !(m_idle_handles.empty());
-        });
-        size_t idle_handle = m_idle_handles.front();
+        size_t idle_handle = wait_idle_handle();
         // wait for request to make sure it returned from callback
         m_requests[idle_handle].m_request->wait();
-        if (m_errors.size() > 0)
-            throw m_errors.front();
+        check_errors();
         return idle_handle;
     }
 
@@ -78,89 +208,262 @@ public:
         for (auto&& request : m_requests) {
             request.m_request->wait();
         }
-        // acquire the mutex to access m_errors
-        std::lock_guard<std::mutex> lock(m_mutex);
-        if (m_errors.size() > 0)
-            throw m_errors.front();
+        // the batch callback of a request may be still running on the completion thread of another one
+        wait_delivered();
+        check_errors();
+    }
+
+    // Starts the next idle request, the inputs object is kept alive while the request is running
+    // because the tensors set by set_inputs may share its memory
+    void start_async(py::object inputs,
+                     py::object userdata,
+                     const std::function<void(ov::InferRequest&)>& set_inputs) {
+        // acquire_idle_handle function has an intention to block InferQueue
+        // until there is at least one idle (free to use) InferRequest
+        auto handle = acquire_idle_handle();
+        try {
+            // Update inputs if there are any
+            set_inputs(*m_requests[handle].m_request);
+        } catch (...) {
+            release_handle(handle);
+            throw;
+        }
+        m_user_inputs[handle] = std::move(inputs);
+        // Set new inputs label/id from user
+        m_user_ids[handle] = std::move(userdata);
+        // Now GIL can be released - we are NOT working with Python objects in this block
+        ConditionalGILScopedRelease release;
+        *m_requests[handle].m_start_time = Time::now();
+        // Start InferRequest in asynchronus mode
+        m_requests[handle].m_request->start_async();
     }
 
     void set_default_callbacks() {
         for (size_t handle = 0; handle < m_requests.size(); handle++) {
-            // auto end_time = m_requests[handle].m_end_time; // TODO: pass it bellow? like in InferRequestWrapper
-
-            m_requests[handle].m_request->set_callback([this, handle /* ... */](std::exception_ptr exception_ptr) {
+            m_requests[handle].m_request->set_callback([this, handle](std::exception_ptr exception_ptr) {
                 *m_requests[handle].m_end_time = Time::now();
-                {
-                    // acquire the mutex to access m_idle_handles
-                    std::lock_guard<std::mutex> lock(m_mutex);
-                    // Add idle handle to queue
-                    m_idle_handles.push(handle);
-                }
-                // Notify locks in getIdleRequestId()
-                m_cv.notify_one();
-
-                try {
-                    if (exception_ptr) {
-                        std::rethrow_exception(exception_ptr);
-                    }
-                } catch (const std::exception& e) {
-                    OPENVINO_THROW(e.what());
-                }
+                // Nothing to deliver to Python, the request is idle right away
+                release_handle(handle);
+                rethrow(exception_ptr);
             });
         }
     }
 
-    void set_custom_callbacks(py::function f_callback) {
+    void set_custom_callbacks(py::function f_callback, bool batched) {
         // need to acquire GIL before py::function deletion
         auto callback_sp = Common::utils::wrap_pyfunction(std::move(f_callback));
 
         for (size_t handle = 0; handle < m_requests.size(); handle++) {
-            m_requests[handle].m_request->set_callback([this, callback_sp, handle](std::exception_ptr exception_ptr) {
-                *m_requests[handle].m_end_time = Time::now();
-                if (exception_ptr == nullptr) {
-                    // Acquire GIL, execute Python function
-                    ConditionalGILScopedAcquire acquire;
-                    try {
-                        (*callback_sp)(m_requests[handle], m_user_ids[handle]);
-                    } catch (const py::error_already_set& py_error) {
-                        // This should behave the same as assert(!PyErr_Occurred())
-                        // since constructor for pybind11's error_already_set is
-                        // performing PyErr_Fetch which clears error indicator and
-                        // saves it inside itself.
-                        assert(py_error.type());
-                        // acquire the mutex to access m_errors
-                        std::lock_guard<std::mutex> lock(m_mutex);
-                        m_errors.push(py_error);
+            m_requests[handle].m_request->set_callback(
+                [this, callback_sp, batched, handle](std::exception_ptr exception_ptr) {
+                    *m_requests[handle].m_end_time = Time::now();
+                    if (!batched) {
+                        if (!exception_ptr) {
+                            // Acquire GIL, execute Python function
+                            ConditionalGILScopedAcquire acquire;
+                            call_callback([&] {
+                                (*callback_sp)(m_requests[handle], m_user_ids[handle]);
+                            });
+                        }
+                        release_handle(handle);
+                        rethrow(exception_ptr);
+                        return;
                     }
-                }
-
-                {
-                    // acquire the mutex to access m_idle_handles
-                    std::lock_guard<std::mutex> lock(m_mutex);
-                    // Add idle handle to queue
-                    m_idle_handles.push(handle);
-                }
-                // Notify locks in getIdleRequestId()
-                m_cv.notify_one();
-
-                try {
-                    if (exception_ptr) {
-                        std::rethrow_exception(exception_ptr);
-                    }
-                } catch (const std::exception& e) {
-                    OPENVINO_THROW(e.what());
-                }
-            });
+                    m_failed[handle] = exception_ptr != nullptr;
+                    // the request becomes idle when it is delivered and this thread has left the draining,
+                    // so the next start_async() of the request never waits for the delivery of another one
+                    m_holds[handle].store(2, std::memory_order_relaxed);
+                    m_undelivered.fetch_add(1, std::memory_order_relaxed);
+                    m_completed_handles.push(handle);
+                    // either the drain below or the thread which is draining now sees the pushed handle
+                    std::atomic_thread_fence(std::memory_order_seq_cst);
+                    drain_completed(*callback_sp);
+                    drop_hold(handle);
+                    rethrow(exception_ptr);
+                });
         }
     }
 
     // AsyncInferQueue is the owner of all requests. When AsyncInferQueue is destroyed,
     // all of requests are destroyed as well.
     std::vector<InferRequestWrapper> m_requests;
-    std::queue<size_t> m_idle_handles;
     std::vector<py::object> m_user_ids;  // user ID can be any Python object
+
+private:
+    // Takes the idle request out of the queue, the GIL has to be held by the caller
+    size_t acquire_idle_handle() {
+        size_t idle_handle;
+        {
+            ConditionalGILScopedRelease release;
+            while (!m_idle_handles.pop(idle_handle)) {
+                wait_idle_handle();
+            }
+            m_requests[idle_handle].m_request->wait();
+        }
+        try {
+            check_errors();
+        } catch (...) {
+            release_handle(idle_handle);
+            throw;
+        }
+        return idle_handle;
+    }
+
+    static void rethrow(const std::exception_ptr& exception_ptr) {
+        try {
+            if (exception_ptr) {
+                std::rethrow_exception(exception_ptr);
+            }
+        } catch (const std::exception& e) {
+            OPENVINO_THROW(e.what());
+        }
+    }
+
+    void check_errors() {
+        if (m_has_errors.load(std::memory_order_acquire)) {
+            // acquire the mutex to access m_errors
+            std::lock_guard<std::mutex> lock(m_mutex);
+            throw m_errors.front();
+        }
+    }
+
+    // Blocks until there is an idle handle and returns it without taking out of the queue
+    size_t wait_idle_handle() {
+        size_t idle_handle;
+        if (m_idle_handles.front(idle_handle)) {
+            return idle_handle;
+        }
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_waiters.fetch_add(1);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        m_cv.wait(lock, [&] {
+            return m_idle_handles.front(idle_handle);
+        });
+        m_waiters.fetch_sub(1);
+        return idle_handle;
+    }
+
+    void release_handle(size_t handle) {
+        m_idle_handles.push(handle);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        // the mutex is touched only when somebody sleeps in wait_idle_handle()
+        if (m_waiters.load(std::memory_order_relaxed) > 0) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_cv.notify_all();
+        }
+    }
+
+    // Calls the Python callback and keeps its error for the next call of the queue, the GIL has to be held
+    void call_callback(const std::function<void()>& f) {
+        try {
+            f();
+        } catch (const py::error_already_set& py_error) {
+            // This should behave the same as assert(!PyErr_Occurred())
+            // since constructor for pybind11's error_already_set is
+            // performing PyErr_Fetch which clears error indicator and
+            // saves it inside itself.
+            assert(py_error.type());
+            // acquire the mutex to access m_errors
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_errors.push(py_error);
+            m_has_errors.store(true, std::memory_order_release);
+        }
+    }
+
+    // Releases the requests of the batch even if the delivery throws
+    class BatchGuard {
+    public:
+        BatchGuard(AsyncInferQueue& queue, std::vector<size_t>& batch) : m_queue(queue), m_batch(batch) {}
+
+        ~BatchGuard() {
+            for (auto handle : m_batch) {
+                m_queue.finish_delivery(handle);
+            }
+            m_batch.clear();
+        }
+
+    private:
+        AsyncInferQueue& m_queue;
+        std::vector<size_t>& m_batch;
+    };
+
+    // The completed requests are delivered to the batch callback by the thread which takes the draining role.
+    // The role is handed over before Python is called, so the completion threads never wait for each other
+    // and the requests completed while the callback runs are delivered by the next batch.
+    void drain_completed(const py::function& callback) {
+        std::vector<size_t> batch;
+        while (!m_completed_handles.empty() && !m_draining.exchange(true)) {
+            // every handle is in the ring at most once until it is delivered
+            batch.reserve(m_requests.size());
+            ConditionalGILScopedAcquire acquire;
+            do {
+                size_t handle;
+                while (m_completed_handles.pop(handle)) {
+                    batch.push_back(handle);
+                }
+                m_draining.store(false);
+                // either the check below or the thread which has pushed its handle meanwhile takes the role
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+            } while (!m_completed_handles.empty() && !m_draining.exchange(true));
+            BatchGuard guard(*this, batch);
+            deliver_batch(callback, batch);
+        }
+    }
+
+    void deliver_batch(const py::function& callback, const std::vector<size_t>& batch) {
+        call_callback([&] {
+            py::list completed;
+            for (auto handle : batch) {
+                if (!m_failed[handle]) {
+                    completed.append(py::make_tuple(m_requests[handle], m_user_ids[handle]));
+                }
+            }
+            if (!completed.empty()) {
+                callback(completed);
+            }
+        });
+    }
+
+    void finish_delivery(size_t handle) {
+        if (m_undelivered.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_cv.notify_all();
+        }
+        drop_hold(handle);
+    }
+
+    // The request is held by its delivery and by its completion thread
+    void drop_hold(size_t handle) {
+        if (m_holds[handle].fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            release_handle(handle);
+        }
+    }
+
+    // Blocks until the batch callback has been called for all the completed requests
+    void wait_delivered() {
+        if (m_undelivered.load(std::memory_order_acquire) == 0) {
+            return;
+        }
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cv.wait(lock, [&] {
+            return m_undelivered.load(std::memory_order_acquire) == 0;
+        });
+    }
+
+    // Python objects the inputs of the running requests may share memory with
+    std::vector<py::object> m_user_inputs;
+    HandleRing m_idle_handles;
+    HandleRing m_completed_handles;
+    std::vector<char> m_failed;
+    // the number of holds which keep the completed request from becoming idle in the batched mode
+    std::unique_ptr<std::atomic<int>[]> m_holds;
+    // the number of the completed requests not delivered to the batch callback yet
+    std::atomic<size_t> m_undelivered{0};
+    std::atomic<bool> m_draining{false};
+    std::atomic<size_t> m_waiters{0};
     std::mutex m_mutex;
     std::condition_variable m_cv;
+    std::atomic<bool> m_has_errors{false};
     std::queue<py::error_already_set> m_errors;
 };
 
@@ -187,24 +490,9 @@ void regclass_AsyncInferQueue(py::module m) {
     cls.def(
         "start_async",
         [](AsyncInferQueue& self, const ov::Tensor& inputs, py::object userdata) {
-            // getIdleRequestId function has an intention to block InferQueue
-            // until there is at least one idle (free to use) InferRequest
-            auto handle = self.get_idle_request_id();
-            {
-                std::lock_guard<std::mutex> lock(self.m_mutex);
-                self.m_idle_handles.pop();
-            }
-            // Set new inputs label/id from user
-            self.m_user_ids[handle] = userdata;
-            // Update inputs if there are any
-            self.m_requests[handle].m_request->set_input_tensor(inputs);
-            // Now GIL can be released - we are NOT working with Python objects in this block
-            {
-                ConditionalGILScopedRelease release;
-                *self.m_requests[handle].m_start_time = Time::now();
-                // Start InferRequest in asynchronus mode
-                self.m_requests[handle].m_request->start_async();
-            }
+            self.start_async(py::none(), std::move(userdata), [&inputs](ov::InferRequest& request) {
+                request.set_input_tensor(inputs);
+            });
         },
         py::arg("inputs"),
         py::arg("userdata"),
@@ -233,24 +521,10 @@ void regclass_AsyncInferQueue(py::module m) {
     cls.def(
         "start_async",
         [](AsyncInferQueue& self, const py::dict& inputs, py::object userdata) {
-            // getIdleRequestId function has an intention to block InferQueue
-            // until there is at least one idle (free to use) InferRequest
-            auto handle = self.get_idle_request_id();
-            {
-                std::lock_guard<std::mutex> lock(self.m_mutex);
-                self.m_idle_handles.pop();
-            }
-            // Set new inputs label/id from user
-            self.m_user_ids[handle] = userdata;
-            // Update inputs if there are any
-            Common::set_request_tensors(*self.m_requests[handle].m_request, inputs);
-            // Now GIL can be released - we are NOT working with Python objects in this block
-            {
-                ConditionalGILScopedRelease release;
-                *self.m_requests[handle].m_start_time = Time::now();
-                // Start InferRequest in asynchronus mode
-                self.m_requests[handle].m_request->start_async();
-            }
+            // the tensors may share memory with numpy arrays, so the dict is kept alive
+            self.start_async(inputs, std::move(userdata), [&inputs](ov::InferRequest& request) {
+                Common::set_request_tensors(request, inputs);
+            });
         },
         py::arg("inputs"),
         py::arg("userdata"),
@@ -269,6 +543,52 @@ void regclass_AsyncInferQueue(py::module m) {
             GIL is released while waiting for the next available InferRequest.
         )");
 
+    cls.def(
+        "_start_async_shared",
+        [](AsyncInferQueue& self, const py::object& inputs, py::object userdata) {
+            // the ports of all requests in the pool are the same
+            const auto& request = self.m_requests.front();
+            std::vector<std::pair<ov::Output<const ov::Node>, py::handle>> arrays;
+            if (py::isinstance<py::dict>(inputs)) {
+                for (auto&& input : inputs.cast<py::dict>()) {
+                    ov::Output<const ov::Node> port;
+                    // the unknown keys are reported by the regular dispatching
+                    if (!find_input_port(request, input.first, port)) {
+                        return false;
+                    }
+                    arrays.emplace_back(port, input.second);
+                }
+            } else if (request.m_inputs.size() == 1) {
+                arrays.emplace_back(request.m_inputs.front(), inputs);
+            }
+            if (arrays.empty() || !std::all_of(arrays.begin(), arrays.end(), [](const auto& array) {
+                    return is_shareable(array.second, array.first);
+                })) {
+                return false;
+            }
+            self.start_async(inputs, std::move(userdata), [&arrays](ov::InferRequest& request) {
+                for (const auto& array : arrays) {
+                    request.set_tensor(array.first, tensor_from_array(array.second, array.first));
+                }
+            });
+            return true;
+        },
+        py::arg("inputs"),
+        py::arg("userdata"),
+        R"(
+            Run asynchronous inference on numpy arrays without copying them.
+
+            Every array has to be C contiguous, writable and match the element type and the shape
+            of its input. The arrays are kept alive until the request is started again.
+
+            :param inputs: Single numpy array or dict of numpy arrays.
+            :type inputs: Union[numpy.ndarray, dict[Union[int, str, openvino.ConstOutput] : numpy.ndarray]]
+            :param userdata: Any data that will be passed to a callback
+            :type userdata: Any
+            :return: False if any of the inputs can't be shared, the inference isn't started in this case.
+            :rtype: bool
+        )");
+
     cls.def("is_ready",
             &AsyncInferQueue::_is_ready,
             R"(
@@ -301,8 +621,11 @@ void regclass_AsyncInferQueue(py::module m) {
             :rtype: int
         )");
 
-    cls.def("set_callback",
-            &AsyncInferQueue::set_custom_callbacks,
+    cls.def(
+        "set_callback",
+        [](AsyncInferQueue& self, py::function callback) {
+            self.set_custom_callbacks(std::move(callback), false);
+        },
             R"(
             Sets unified callback on all InferRequests from queue's pool.
             Signature of such function should have two arguments, where
@@ -317,6 +640,39 @@ void regclass_AsyncInferQueue(py::module m) {
 
                 async_infer_queue.set_callback(f)
 
+            The callback is called on the completion thread of the request, its wait() and
+            wait_all() return and the request becomes idle after the callback has returned.
+
+            :param callback: Any Python defined function that matches callback's requirements.
+            :type callback: function
+        )");
+
+    cls.def(
+        "set_batch_callback",
+        [](AsyncInferQueue& self, py::function callback) {
+            self.set_custom_callbacks(std::move(callback), true);
+        },
+        py::arg("callback"),
+        R"(
+            Sets callback which receives the InferRequests of the queue's pool completed since
+            the previous call. Signature of such function should have one argument, a list of
+            pairs of InferRequest object and userdata connected to it.
+
+            The GIL is acquired once per call instead of once per InferRequest, so it is the
+            preferable way to process a large number of small inferences.
+
+            The requests of the list become idle after the callback has returned, so start_async()
+            called from the callback waits for a request which is not in the list. wait_all()
+            returns after the callback has been called for all the completed requests.
+
+            .. code-block:: python
+
+                def f(completed):
+                    for request, userdata in completed:
+                        results[userdata] = request.output_tensors[0].data.copy()
+
+                async_infer_queue.set_batch_callback(f)
+
             :param callback: Any Python defined function that matches callback's requirements.
             :type callback: function
         )");
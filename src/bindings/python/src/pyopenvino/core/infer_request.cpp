@@ -658,6 +658,50 @@ void regclass_InferRequest(py::module m) {
             :rtype: openvino.CompiledModel
         )");
 
+    cls.def(
+        "set_property",
+        [](InferRequestWrapper& self, const std::map<std::string, py::object>& properties) {
+            self.m_request->set_property(Common::utils::properties_to_any_map(properties));
+        },
+        py::arg("properties"),
+        R"(
+            Sets properties for the infer request, for example
+            openvino.properties.hint.request_priority and openvino.properties.hint.request_deadline.
+
+            :param properties: dict of pairs: (property name, property value)
+            :type properties: dict
+            :rtype: None
+        )");
+
+    // Overload for single tuple
+    cls.def(
+        "set_property",
+        [](InferRequestWrapper& self, const std::pair<std::string, py::object>& property) {
+            ov::AnyMap _properties{{property.first, Common::utils::py_object_to_any(property.second)}};
+            self.m_request->set_property(_properties);
+        },
+        py::arg("property"),
+        R"(
+            Sets properties for the infer request.
+
+            :param property: tuple of (property name, matching property value).
+            :type property: tuple
+        )");
+
+    cls.def(
+        "get_property",
+        [](InferRequestWrapper& self, const std::string& property) -> py::object {
+            return Common::utils::from_ov_any(self.m_request->get_property(property));
+        },
+        py::arg("property"),
+        R"(
+            Gets properties for the infer request.
+
+            :param name: Property name.
+            :type name: str
+            :rtype: Any
+        )");
+
     cls.def_property_readonly(
         "userdata",
         [](InferRequestWrapper& self) {
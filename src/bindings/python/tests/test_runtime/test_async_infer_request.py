@@ -6,6 +6,7 @@ from collections.abc import Iterable
 from copy import deepcopy
 import numpy as np
 import pytest
+import threading
 import time
 import sysconfig
 
@@ -192,6 +193,108 @@ def test_infer_queue_get_idle_handle(device):
     queue.wait_all()
 
 
+@pytest.mark.skipif(sysconfig.get_config_var("Py_GIL_DISABLED"), reason="Ticket: 171534")
+def test_infer_queue_batch_callback(device):
+    jobs = 64
+    core = Core()
+    param = ops.parameter([10], np.float32)
+    model = Model(ops.relu(param), [param])
+    compiled_model = core.compile_model(model, device)
+    infer_queue = AsyncInferQueue(compiled_model, 4)
+    results = [None] * jobs
+    batches = []
+
+    def callback(completed):
+        batches.append(len(completed))
+        for request, job_id in completed:
+            results[job_id] = request.output_tensors[0].data.copy()
+
+    infer_queue.set_batch_callback(callback)
+    for i in range(jobs):
+        infer_queue.start_async({0: np.full([10], i - 32, dtype=np.float32)}, i)
+    infer_queue.wait_all()
+
+    assert sum(batches) == jobs
+    for i in range(jobs):
+        assert np.array_equal(results[i], np.full([10], max(i - 32, 0), dtype=np.float32))
+
+
+@pytest.mark.skipif(sysconfig.get_config_var("Py_GIL_DISABLED"), reason="Ticket: 171534")
+def test_infer_queue_wait_after_callback(device):
+    core = Core()
+    param = ops.parameter([10], np.float32)
+    model = Model(ops.relu(param), [param])
+    compiled_model = core.compile_model(model, device)
+    infer_queue = AsyncInferQueue(compiled_model, 4)
+    called = [False] * len(infer_queue)
+
+    def callback(request, userdata):
+        time.sleep(0.01)
+        called[userdata] = True
+
+    infer_queue.set_callback(callback)
+    for i in range(len(infer_queue)):
+        infer_queue.start_async({0: np.ones([10], dtype=np.float32)}, i)
+    # the callback runs on the completion thread of the request,
+    # the request is not completed until its callback has returned
+    for i in range(len(infer_queue)):
+        infer_queue[i].wait()
+        assert called[infer_queue.userdata[i]]
+
+
+@pytest.mark.skipif(sysconfig.get_config_var("Py_GIL_DISABLED"), reason="Ticket: 171534")
+def test_infer_queue_start_async_in_callback(device):
+    core = Core()
+    param = ops.parameter([10], np.float32)
+    model = Model(ops.relu(param), [param])
+    compiled_model = core.compile_model(model, device)
+    infer_queue = AsyncInferQueue(compiled_model, 3)
+    # the callback starts more requests than the rest of the pool has, so it waits
+    # for the requests it has started itself while the pool is saturated
+    chained_jobs = len(infer_queue)
+    completed = []
+
+    def callback(request, userdata):
+        completed.append(userdata)
+        if userdata == 0:
+            for job_id in range(1, chained_jobs + 1):
+                infer_queue.start_async({0: np.ones([10], dtype=np.float32)}, job_id)
+
+    def run():
+        infer_queue.set_callback(callback)
+        infer_queue.start_async({0: np.ones([10], dtype=np.float32)}, 0)
+        infer_queue.wait_all()
+
+    # the thread hangs if the callback never gets an idle request
+    thread = threading.Thread(target=run, daemon=True)
+    thread.start()
+    thread.join(timeout=60)
+    assert not thread.is_alive()
+    assert sorted(completed) == list(range(chained_jobs + 1))
+
+
+def test_infer_queue_shared_numpy_inputs(device):
+    core = Core()
+    param = ops.parameter([2, 3], np.float32)
+    model = Model(ops.relu(param), [param])
+    compiled_model = core.compile_model(model, device)
+    infer_queue = AsyncInferQueue(compiled_model, 2)
+    data = np.array([[-1, 2, -3], [4, -5, 6]], dtype=np.float32)
+
+    # the matching array is set on the request without copying
+    assert infer_queue._start_async_shared({0: data}, None)
+    infer_queue.wait_all()
+    assert any(np.shares_memory(request.input_tensors[0].data, data) for request in infer_queue)
+
+    # mismatched element type or non contiguous arrays are dispatched as usual
+    assert not infer_queue._start_async_shared({0: data.astype(np.float64)}, None)
+    assert not infer_queue._start_async_shared(np.asfortranarray(data), None)
+    infer_queue.start_async(data.astype(np.float64), None, share_inputs=True)
+    infer_queue.wait_all()
+    for request in infer_queue:
+        assert np.array_equal(request.output_tensors[0].data, np.maximum(data, 0))
+
+
 @pytest.mark.parametrize("share_inputs", [True, False])
 @pytest.mark.skipif(sysconfig.get_config_var("Py_GIL_DISABLED"), reason="Ticket: 171534")
 def test_results_async_infer(device, share_inputs):
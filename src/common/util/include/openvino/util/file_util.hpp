@@ -215,6 +215,15 @@ inline bool file_exists(const std::string& path) {
 }
 
 std::string get_file_ext(const std::string& path);
+
+/**
+ * @brief      Returns a string identifying the file version: the file identity, size, modification and status change
+ *             times. Any write to the file changes the status change time, even if the modification time is restored.
+ * @param[in]  path  The file name
+ * @return     The fingerprint or an empty string if the file status is not available
+ */
+std::string get_file_fingerprint(const std::string& path);
+
 ov::util::Path get_directory(const ov::util::Path& path);
 
 ov::util::Path path_join(std::initializer_list<ov::util::Path>&& paths);
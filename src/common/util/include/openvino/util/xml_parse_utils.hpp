@@ -179,6 +179,60 @@ float get_float_attr(const pugi::xml_node& node, const char* str, float defVal);
  */
 int get_int_child(const pugi::xml_node& node, const char* str, int defVal);
 
+/**
+ * @brief      Extension of the files in the binary document format, see save_binary_document
+ */
+constexpr const char* binary_document_extension = ".bxml";
+
+/**
+ * @brief      Checks whether the buffer starts with the header of the binary document format
+ *
+ * @param[in]  data  The buffer
+ * @param[in]  size  The buffer size
+ * @return     true if the buffer is a binary document
+ */
+bool is_binary_document(const char* data, size_t size);
+
+/**
+ * @brief      Writes the element tree of the document in the binary format: the flat tables of the elements and the
+ *             attributes referring to a table of unique NUL-terminated strings by offsets. The children of every element
+ *             are stored contiguously (breadth-first), so the document is restored without any tokenization.
+ *             Comments, declarations and the text of the elements with mixed content are not preserved.
+ *
+ * @param[in]  doc     The document
+ * @param      stream  The binary output stream
+ */
+void save_binary_document(const pugi::xml_document& doc, std::ostream& stream);
+
+/**
+ * @brief      Restores the document written by save_binary_document, throws on a malformed buffer.
+ *             The buffer may be released after the call.
+ *
+ * @param      doc   The document to fill, its content is reset
+ * @param[in]  data  The buffer, e.g. a memory mapped file
+ * @param[in]  size  The buffer size
+ */
+void load_binary_document(pugi::xml_document& doc, const char* data, size_t size);
+
+/**
+ * @brief      Reads an attribute of the root element of a binary document straight from its tables, without restoring
+ *             the document. The stream is read only at the offsets of the root element, its attributes and strings.
+ *
+ * @param[in]  data  The buffer of the binary document
+ * @param[in]  size  The buffer size
+ * @param[in]  root  The expected name of the root element, compared case-insensitively
+ * @param[in]  name  The attribute name
+ * @return     The attribute value, an empty string if the root element has another name, the attribute is missing
+ *             or the document is malformed
+ */
+std::string get_binary_document_root_attr(const char* data, size_t size, const char* root, const char* name);
+
+/**
+ * @brief      Reads an attribute of the root element of a binary document from a stream positioned at its beginning,
+ *             see the buffer overload. The stream position is not restored.
+ */
+std::string get_binary_document_root_attr(std::istream& stream, const char* root, const char* name);
+
 /**
  * @brief      A XML parse result structure with an error message and the `pugi::xml_document` document.
  * @ingroup    ov_dev_api_xml
@@ -307,6 +307,24 @@ void ov::util::create_directory_recursive(const std::filesystem::path& path) {
     }
 }
 
+std::string ov::util::get_file_fingerprint(const std::string& path) {
+    struct stat info;
+    if (stat(path.c_str(), &info) != 0) {
+        return {};
+    }
+    std::stringstream ss;
+    ss << info.st_dev << ':' << info.st_ino << ':' << info.st_size << ':';
+#if defined(__APPLE__)
+    ss << info.st_mtimespec.tv_sec << '.' << info.st_mtimespec.tv_nsec << ':' << info.st_ctimespec.tv_sec << '.'
+       << info.st_ctimespec.tv_nsec;
+#elif defined(_WIN32)
+    ss << info.st_mtime << ':' << info.st_ctime;
+#else
+    ss << info.st_mtim.tv_sec << '.' << info.st_mtim.tv_nsec << ':' << info.st_ctim.tv_sec << '.' << info.st_ctim.tv_nsec;
+#endif
+    return ss.str();
+}
+
 bool ov::util::directory_exists(const ov::util::Path& path) {
     return std::filesystem::is_directory(std::filesystem::status(path));
 }
@@ -6,13 +6,300 @@
 
 #include <algorithm>
 #include <cctype>
+#include <cstring>
+#include <deque>
+#include <functional>
 #include <limits>
 #include <set>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace ov {
 namespace util {
 
+namespace {
+// the binary document layout: Header, Element[elements], Attribute[attributes], char[strings_size]
+constexpr char binary_document_magic[4] = {'O', 'V', 'B', 'X'};
+constexpr uint32_t binary_document_version = 1;
+
+struct Header {
+    char magic[4];
+    uint32_t version;
+    uint64_t elements;
+    uint64_t attributes;
+    uint64_t strings_size;
+};
+
+struct Element {
+    uint32_t name;
+    uint32_t text;
+    uint32_t first_attribute;
+    uint32_t attribute_count;
+    uint32_t first_child;
+    uint32_t child_count;
+};
+
+struct Attribute {
+    uint32_t name;
+    uint32_t value;
+};
+
+class StringTable {
+public:
+    StringTable() {
+        // the offset 0 is the empty string
+        m_data.push_back('\0');
+    }
+
+    uint32_t add(const char* str) {
+        if (*str == '\0') {
+            return 0;
+        }
+        auto it = m_offsets.find(str);
+        if (it != m_offsets.end()) {
+            return it->second;
+        }
+        if (m_data.size() > std::numeric_limits<uint32_t>::max()) {
+            throw std::runtime_error("Binary document string table exceeds 4 GB");
+        }
+        const auto offset = static_cast<uint32_t>(m_data.size());
+        m_data.insert(m_data.end(), str, str + std::strlen(str) + 1);
+        m_offsets.emplace(str, offset);
+        return offset;
+    }
+
+    const std::vector<char>& data() const {
+        return m_data;
+    }
+
+private:
+    std::vector<char> m_data;
+    std::unordered_map<std::string, uint32_t> m_offsets;
+};
+
+uint32_t to_index(size_t value) {
+    if (value > std::numeric_limits<uint32_t>::max()) {
+        throw std::runtime_error("Binary document has too many elements");
+    }
+    return static_cast<uint32_t>(value);
+}
+}  // namespace
+
+bool pugixml::is_binary_document(const char* data, size_t size) {
+    return size >= sizeof(Header) && std::memcmp(data, binary_document_magic, sizeof(binary_document_magic)) == 0;
+}
+
+void pugixml::save_binary_document(const pugi::xml_document& doc, std::ostream& stream) {
+    std::vector<Element> elements;
+    std::vector<Attribute> attributes;
+    StringTable strings;
+
+    std::deque<pugi::xml_node> queue;
+    const auto root = doc.document_element();
+    if (root) {
+        queue.push_back(root);
+        elements.emplace_back();
+    }
+    // breadth-first: the children of the element are appended right when the element is visited
+    for (size_t idx = 0; !queue.empty(); idx++) {
+        const auto node = queue.front();
+        queue.pop_front();
+        auto& element = elements[idx];
+        element.name = strings.add(node.name());
+        element.text = strings.add(node.child_value());
+        element.first_attribute = to_index(attributes.size());
+        for (const auto& attribute : node.attributes()) {
+            attributes.push_back({strings.add(attribute.name()), strings.add(attribute.value())});
+        }
+        element.attribute_count = to_index(attributes.size()) - element.first_attribute;
+        const auto first_child = to_index(elements.size());
+        for (const auto& child : node.children()) {
+            if (child.type() == pugi::node_element) {
+                queue.push_back(child);
+                elements.emplace_back();
+            }
+        }
+        // the reference may be invalidated by the children
+        elements[idx].first_child = first_child;
+        elements[idx].child_count = to_index(elements.size()) - first_child;
+    }
+
+    Header header;
+    std::memcpy(header.magic, binary_document_magic, sizeof(header.magic));
+    header.version = binary_document_version;
+    header.elements = elements.size();
+    header.attributes = attributes.size();
+    header.strings_size = strings.data().size();
+    stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    stream.write(reinterpret_cast<const char*>(elements.data()), elements.size() * sizeof(Element));
+    stream.write(reinterpret_cast<const char*>(attributes.data()), attributes.size() * sizeof(Attribute));
+    stream.write(strings.data().data(), strings.data().size());
+}
+
+namespace {
+// reads the given number of bytes at the offset of the binary document, false if it is out of range
+using BinaryDocumentReader = std::function<bool(uint64_t offset, char* dst, size_t size)>;
+
+std::string get_root_attr(const BinaryDocumentReader& read, const char* root, const char* name) {
+    Header header;
+    const uint64_t limit = std::numeric_limits<uint32_t>::max();
+    if (!read(0, reinterpret_cast<char*>(&header), sizeof(header)) ||
+        std::memcmp(header.magic, binary_document_magic, sizeof(binary_document_magic)) != 0 ||
+        header.version != binary_document_version || header.elements == 0 || header.elements > limit ||
+        header.attributes > limit || header.strings_size == 0 || header.strings_size > limit) {
+        return {};
+    }
+    const uint64_t attributes_offset = sizeof(Header) + header.elements * sizeof(Element);
+    const uint64_t strings_offset = attributes_offset + header.attributes * sizeof(Attribute);
+
+    // reads the string by chunks up to its terminator, false if it is longer than max_size
+    auto read_string = [&](uint32_t offset, size_t max_size, std::string& str) {
+        constexpr uint64_t chunk_size = 64;
+        str.clear();
+        for (uint64_t pos = offset; pos < header.strings_size && str.size() <= max_size;) {
+            char chunk[chunk_size];
+            const auto size = static_cast<size_t>(std::min(chunk_size, header.strings_size - pos));
+            if (!read(strings_offset + pos, chunk, size)) {
+                return false;
+            }
+            const auto end = std::find(chunk, chunk + size, '\0');
+            str.append(chunk, end);
+            if (end != chunk + size) {
+                return str.size() <= max_size;
+            }
+            pos += size;
+        }
+        return false;
+    };
+    auto equal_names = [](const std::string& lhs, const char* rhs) {
+        return lhs.size() == std::strlen(rhs) && std::equal(lhs.begin(), lhs.end(), rhs, [](char l, char r) {
+                   return std::tolower(static_cast<unsigned char>(l)) == std::tolower(static_cast<unsigned char>(r));
+               });
+    };
+
+    Element element;
+    std::string str;
+    if (!read(sizeof(Header), reinterpret_cast<char*>(&element), sizeof(element)) ||
+        !read_string(element.name, std::strlen(root), str) || !equal_names(str, root) ||
+        static_cast<uint64_t>(element.first_attribute) + element.attribute_count > header.attributes) {
+        return {};
+    }
+    for (uint32_t i = 0; i < element.attribute_count; i++) {
+        Attribute attribute;
+        if (!read(attributes_offset + (static_cast<uint64_t>(element.first_attribute) + i) * sizeof(Attribute),
+                  reinterpret_cast<char*>(&attribute),
+                  sizeof(attribute))) {
+            return {};
+        }
+        if (read_string(attribute.name, std::strlen(name), str) && str == name) {
+            return read_string(attribute.value, std::numeric_limits<size_t>::max() - 1, str) ? str : std::string{};
+        }
+    }
+    return {};
+}
+}  // namespace
+
+std::string pugixml::get_binary_document_root_attr(const char* data, size_t size, const char* root, const char* name) {
+    return get_root_attr(
+        [data, size](uint64_t offset, char* dst, size_t count) {
+            if (offset > size || count > size - offset) {
+                return false;
+            }
+            std::memcpy(dst, data + offset, count);
+            return true;
+        },
+        root,
+        name);
+}
+
+std::string pugixml::get_binary_document_root_attr(std::istream& stream, const char* root, const char* name) {
+    return get_root_attr(
+        [&stream](uint64_t offset, char* dst, size_t count) {
+            stream.clear();
+            stream.seekg(static_cast<std::streamoff>(offset), std::ios::beg);
+            stream.read(dst, static_cast<std::streamsize>(count));
+            return stream.gcount() == static_cast<std::streamsize>(count);
+        },
+        root,
+        name);
+}
+
+void pugixml::load_binary_document(pugi::xml_document& doc, const char* data, size_t size) {
+    if (!is_binary_document(data, size)) {
+        throw std::runtime_error("Buffer is not a binary document");
+    }
+    Header header;
+    std::memcpy(&header, data, sizeof(header));
+    if (header.version != binary_document_version) {
+        throw std::runtime_error("Unsupported binary document version " + std::to_string(header.version));
+    }
+    const uint64_t limit = std::numeric_limits<uint32_t>::max();
+    if (header.elements > limit || header.attributes > limit || header.strings_size == 0 ||
+        header.strings_size > limit ||
+        size - sizeof(Header) < header.elements * sizeof(Element) + header.attributes * sizeof(Attribute) +
+                                    header.strings_size) {
+        throw std::runtime_error("Binary document is truncated or malformed");
+    }
+    std::vector<Element> elements(header.elements);
+    std::vector<Attribute> attributes(header.attributes);
+    const char* ptr = data + sizeof(Header);
+    std::memcpy(elements.data(), ptr, elements.size() * sizeof(Element));
+    ptr += elements.size() * sizeof(Element);
+    std::memcpy(attributes.data(), ptr, attributes.size() * sizeof(Attribute));
+    ptr += attributes.size() * sizeof(Attribute);
+    const char* strings = ptr;
+    if (strings[header.strings_size - 1] != '\0') {
+        throw std::runtime_error("Binary document string table is not terminated");
+    }
+    auto string_at = [&](uint32_t offset) {
+        if (offset >= header.strings_size) {
+            throw std::runtime_error("Binary document string offset is out of range");
+        }
+        return strings + offset;
+    };
+
+    doc.reset();
+    if (elements.empty()) {
+        return;
+    }
+    // every element except the root must be claimed by exactly one parent: a shared child range would restore
+    // a subtree once per referring parent, so a small malformed buffer could expand exponentially
+    std::vector<bool> claimed(elements.size(), false);
+    claimed[0] = true;
+    // the children are pushed in the reverse order to be appended in the original one
+    std::vector<std::pair<pugi::xml_node, uint32_t>> stack{{doc, 0}};
+    while (!stack.empty()) {
+        auto [parent, idx] = stack.back();
+        stack.pop_back();
+        const auto& element = elements[idx];
+        auto node = parent.append_child(string_at(element.name));
+        if (static_cast<uint64_t>(element.first_attribute) + element.attribute_count > attributes.size()) {
+            throw std::runtime_error("Binary document attribute index is out of range");
+        }
+        for (uint32_t i = 0; i < element.attribute_count; i++) {
+            const auto& attribute = attributes[element.first_attribute + i];
+            node.append_attribute(string_at(attribute.name)).set_value(string_at(attribute.value));
+        }
+        if (element.text != 0) {
+            node.append_child(pugi::node_pcdata).set_value(string_at(element.text));
+        }
+        // the children always follow their parent, so the malformed indices can't make a cycle
+        const auto children_end = static_cast<uint64_t>(element.first_child) + element.child_count;
+        if (element.child_count > 0 && (element.first_child <= idx || children_end > elements.size())) {
+            throw std::runtime_error("Binary document child index is out of range");
+        }
+        for (uint32_t i = element.child_count; i > 0; i--) {
+            const auto child = element.first_child + i - 1;
+            if (claimed[child]) {
+                throw std::runtime_error("Binary document element is referenced by more than one parent");
+            }
+            claimed[child] = true;
+            stack.emplace_back(node, child);
+        }
+    }
+}
+
 int pugixml::get_int_attr(const pugi::xml_node& node, const char* str) {
     auto attr = node.attribute(str);
     if (attr.empty()) {
@@ -285,7 +285,8 @@ bool replace_node_update_name(const std::shared_ptr<Node>& target, const std::sh
 /// are applied. It is recommended to use ov::save_model function instead of ov::serialize, because it is aligned
 /// with default model conversion flow.
 /// \param m Model which will be converted to IR representation.
-/// \param xml_path Path where .xml file will be saved.
+/// \param xml_path Path where .xml file will be saved. With the .bxml extension the topology is saved in the binary
+///                 format, which the IR frontend loads without XML parsing.
 /// \param bin_path Path where .bin file will be saved (optional).
 ///                 The same name as for xml_path will be used by default.
 /// \param version Version of the generated IR (optional).
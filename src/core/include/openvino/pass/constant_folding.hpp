@@ -4,6 +4,9 @@
 
 #pragma once
 
+#include <functional>
+#include <memory>
+
 #include "openvino/core/runtime_attribute.hpp"
 #include "openvino/pass/pass.hpp"
 
@@ -14,6 +17,9 @@ namespace pass {
  * @brief Constant folding iterates over the function and tries to evaluate nodes
  *        with constant inputs. Such nodes are then replaced with new Constants containing
  *        the result of a folded operation.
+ *
+ *        The folded nodes are released as soon as they are processed, so an intermediate constant
+ *        is freed right after its last consumer has been folded.
  * @ingroup ov_pass_cpp_api
  */
 class OPENVINO_API ConstantFolding : public ModelPass {
@@ -26,6 +32,36 @@ protected:
     /// \brief Folds pre-calculated output tensor values to constants in case lower and
     /// upper estimations are equal. Traverses graph backwards starting from the results.
     bool pre_calculated_values_folding(const std::shared_ptr<ov::Model>& model);
+    /// \brief Folds the model, \p fold_node is tried first for every foldable node and folds it in its own way
+    /// if it returns true. \p on_folded is called for every constant created by the regular folding.
+    bool fold_model(const std::shared_ptr<ov::Model>& model,
+                    const std::function<bool(const std::shared_ptr<Node>&)>& fold_node,
+                    const std::function<void(const Output<Node>&)>& on_folded);
+};
+
+/**
+ * @brief Constant folding which folds the chains of element-wise operations producing the constants
+ *        larger than the tile size tile by tile along the outermost dimension, so the intermediate results
+ *        of such chains (e.g. Convert->Subtract->Multiply weights decompression) are never materialized in full.
+ *        The rest of the nodes are folded the same way as by ConstantFolding.
+ * @ingroup ov_pass_cpp_api
+ */
+class OPENVINO_API TiledConstantFolding : public ConstantFolding {
+public:
+    OPENVINO_RTTI("TiledConstantFolding", "0", ConstantFolding);
+
+    /// \param tile_size The size in bytes of the tile of the folded chain output.
+    explicit TiledConstantFolding(size_t tile_size);
+
+    bool run_on_model(const std::shared_ptr<ov::Model>& model) override;
+
+    /// \brief Returns the peak size in bytes of the constants created by this pass which were alive at once.
+    /// Only the constants of 1 MB and larger are accounted.
+    size_t get_peak_memory_usage() const;
+
+private:
+    class Impl;
+    std::shared_ptr<Impl> m_impl;
 };
 
 /**
@@ -4,16 +4,25 @@
 
 #include "openvino/pass/constant_folding.hpp"
 
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
 #include "openvino/cc/pass/itt.hpp"
 #include "openvino/core/constant_fold_utils.hpp"
 #include "openvino/core/rt_info.hpp"
 #include "openvino/core/rt_info/weightless_caching_attributes.hpp"
 #include "openvino/op/constant.hpp"
 #include "openvino/op/convert.hpp"
+#include "openvino/op/util/binary_elementwise_arithmetic.hpp"
 #include "openvino/op/util/op_types.hpp"
 #include "openvino/op/util/read_value_base.hpp"
 #include "openvino/op/util/shape_of_base.hpp"
 #include "openvino/op/util/sub_graph_base.hpp"
+#include "openvino/op/util/unary_elementwise_arithmetic.hpp"
+#include "openvino/runtime/tensor.hpp"
 #include "transformations/rt_info/decompression.hpp"
 #include "transformations/rt_info/dequantization_node.hpp"
 
@@ -101,12 +110,234 @@ static void remove_requires_precision_conversion_attribute(const std::shared_ptr
     }
 }
 
+/**
+ * \brief Check if the node can be evaluated on a part of its output along the outermost dimension.
+ */
+static bool is_tileable(const ov::Node* node) {
+    if (node->get_output_size() != 1 || node->get_output_partial_shape(0).is_dynamic() ||
+        ov::shape_size(node->get_output_shape(0)) == 0 || node->get_output_shape(0).empty() ||
+        node->get_output_element_type(0) == ov::element::string) {
+        return false;
+    }
+    if (ov::is_type<ov::op::v0::Convert>(node) || ov::is_type<ov::op::util::UnaryElementwiseArithmetic>(node)) {
+        return true;
+    }
+    if (const auto binary = ov::as_type<const ov::op::util::BinaryElementwiseArithmetic>(node)) {
+        const auto broadcast = binary->get_autob().m_type;
+        return broadcast == ov::op::AutoBroadcastType::NUMPY || broadcast == ov::op::AutoBroadcastType::NONE;
+    }
+    return false;
+}
+
+/**
+ * \brief Check if the input of the tiled node has the outermost dimension of the output, so it has to be sliced.
+ */
+static bool is_sliced_input(const ov::Input<ov::Node>& input) {
+    const auto& shape = input.get_shape();
+    const auto& output_shape = input.get_node()->get_output_shape(0);
+    return shape.size() == output_shape.size() && shape[0] == output_shape[0];
+}
+
+/**
+ * \brief Create the view of the rows [begin, begin + count) of the tensor along its outermost dimension.
+ */
+static ov::Tensor get_rows(ov::Tensor& tensor, size_t begin, size_t count) {
+    auto shape = tensor.get_shape();
+    const auto row_bits = ov::shape_size(shape) / shape[0] * tensor.get_element_type().bitwidth();
+    shape[0] = count;
+    return ov::Tensor(tensor.get_element_type(), shape, static_cast<uint8_t*>(tensor.data()) + begin * row_bits / 8);
+}
+
+class ov::pass::TiledConstantFolding::Impl {
+public:
+    explicit Impl(size_t tile_size) : m_tile_size(tile_size) {}
+
+    /// \brief Folds the chain of element-wise operations starting at \p node tile by tile.
+    /// \return false if the chain is too small or can't be evaluated by tiles.
+    bool fold_by_tiles(TiledConstantFolding& pass, const std::shared_ptr<Node>& node);
+    void track_memory_usage(const Output<Node>& constant);
+
+    size_t get_peak_memory_usage() const {
+        return m_peak_memory_usage;
+    }
+
+private:
+    size_t m_tile_size;
+    size_t m_peak_memory_usage = 0;
+    std::vector<std::pair<std::weak_ptr<Node>, size_t>> m_tracked_constants;
+};
+
+void ov::pass::TiledConstantFolding::Impl::track_memory_usage(const Output<Node>& constant) {
+    constexpr size_t min_tracked_size = 1 << 20;
+    const auto node = ov::as_type_ptr<ov::op::v0::Constant>(constant.get_node_shared_ptr());
+    if (!node || node->get_byte_size() < min_tracked_size) {
+        return;
+    }
+    m_tracked_constants.erase(std::remove_if(m_tracked_constants.begin(),
+                                             m_tracked_constants.end(),
+                                             [](const std::pair<std::weak_ptr<Node>, size_t>& tracked) {
+                                                 return tracked.first.expired();
+                                             }),
+                              m_tracked_constants.end());
+    m_tracked_constants.emplace_back(node, node->get_byte_size());
+    size_t usage = 0;
+    for (const auto& tracked : m_tracked_constants) {
+        usage += tracked.second;
+    }
+    m_peak_memory_usage = std::max(m_peak_memory_usage, usage);
+}
+
+bool ov::pass::TiledConstantFolding::Impl::fold_by_tiles(TiledConstantFolding& pass,
+                                                         const std::shared_ptr<Node>& node) {
+    if (!is_tileable(node.get())) {
+        return false;
+    }
+    const auto shape = node->get_output_shape(0);
+    const auto rows = shape[0];
+    const auto row_size = shape_size(shape) / rows;
+
+    // collect the chain of element-wise nodes each of which is the only consumer of the previous one
+    NodeVector chain{node};
+    while (true) {
+        const auto targets = chain.back()->get_output_target_inputs(0);
+        if (targets.size() != 1) {
+            break;
+        }
+        const auto next = targets.begin()->get_node()->shared_from_this();
+        if (!is_tileable(next.get()) || next->get_output_shape(0) != shape || constant_folding_is_disabled(next) ||
+            !is_output_foldable(next->output(0))) {
+            break;
+        }
+        size_t chain_inputs = 0;
+        bool constant_inputs = true;
+        for (const auto& input : next->input_values()) {
+            if (input.get_node() == chain.back().get()) {
+                chain_inputs++;
+            } else if (!ov::is_type<ov::op::v0::Constant>(input.get_node())) {
+                constant_inputs = false;
+            }
+        }
+        if (chain_inputs != 1 || !constant_inputs) {
+            break;
+        }
+        chain.push_back(next);
+    }
+
+    if (chain.size() < 2 || rows < 2) {
+        return false;
+    }
+    size_t max_row_bits = 0;
+    const auto update_row_bits = [&](const element::Type& type) {
+        const auto row_bits = row_size * type.bitwidth();
+        max_row_bits = std::max(max_row_bits, row_bits);
+        return row_bits % 8 == 0;
+    };
+    for (const auto& chain_node : chain) {
+        for (const auto& input : chain_node->inputs()) {
+            // the folded inputs may be stored in other precision than the operation expects
+            if (util::has_original_input_precision(input) &&
+                util::get_original_input_precision(input) != input.get_element_type()) {
+                return false;
+            }
+            // the tiles of the sub-byte types have to start at the byte boundary
+            if (is_sliced_input(input) && !update_row_bits(input.get_element_type())) {
+                return false;
+            }
+        }
+        if (!update_row_bits(chain_node->get_output_element_type(0))) {
+            return false;
+        }
+    }
+    if (rows * max_row_bits / 8 <= m_tile_size) {
+        return false;
+    }
+
+    const auto tile_rows = std::max<size_t>(1, m_tile_size / (max_row_bits / 8));
+    auto tile_shape = shape;
+    tile_shape[0] = tile_rows;
+    // the intermediate results are kept for a single tile only
+    TensorVector buffers;
+    for (size_t i = 0; i + 1 < chain.size(); ++i) {
+        buffers.emplace_back(chain[i]->get_output_element_type(0), tile_shape);
+    }
+    Tensor result(chain.back()->get_output_element_type(0), shape);
+
+    for (size_t begin = 0; begin < rows; begin += tile_rows) {
+        const auto count = std::min(tile_rows, rows - begin);
+        Tensor previous;
+        for (size_t i = 0; i < chain.size(); ++i) {
+            const auto& chain_node = chain[i];
+            TensorVector inputs;
+            for (const auto& input : chain_node->inputs()) {
+                if (i > 0 && input.get_source_output().get_node() == chain[i - 1].get()) {
+                    inputs.push_back(previous);
+                    continue;
+                }
+                const auto constant = ov::as_type<ov::op::v0::Constant>(input.get_source_output().get_node());
+                auto tensor = constant->get_tensor_view();
+                inputs.push_back(is_sliced_input(input) ? get_rows(tensor, begin, count) : tensor);
+            }
+            const auto is_tail = i + 1 == chain.size();
+            TensorVector outputs{is_tail ? get_rows(result, begin, count) : get_rows(buffers[i], 0, count)};
+            if (!util::evaluate_node_with_unsupported_precision(chain_node.get(), outputs, inputs) &&
+                !chain_node->evaluate(outputs, inputs)) {
+                return false;
+            }
+            previous = outputs[0];
+        }
+    }
+
+    const auto& tail = chain.back();
+    auto replacement = std::make_shared<ov::op::v0::Constant>(result);
+    replacement->set_friendly_name(friendly_name_from(*tail, 1, 0));
+    NodeVector from;
+    for (const auto& chain_node : chain) {
+        restore_original_input_precision(chain_node);
+        remove_requires_precision_conversion_attribute(chain_node);
+        pass.copy_runtime_info_from_input_values(chain_node);
+        from.push_back(chain_node);
+    }
+    tail->output(0).replace(replacement);
+    copy_runtime_info(from, replacement);
+    ov::copy_weightless_cache_attr(tail, replacement);
+    track_memory_usage(replacement);
+    return true;
+}
+
+ov::pass::TiledConstantFolding::TiledConstantFolding(size_t tile_size)
+    : m_impl(std::make_shared<Impl>(tile_size)) {}
+
+size_t ov::pass::TiledConstantFolding::get_peak_memory_usage() const {
+    return m_impl->get_peak_memory_usage();
+}
+
+bool ov::pass::TiledConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& model) {
+    RUN_ON_MODEL_SCOPE(TiledConstantFolding);
+    return fold_model(
+        model,
+        [this](const std::shared_ptr<Node>& node) {
+            return m_impl->fold_by_tiles(*this, node);
+        },
+        [this](const Output<Node>& constant) {
+            m_impl->track_memory_usage(constant);
+        });
+}
+
 bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& model) {
     RUN_ON_MODEL_SCOPE(ConstantFolding);
+    return fold_model(model, nullptr, nullptr);
+}
 
+bool ov::pass::ConstantFolding::fold_model(const std::shared_ptr<ov::Model>& model,
+                                           const std::function<bool(const std::shared_ptr<Node>&)>& fold_node,
+                                           const std::function<void(const Output<Node>&)>& on_folded) {
     bool rewritten = pre_calculated_values_folding(model);
 
-    for (const auto& original_node : model->get_ordered_ops()) {
+    auto ordered_ops = model->get_ordered_ops();
+    for (auto& ordered_op : ordered_ops) {
+        // release the node once it is processed, so the constants it consumed are freed
+        // as soon as they are not needed by the other consumers
+        const auto original_node = std::move(ordered_op);
         auto node = original_node;
         if (!original_node->can_constant_fold(original_node->input_values())) {
             if (auto sub_graph_node = ov::as_type_ptr<ov::op::util::MultiSubGraphOp>(node)) {
@@ -123,6 +354,10 @@ bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& m
             }
             continue;
         }
+        if (fold_node && fold_node(original_node)) {
+            rewritten = true;
+            continue;
+        }
         if (node_has_requires_precision_conversion_attribute(node)) {
             remove_requires_precision_conversion_attribute(node);
             node = util::convert_to_supported_precision(node.get());
@@ -157,6 +392,9 @@ bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& m
                     // Propagate runtime info attributes to replacement
                     copy_runtime_info(original_node, replacement_ptr);
                     ov::copy_weightless_cache_attr(original_node, replacement_ptr);
+                    if (on_folded) {
+                        on_folded(replacement);
+                    }
 
                     rewritten = true;
                 }
@@ -5,6 +5,7 @@
 #include "openvino/pass/graph_rewrite.hpp"
 
 #include <algorithm>
+#include <chrono>
 #include <deque>
 #include <iostream>
 #include <regex>
@@ -16,6 +17,8 @@
 #include "openvino/core/log_util.hpp"
 #include "openvino/op/util/multi_subgraph_base.hpp"
 #include "openvino/pass/backward_graph_rewrite.hpp"
+#include "openvino/pass/pattern/op/optional.hpp"
+#include "openvino/pass/pattern/op/or.hpp"
 #include "openvino/pass/pattern/op/wrap_type.hpp"
 #include "openvino/util/log.hpp"
 #include "perf_counters.hpp"
@@ -66,6 +69,45 @@ PerfCounters& perf_counters_graph_rewrite() {
 }  // namespace ov
 
 #endif  // ENABLE_PROFILING_ITT
+
+namespace {
+/// Collects the types of the nodes the pattern root can be matched with. Returns false if the root matches
+/// the nodes of any type.
+bool collect_root_types(const std::shared_ptr<ov::Node>& root, std::vector<ov::NodeTypeInfo>& types) {
+    using namespace ov::pass::pattern::op;
+    // pattern::op::AnyOutput operation automatically appends for multi output operations inside
+    // Matcher and to gen actual root node we need to take it's parent.
+    if (ov::as_type_ptr<AnyOutput>(root)) {
+        return collect_root_types(root->get_input_node_shared_ptr(0), types);
+    }
+    if (auto wrap_type = ov::as_type_ptr<WrapType>(root)) {
+        const auto& wrapped_types = wrap_type->get_wrapped_types();
+        types.insert(types.end(), wrapped_types.begin(), wrapped_types.end());
+        return true;
+    }
+    // any of the alternatives
+    if (ov::as_type_ptr<Or>(root)) {
+        for (const auto& input : root->input_values()) {
+            if (!collect_root_types(input.get_node_shared_ptr(), types)) {
+                return false;
+            }
+        }
+        return true;
+    }
+    // either the optional node or its input
+    if (auto optional = ov::as_type_ptr<Optional>(root)) {
+        const auto optional_types = optional->get_optional_types();
+        types.insert(types.end(), optional_types.begin(), optional_types.end());
+        return root->get_input_size() > 0 && collect_root_types(root->get_input_node_shared_ptr(0), types);
+    }
+    if (std::dynamic_pointer_cast<Pattern>(root)) {
+        return false;
+    }
+    types.push_back(root->get_type_info());
+    return true;
+}
+}  // namespace
+
 std::shared_ptr<ov::pass::MatcherPass> ov::pass::GraphRewrite::add_matcher(
     const std::shared_ptr<ov::pass::MatcherPass>& pass) {
     auto pass_config = get_pass_config();
@@ -101,47 +143,53 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
     bool rewritten = false;
     const auto& pass_config = get_pass_config();
 
-    // Check that all Matchers in MatcherPasses has type bases root node
-    bool all_roots_has_type = true;
+    // The matchers are indexed by the types of their pattern roots, the matchers with the root of any type are
+    // tried for every node
     std::unordered_map<NodeTypeInfo, std::vector<size_t>> type_to_matcher;
+    std::vector<size_t> any_type_matchers;
+    std::vector<NodeTypeInfo> root_types;
     for (size_t matcher_index = 0; matcher_index < m_matchers.size(); ++matcher_index) {
         // Skip passes that are disabled
         if (pass_config->is_disabled(m_matchers[matcher_index]->get_type_info()))
             continue;
 
         auto matcher = m_matchers[matcher_index]->get_matcher();
-        if (!matcher) {
-            all_roots_has_type = false;
-            break;
+        root_types.clear();
+        if (!matcher || !collect_root_types(matcher->get_pattern_value().get_node_shared_ptr(), root_types)) {
+            any_type_matchers.push_back(matcher_index);
+            continue;
         }
-
-        auto root = matcher->get_pattern_value().get_node_shared_ptr();
-        // pattern::op::AnyOutput operation automatically appends for multi output operations inside
-        // Matcher and to gen actual root node we need to take it's parent.
-        if (auto any_type = ov::as_type_ptr<pattern::op::AnyOutput>(root)) {
-            root = any_type->input_value(0).get_node_shared_ptr();
+        for (const auto& root_type : root_types) {
+            auto& matchers = type_to_matcher[root_type];
+            // the alternatives of the same pattern may have the same type
+            if (matchers.empty() || matchers.back() != matcher_index) {
+                matchers.push_back(matcher_index);
+            }
         }
+    }
 
-        // if root is an operation from opset or has pattern::op::WrapType type then we can extract
-        // it's type
-        // and use it in unordered_map as key for fast MatcherPass search. Otherwise type is unknown
-        // and default algorithm is used.
-        if (auto p = std::dynamic_pointer_cast<pattern::op::Pattern>(root)) {
-            if (auto any_type = ov::as_type_ptr<ov::pass::pattern::op::WrapType>(p)) {
-                for (const auto& root_type_info : any_type->get_wrapped_types()) {
-                    type_to_matcher[root_type_info].push_back(matcher_index);
-                }
-            } else {
-                all_roots_has_type = false;
-                break;
+    // The matchers for the node type: the ones registered for the type and its parents and the ones with
+    // the root of any type, in the order of the registration. The list is collected once per node type.
+    std::unordered_map<NodeTypeInfo, std::vector<size_t>> node_type_to_matchers;
+    const auto get_matchers = [&](const NodeTypeInfo& type_info) -> const std::vector<size_t>& {
+        auto it = node_type_to_matchers.find(type_info);
+        if (it != node_type_to_matchers.end()) {
+            return it->second;
+        }
+        std::vector<size_t> matchers = any_type_matchers;
+        for (const DiscreteTypeInfo* node_type_info = &type_info; node_type_info;
+             node_type_info = node_type_info->parent) {
+            auto found = type_to_matcher.find(*node_type_info);
+            if (found != type_to_matcher.end()) {
+                matchers.insert(matchers.end(), found->second.begin(), found->second.end());
             }
-        } else {
-            type_to_matcher[root->get_type_info()].push_back(matcher_index);
         }
+        std::sort(matchers.begin(), matchers.end());
+        matchers.erase(std::unique(matchers.begin(), matchers.end()), matchers.end());
+        return node_type_to_matchers.emplace(type_info, std::move(matchers)).first->second;
+    };
 
-        // TODO: traverse parents for root_type_info in order to register complete list of matchers
-        // including ones triggered by parent type info.
-    }
+    auto& matcher_counters = MatcherCounters::get();
 
     // This lambda preforms execution of particular MatcherPass on given node.
     // It automatically handles nodes registered by MatcherPass during transformation and set
@@ -159,7 +207,14 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
 
         // Apply MatcherPass. In case if it returns true no other MatcherPasses will apply
         // to this node
-        bool status = m_pass->apply(std::move(node));
+        bool status = false;
+        if (matcher_counters.is_enabled()) {
+            const auto start = std::chrono::steady_clock::now();
+            status = m_pass->apply(std::move(node));
+            matcher_counters.add(m_pass->get_name(), status, std::chrono::steady_clock::now() - start);
+        } else {
+            status = m_pass->apply(std::move(node));
+        }
 
         // In case if MatcherPass registered nodes they will be added to the beginning of execution
         // queue
@@ -175,9 +230,6 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         return status;
     };
 
-    // list of matchers to run for a node; define here to keep memory allocated
-    std::vector<size_t> matcher_passes_to_run;
-
     while (!nodes_to_run.empty()) {
         auto weak_node = nodes_to_run.front();
         nodes_to_run.pop_front();
@@ -200,47 +252,10 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         if (m_enable_shape_inference) {
             node->revalidate_and_infer_types();
         }
-        // If all Matchers in MatcherPasses has type based root node then we apply efficient
-        // algorithm for finding matchers
-        if (all_roots_has_type) {
-            const DiscreteTypeInfo* node_type_info = &node->get_type_info();
-            matcher_passes_to_run.clear();
-            while (node_type_info) {
-                auto matchers = type_to_matcher.find(*node_type_info);
-                if (matchers != type_to_matcher.end()) {
-                    // do not run found matchers immediately, need to collect all matchers for
-                    // parents
-                    // and sort them in order of the registration
-                    matcher_passes_to_run.insert(matcher_passes_to_run.end(),
-                                                 matchers->second.begin(),
-                                                 matchers->second.end());
-                }
-                node_type_info = node_type_info->parent;
-            }
-
-            std::sort(matcher_passes_to_run.begin(), matcher_passes_to_run.end());
-
-            // TODO: type_to_matcher with just collected list of matchers to enable
-            // fast processing at the next time when node with the same type will be processed
-
-            for (size_t matcher_index : matcher_passes_to_run) {
-                if (run_matcher_pass(m_matchers[matcher_index], node)) {
-                    rewritten = true;
-                    break;
-                }
-            }
-        }
-        // Otherwise we use default algorithm that iterates over all registered matcher passes
-        else {
-            for (auto& m_pass : m_matchers) {
-                // Skip passes that are disabled
-                if (pass_config->is_disabled(m_pass->get_type_info()))
-                    continue;
-
-                if (run_matcher_pass(m_pass, node)) {
-                    rewritten = true;
-                    break;
-                }
+        for (size_t matcher_index : get_matchers(node->get_type_info())) {
+            if (run_matcher_pass(m_matchers[matcher_index], node)) {
+                rewritten = true;
+                break;
             }
         }
     }
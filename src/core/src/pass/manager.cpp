@@ -156,6 +156,9 @@ public:
      *      export OV_ENABLE_PROFILE_PASS=true
      *      export OV_ENABLE_PROFILE_PASS="/path/to/save/profiling/results"
      *
+     *      The matcher passes run by the graph rewrite passes are reported after the pass with their
+     *      execution time and the number of the successful applications out of the attempts.
+     *
      *  2. OV_ENABLE_VISUALIZE_TRACING - Enables visualization of the model to .svg file after each transformation pass.
      *
      *      Usage: Set this environment variable to "true", "on" or "1" to enable visualization for all Transformations.
@@ -189,9 +192,15 @@ public:
         if (m_profile_pass.is_enabled() && !m_profile_pass.is_bool()) {
             m_file.open(m_profile_pass.get_str(), std::ios_base::app);
         }
+        if (m_profile_pass.is_enabled()) {
+            ov::pass::MatcherCounters::get().enable();
+        }
     }
 
     ~Profiler() {
+        if (m_profile_pass.is_enabled()) {
+            ov::pass::MatcherCounters::get().disable();
+        }
         if (m_file.is_open()) {
             m_file.close();
         }
@@ -227,6 +236,16 @@ public:
                 std::cout << std::setw(60) << std::left << name;
                 std::cout << std::setw(5) << std::right << stopwatch.get_milliseconds() << "ms "
                           << (applied ? "+" : "-") << std::endl;
+                if (!is_pass_manager) {
+                    // the matchers of the pass: the attempts, the hits and the time
+                    for (const auto& matcher : ov::pass::MatcherCounters::get().take()) {
+                        const auto& counters = matcher.second;
+                        std::cout << "    " << std::setw(58) << std::left << matcher.first;
+                        std::cout << std::setw(5) << std::right
+                                  << std::chrono::duration_cast<std::chrono::milliseconds>(counters.time).count()
+                                  << "ms " << counters.hits << "/" << counters.attempts << std::endl;
+                    }
+                }
             } else if (m_file.is_open()) {
                 if (is_pass_manager) {
                     m_file << "m;" << name << ";" << stopwatch.get_timer_value().count() << ";" << (applied ? "1" : "0")
@@ -236,6 +255,11 @@ public:
                 } else {
                     m_file << "t;" << name << ";" << m_manager_name << ";" << stopwatch.get_timer_value().count() << ";"
                            << (applied ? "1" : "0") << std::endl;
+                    for (const auto& matcher : ov::pass::MatcherCounters::get().take()) {
+                        const auto& counters = matcher.second;
+                        m_file << "p;" << matcher.first << ";" << name << ";" << counters.time.count() << ";"
+                               << counters.hits << ";" << counters.attempts << std::endl;
+                    }
                 }
             } else {
                 OPENVINO_THROW("The output file for logging transformation statistics is closed. "
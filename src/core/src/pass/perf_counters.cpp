@@ -12,5 +12,29 @@ openvino::itt::handle_t PerfCounters::operator[](const ov::Node::type_info_t& ty
         return it->second;
     return m_counters[&type_inf] = openvino::itt::handle(type_inf.name);
 }
+
+MatcherCounters& MatcherCounters::get() {
+    thread_local MatcherCounters counters;
+    return counters;
+}
+
+void MatcherCounters::add(const std::string& matcher_name, bool hit, std::chrono::nanoseconds time) {
+    auto it = m_index.find(matcher_name);
+    if (it == m_index.end()) {
+        it = m_index.emplace(matcher_name, m_counters.size()).first;
+        m_counters.emplace_back(matcher_name, Counters{});
+    }
+    auto& counters = m_counters[it->second].second;
+    counters.attempts++;
+    counters.hits += hit ? 1 : 0;
+    counters.time += time;
+}
+
+std::vector<std::pair<std::string, MatcherCounters::Counters>> MatcherCounters::take() {
+    m_index.clear();
+    auto counters = std::move(m_counters);
+    m_counters.clear();
+    return counters;
+}
 }  // namespace pass
 }  // namespace ov
@@ -3,9 +3,13 @@
 //
 #pragma once
 
+#include <chrono>
 #include <itt.hpp>
 #include <mutex>
+#include <string>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "openvino/core/node.hpp"
 
@@ -28,5 +32,47 @@ private:
     std::mutex m_mutex;
     counters_map m_counters;
 };
+
+/// \brief Attempts and hits of the matcher passes applied by GraphRewrite on the current thread.
+/// The counters are collected only while the pass profiling (OV_ENABLE_PROFILE_PASS) is enabled, so the
+/// matchers that are tried on many nodes and never fire can be found.
+class MatcherCounters {
+    MatcherCounters(const MatcherCounters&) = delete;
+    MatcherCounters& operator=(const MatcherCounters&) = delete;
+
+public:
+    struct Counters {
+        size_t attempts = 0;
+        size_t hits = 0;
+        std::chrono::nanoseconds time{0};
+    };
+
+    static MatcherCounters& get();
+
+    bool is_enabled() const {
+        return m_enabled > 0;
+    }
+
+    // the profiled pass managers may be nested
+    void enable() {
+        m_enabled++;
+    }
+
+    void disable() {
+        m_enabled--;
+    }
+
+    void add(const std::string& matcher_name, bool hit, std::chrono::nanoseconds time);
+
+    /// \brief Returns the counters collected since the last call in the order of the first attempt
+    std::vector<std::pair<std::string, Counters>> take();
+
+private:
+    MatcherCounters() = default;
+
+    size_t m_enabled = 0;
+    std::unordered_map<std::string, size_t> m_index;
+    std::vector<std::pair<std::string, Counters>> m_counters;
+};
 }  // namespace pass
 }  // namespace ov
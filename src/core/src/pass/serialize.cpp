@@ -7,7 +7,10 @@
 #include <array>
 #include <cassert>
 #include <cstdint>
+#include <deque>
+#include <filesystem>
 #include <fstream>
+#include <mutex>
 #include <openvino/cc/pass/itt.hpp>
 #include <unordered_map>
 #include <unordered_set>
@@ -17,6 +20,7 @@
 #include "openvino/core/except.hpp"
 #include "openvino/core/meta_data.hpp"
 #include "openvino/core/model.hpp"
+#include "openvino/core/rt_info/weightless_caching_attributes.hpp"
 #include "openvino/core/parallel.hpp"
 #include "openvino/core/type/float16.hpp"
 #include "openvino/op/binary_convolution.hpp"
@@ -39,6 +43,7 @@
 #include "openvino/runtime/string_aligned_buffer.hpp"
 #include "openvino/util/common_util.hpp"
 #include "openvino/util/file_util.hpp"
+#include "openvino/util/xml_parse_utils.hpp"
 #include "pugixml.hpp"
 #include "transformations/hash.hpp"
 #include "transformations/rt_info/disable_fp16_compression.hpp"
@@ -47,12 +52,20 @@
 namespace ov {
 class OstreamHashWrapperBin final : public std::streambuf {
     uint64_t m_res = 0lu;
+    // data pointer -> (data size, key identifying the constant data in the weights file)
+    std::unordered_map<const void*, std::pair<size_t, std::string>> m_weights_keys;
 
 public:
     uint64_t getResult() const {
         return m_res;
     }
     std::streamsize xsputn(const char* s, std::streamsize n) override;
+
+    void set_weights_key(const void* ptr, size_t size, std::string key) {
+        m_weights_keys[ptr] = {size, std::move(key)};
+    }
+    // Returns the data hash, which is computed once per process for the constants read from the same weights file
+    uint64_t compute_hash(const void* ptr, size_t size) const;
 };
 }  // namespace ov
 
@@ -105,7 +118,8 @@ public:
         : m_binary_output(bin_data),
           m_enable_compression(enable_compression),
           m_blob_offset(bin_data.tellp()) {
-        m_write_hash_value = (dynamic_cast<ov::OstreamHashWrapperBin*>(bin_data.rdbuf())) ? true : false;
+        m_hash_wrapper = dynamic_cast<ov::OstreamHashWrapperBin*>(bin_data.rdbuf());
+        m_write_hash_value = m_hash_wrapper != nullptr;
     }
 
     FilePosition write(const char* ptr,
@@ -145,7 +159,9 @@ public:
             // the same hash for {2, 2} and {0, 128} arrays.
             // But even strong hashing algorithms sometimes give collisions.
             // Therefore we always have to compare values when finding a match in the hash multimap.
-            const HashValue hash = ov::runtime::compute_hash(ptr_to_write, new_size);
+            const HashValue hash = (m_write_hash_value && !fp16_buffer)
+                                       ? m_hash_wrapper->compute_hash(ptr_to_write, new_size)
+                                       : ov::runtime::compute_hash(ptr_to_write, new_size);
 
             auto found = m_hash_to_file_positions.equal_range(hash);
             // iterate over all matches of the key in the multimap
@@ -209,6 +225,7 @@ private:
     std::ostream& m_binary_output;
     bool m_enable_compression;
     bool m_write_hash_value = false;
+    ov::OstreamHashWrapperBin* m_hash_wrapper = nullptr;
     FilePosition m_blob_offset;  // blob offset inside output stream
 };
 
@@ -1218,15 +1235,17 @@ void ngfunction_2_ir(pugi::xml_node& netXml,
     pugi::xml_node rt_info_node = netXml.append_child("rt_info");
     for (const auto& it : model.get_rt_info()) {
         // Skip IR version
-        if (it.first == "version" || it.first == "__weights_path")
+        if (it.first == "version" || it.first == "__weights_path" || it.first == "__weights_fingerprint")
             continue;
         serialize_rt_info(rt_info_node, it.first, it.second);
     }
 }
 
 const std::filesystem::path valid_xml_path(const std::filesystem::path& path) {
-    OPENVINO_ASSERT(path.extension() == ".xml",
-                    "Path for xml file doesn't contains file name with 'xml' extension: \"",
+    OPENVINO_ASSERT(path.extension() == ".xml" || path.extension() == ov::util::pugixml::binary_document_extension,
+                    "Path for xml file doesn't contains file name with 'xml' or '",
+                    ov::util::pugixml::binary_document_extension,
+                    "' extension: \"",
                     path,
                     "\"");
     return path;
@@ -1246,7 +1265,8 @@ void serializeFunc(std::ostream& xml_file,
                    std::ostream& bin_file,
                    std::shared_ptr<ov::Model> model,
                    ov::pass::Serialize::Version ver,
-                   bool deterministic = false) {
+                   bool deterministic = false,
+                   bool binary_topology = false) {
     auto version = static_cast<int64_t>(ver);
 
     auto& rt_info = model->get_rt_info();
@@ -1271,7 +1291,11 @@ void serializeFunc(std::ostream& xml_file,
     XmlSerializer visitor(net_node, name, constant_write_handler, version, deterministic);
     visitor.on_attribute(name, model);
 
-    xml_doc.save(xml_file);
+    if (binary_topology) {
+        ov::util::pugixml::save_binary_document(xml_doc, xml_file);
+    } else {
+        xml_doc.save(xml_file);
+    }
     xml_file.flush();
     bin_file.flush();
 };
@@ -1299,12 +1323,13 @@ bool pass::Serialize::run_on_model(const std::shared_ptr<ov::Model>& model) {
         std::ofstream bin_file(m_binPath, std::ios::binary);
         OPENVINO_ASSERT(bin_file, "Can't open bin file: \"", m_binPath, "\"");
 
-        // create xml file
-        std::ofstream xml_file(m_xmlPath);
+        // create xml file, the topology is written in the binary format for the corresponding extension
+        const bool binary_topology = m_xmlPath.extension() == ov::util::pugixml::binary_document_extension;
+        std::ofstream xml_file(m_xmlPath, binary_topology ? std::ios::binary : std::ios::out);
         OPENVINO_ASSERT(xml_file, "Can't open xml file: \"", m_xmlPath, "\"");
 
         try {
-            serializeFunc(xml_file, bin_file, model, m_version);
+            serializeFunc(xml_file, bin_file, model, m_version, false, binary_topology);
         } catch (const ov::AssertFailure&) {
             // optimization decision was made to create .bin file upfront and
             // write to it directly instead of buffering its content in memory,
@@ -1463,15 +1488,128 @@ public:
 };
 }  // namespace
 
+namespace {
+// Hashes of the constants data read from the weights files. The key includes the version of the file (see
+// ov::util::get_file_fingerprint), so a rewritten weights file does not reuse the stale values. The oldest hashes are
+// evicted once the capacity is reached.
+class WeightsHashCache {
+public:
+    static WeightsHashCache& get() {
+        static WeightsHashCache cache;
+        return cache;
+    }
+
+    bool find(const std::string& key, uint64_t& hash) const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_hashes.find(key);
+        if (it == m_hashes.end()) {
+            return false;
+        }
+        hash = it->second;
+        return true;
+    }
+
+    void insert(const std::string& key, uint64_t hash) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_hashes.emplace(key, hash).second) {
+            return;
+        }
+        m_order.push_back(key);
+        if (m_order.size() > capacity) {
+            m_hashes.erase(m_order.front());
+            m_order.pop_front();
+        }
+    }
+
+private:
+    static constexpr size_t capacity = 65536;
+
+    mutable std::mutex m_mutex;
+    std::unordered_map<std::string, uint64_t> m_hashes;
+    std::deque<std::string> m_order;
+};
+
+std::string get_weights_file_key(const ov::Model& model) {
+    const auto& rt_info = model.get_rt_info();
+    auto it = rt_info.find("__weights_path");
+    if (it == rt_info.end() || !it->second.is<std::string>()) {
+        return {};
+    }
+    const auto& path = it->second.as<std::string>();
+    // the file version taken when the weights were read, the weights of a file changed since then are not memoized
+    auto fingerprint_it = rt_info.find("__weights_fingerprint");
+    if (fingerprint_it == rt_info.end() || !fingerprint_it->second.is<std::string>()) {
+        return {};
+    }
+    const auto& fingerprint = fingerprint_it->second.as<std::string>();
+    if (fingerprint.empty() || fingerprint != ov::util::get_file_fingerprint(path)) {
+        return {};
+    }
+    return path + ":" + fingerprint;
+}
+
+// Only the constants kept intact since the model reading have the weightless cache attribute (it is not copyable)
+void collect_weights_keys(const ov::Model& model, ov::OstreamHashWrapperBin& bin_hash) {
+    const auto file_key = get_weights_file_key(model);
+    if (file_key.empty()) {
+        return;
+    }
+    for (const auto& node : model.get_ops()) {
+        const auto constant = ov::as_type_ptr<ov::op::v0::Constant>(node);
+        if (!constant) {
+            continue;
+        }
+        const auto& rt_info = constant->get_rt_info();
+        auto it = rt_info.find(ov::WeightlessCacheAttribute::get_type_info_static());
+        if (it == rt_info.end()) {
+            continue;
+        }
+        const auto& attr = it->second.as<ov::WeightlessCacheAttribute>();
+        const auto size = constant->get_byte_size();
+        if (attr.original_size != size || attr.original_dtype != constant->get_element_type()) {
+            continue;
+        }
+        bin_hash.set_weights_key(constant->get_data_ptr(),
+                                 size,
+                                 file_key + ":" + std::to_string(attr.bin_offset) + ":" + std::to_string(size));
+    }
+}
+}  // namespace
+
 std::streamsize OstreamHashWrapperBin::xsputn(const char* s, std::streamsize n) {
     m_res = hash_combine(m_res, *reinterpret_cast<const uint64_t*>(s));
     return n;
 }
 
+uint64_t OstreamHashWrapperBin::compute_hash(const void* ptr, size_t size) const {
+    auto it = m_weights_keys.find(ptr);
+    if (it == m_weights_keys.end() || it->second.first != size) {
+        return ov::runtime::compute_hash(ptr, size);
+    }
+    // The data edges are hashed on every call to detect the data which doesn't match the weights file anymore
+    // (e.g. the file was rewritten after the model reading)
+    constexpr size_t edge_size = 4096;
+    const auto data = static_cast<const char*>(ptr);
+    const auto edges_hash =
+        size <= 2 * edge_size ? ov::runtime::compute_hash(data, size)
+                              : hash_combine(ov::runtime::compute_hash(data, edge_size),
+                                             ov::runtime::compute_hash(data + size - edge_size, edge_size));
+    const auto key = it->second.second + ":" + std::to_string(edges_hash);
+
+    auto& cache = WeightsHashCache::get();
+    uint64_t hash = 0;
+    if (!cache.find(key, hash)) {
+        hash = ov::runtime::compute_hash(ptr, size);
+        cache.insert(key, hash);
+    }
+    return hash;
+}
+
 bool pass::Hash::run_on_model(const std::shared_ptr<ov::Model>& model) {
     RUN_ON_MODEL_SCOPE(Hash);
     OstreamHashWrapper xmlHash;
     OstreamHashWrapperBin binHash;
+    collect_weights_keys(*model, binHash);
     std::ostream xml(&xmlHash);
     std::ostream bin(&binHash);
 
@@ -16,6 +16,8 @@
 #include "openvino/pass/backward_graph_rewrite.hpp"
 #include "openvino/pass/manager.hpp"
 #include "openvino/pass/pattern/op/label.hpp"
+#include "openvino/pass/pattern/op/or.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
 
 using namespace ::testing;
 using namespace std;
@@ -269,6 +271,62 @@ TEST(GraphRewriteTest, TypeBasedMatcherPassOrder2) {
     ASSERT_EQ(count_ops_of_type<op::v0::Tanh>(f), 1);
 }
 
+class AnyOfTestPass : public ov::pass::MatcherPass {
+public:
+    OPENVINO_MATCHER_PASS_RTTI("AnyOfTestPass");
+    AnyOfTestPass() : MatcherPass() {
+        auto divide = pattern::wrap_type<op::v1::Divide>();
+        auto tanh = pattern::wrap_type<op::v0::Tanh>();
+        auto root = std::make_shared<pattern::op::Or>(OutputVector{divide, tanh});
+        ov::graph_rewrite_callback callback = [](pattern::Matcher& m) {
+            auto tanh = std::make_shared<ov::op::v0::Tanh>(m.get_match_root()->input_value(0));
+            ov::replace_node(m.get_match_root(), tanh);
+            return true;
+        };
+
+        auto m = std::make_shared<ov::pass::pattern::Matcher>(root, "AnyOfTestMatcher");
+        this->register_matcher(m, callback);
+    }
+};
+
+TEST(GraphRewriteTest, AnyOfMatcherPassOrder) {
+    {
+        auto f = get_model();
+
+        Anchor anchor;
+        anchor.add_matcher<AnyOfTestPass>();
+        anchor.add_matcher<TestPass>()->set_callback(get_callback());
+        anchor.run_on_model(f);
+
+        ASSERT_EQ(count_ops_of_type<op::v0::Tanh>(f), 1);
+        ASSERT_EQ(count_ops_of_type<op::v0::Relu>(f), 0);
+    }
+    {
+        // the matcher with the untyped root keeps its place among the indexed ones
+        auto f = get_model();
+
+        Anchor anchor;
+        anchor.add_matcher<TestPass>()->set_callback(get_callback());
+        anchor.add_matcher<AnyOfTestPass>();
+        anchor.run_on_model(f);
+
+        ASSERT_EQ(count_ops_of_type<op::v0::Tanh>(f), 0);
+        ASSERT_EQ(count_ops_of_type<op::v0::Relu>(f), 1);
+    }
+}
+
+TEST(GraphRewriteOrderTest, MatcherPassWithIndexedMatchers) {
+    auto f = get_model();
+
+    NodeVector order;
+    Anchor anchor;
+    anchor.add_matcher<TypeBasedTestPassDerived>();
+    anchor.add_matcher<GatherNodesPass>(order);
+    anchor.run_on_model(f);
+
+    ASSERT_EQ(order, f->get_ordered_ops());
+}
+
 TEST(PassConfigTest, Test1) {
     {
         auto f = get_model();
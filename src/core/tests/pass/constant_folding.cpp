@@ -3949,6 +3949,51 @@ TEST(constant_folding, sq_diff) {
     ASSERT_NE(res_node, nullptr);
 }
 
+TEST(constant_folding, decompression_chain_by_tiles) {
+    // 2 MB of the decompressed weights, the intermediate results are of the same size
+    const Shape shape{512, 1024};
+    std::vector<uint8_t> weights(shape_size(shape));
+    for (size_t i = 0; i < weights.size(); i++) {
+        weights[i] = static_cast<uint8_t>(i % 251);
+    }
+    std::vector<float> scales(shape[0]);
+    for (size_t i = 0; i < scales.size(); i++) {
+        scales[i] = 0.5f + static_cast<float>(i % 7);
+    }
+    auto make_model = [&]() {
+        auto data = std::make_shared<ov::op::v0::Constant>(element::u8, shape, weights);
+        auto convert = std::make_shared<ov::op::v0::Convert>(data, element::f32);
+        auto zero_point = std::make_shared<ov::op::v0::Constant>(element::f32, Shape{}, std::vector<float>{8});
+        auto subtract = std::make_shared<ov::op::v1::Subtract>(convert, zero_point);
+        auto scale = std::make_shared<ov::op::v0::Constant>(element::f32, Shape{shape[0], 1}, scales);
+        auto multiply = std::make_shared<ov::op::v1::Multiply>(subtract, scale);
+        multiply->set_friendly_name("test");
+        auto res = std::make_shared<ov::op::v0::Result>(multiply);
+        return std::make_shared<ov::Model>(ov::ResultVector{res}, ov::ParameterVector{});
+    };
+
+    auto model = make_model();
+    pass::ConstantFolding folding;
+    folding.run_on_model(model);
+
+    auto tiled_model = make_model();
+    // 4 KB tiles, i.e. a single row of the output
+    pass::TiledConstantFolding tiled_folding(4096);
+    tiled_folding.run_on_model(tiled_model);
+
+    auto expected = get_result_constant(model);
+    auto result = get_result_constant(tiled_model);
+    ASSERT_TRUE(expected);
+    ASSERT_TRUE(result);
+    ASSERT_EQ(result->get_friendly_name(), "test");
+    ASSERT_EQ(result->get_shape(), shape);
+    ASSERT_EQ(result->cast_vector<float>(), expected->cast_vector<float>());
+    ASSERT_EQ(tiled_model->get_ordered_ops().size(), 2);
+
+    // only the final constant is materialized in full
+    EXPECT_EQ(tiled_folding.get_peak_memory_usage(), shape_size(shape) * sizeof(float));
+}
+
 class UnsupportedTypesTest : public testing::TestWithParam<element::Type> {};
 
 TEST_P(UnsupportedTypesTest, add_multiply) {
@@ -6,8 +6,10 @@
 
 #include <gtest/gtest.h>
 
+#include <cstring>
 #include <fstream>
 #include <iterator>
+#include <sstream>
 
 #include "common_test_utils/file_utils.hpp"
 #include "common_test_utils/graph_comparator.hpp"
@@ -18,6 +20,7 @@
 #include "openvino/runtime/core.hpp"
 #include "openvino/runtime/tensor.hpp"
 #include "openvino/util/file_util.hpp"
+#include "openvino/util/xml_parse_utils.hpp"
 #include "read_ir.hpp"
 
 namespace ov::test {
@@ -93,6 +96,58 @@ TEST_P(SerializePassTestP, serialize_simple_model_with_constant) {
     const auto& [is_valid, error_msg] = model_comparator().compare(serialized_model, m_model);
     EXPECT_TRUE(is_valid) << error_msg;
 }
+
+TEST_F(SerializePassTest, serialize_binary_topology) {
+    const auto p1 = std::make_shared<Parameter>(element::f32, PartialShape{-1, 5});
+    const auto c1 = std::make_shared<Constant>(element::f32, Shape{5}, std::vector{1, 0, 1, 1, 1});
+    const auto add = std::make_shared<Add>(p1, c1);
+    add->set_friendly_name("add & <escaped>");
+    m_model = std::make_shared<Model>(OutputVector{add}, ParameterVector{p1}, "simple_model");
+    m_out_xml_path.replace_extension(".bxml");
+
+    OV_ASSERT_NO_THROW(pass::Serialize(m_out_xml_path, m_out_bin_path).run_on_model(m_model));
+
+    std::ifstream topology(m_out_xml_path, std::ios::binary);
+    const std::string content{std::istreambuf_iterator<char>(topology), std::istreambuf_iterator<char>()};
+    EXPECT_TRUE(ov::util::pugixml::is_binary_document(content.data(), content.size()));
+    // the version is read from the tables, the same way the frontend detects the IR
+    EXPECT_EQ(ov::util::pugixml::get_binary_document_root_attr(content.data(), content.size(), "net", "version"), "11");
+    topology.clear();
+    topology.seekg(0);
+    EXPECT_EQ(ov::util::pugixml::get_binary_document_root_attr(topology, "net", "version"), "11");
+
+    const auto serialized_model = test::readModel(m_out_xml_path.string(), m_out_bin_path.string());
+    const auto& [is_valid, error_msg] = model_comparator().compare(serialized_model, m_model);
+    EXPECT_TRUE(is_valid) << error_msg;
+    // the weights are found next to the topology
+    EXPECT_NO_THROW(test::readModel(m_out_xml_path.string(), ""));
+}
+
+TEST(BinaryDocumentTest, load_rejects_shared_children) {
+    pugi::xml_document doc;
+    auto root = doc.append_child("root");
+    auto first = root.append_child("first");
+    root.append_child("second");
+    first.append_child("leaf");
+
+    std::stringstream stream;
+    ov::util::pugixml::save_binary_document(doc, stream);
+    auto content = stream.str();
+    pugi::xml_document restored;
+    OV_ASSERT_NO_THROW(ov::util::pugixml::load_binary_document(restored, content.data(), content.size()));
+    EXPECT_EQ(restored.child("root").child("first").child("leaf").type(), pugi::node_element);
+
+    // the elements are stored breadth-first after the header: root, first, second, leaf
+    // (each element is name, text, first_attribute, attribute_count, first_child, child_count)
+    constexpr size_t header_size = 32;
+    constexpr size_t element_size = 6 * sizeof(uint32_t);
+    constexpr size_t first_child_field = 4 * sizeof(uint32_t);
+    // "first" claims the children range of the root as well, so "second" gets two parents
+    const uint32_t children[] = {2, 2};
+    std::memcpy(&content[header_size + element_size + first_child_field], children, sizeof(children));
+    EXPECT_THROW(ov::util::pugixml::load_binary_document(restored, content.data(), content.size()),
+                 std::runtime_error);
+}
 }  // namespace ov::test
 
 using SerializationParams = std::tuple<std::string, std::string>;
@@ -140,6 +140,7 @@ private:
         // Map between file extension and suitable frontend
         static const std::map<std::string, FrontEndNames> priority_fe_extensions = {
             {".xml", {"ir", "ir"}},
+            {".bxml", {"ir", "ir"}},
             {".onnx", {"onnx", "onnx"}},
             {".pb", {"tf", "tensorflow"}},
             {".pbtxt", {"tf", "tensorflow"}},
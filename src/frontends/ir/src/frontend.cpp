@@ -5,6 +5,7 @@
 #include "openvino/frontend/ir/frontend.hpp"
 
 #include <array>
+#include <cstdlib>
 #include <pugixml.hpp>
 #include <vector>
 
@@ -37,6 +38,13 @@ size_t get_ir_version(const pugi::xml_document& doc) {
     return 0;
 }
 
+// the version attribute of the binary IR root, 0 if it is missing or not a number
+size_t get_ir_version(const std::string& version) {
+    char* end = nullptr;
+    const auto value = std::strtoull(version.c_str(), &end, 10);
+    return version.empty() || *end != '\0' ? 0 : static_cast<size_t>(value);
+}
+
 constexpr size_t HEADER_SIZE_LIM = 512lu;
 
 /**
@@ -45,6 +53,10 @@ constexpr size_t HEADER_SIZE_LIM = 512lu;
  * @return IR version, 0 if model does represent IR
  */
 size_t get_ir_version(const char* model, size_t model_size) {
+    if (ov::util::pugixml::is_binary_document(model, model_size)) {
+        return get_ir_version(ov::util::pugixml::get_binary_document_root_attr(model, model_size, "net", "version"));
+    }
+
     // IR version is a value of root tag attribuite thought not need to parse the whole stream.
 
     size_t header_size = model_size > HEADER_SIZE_LIM ? HEADER_SIZE_LIM : model_size;
@@ -75,9 +87,17 @@ size_t get_ir_version(std::istream& model) {
 
     model.seekg(0, model.beg);
     model.read(header, HEADER_SIZE_LIM);
+    const auto header_size = static_cast<size_t>(model.gcount());
     model.clear();
     model.seekg(0, model.beg);
 
+    if (ov::util::pugixml::is_binary_document(header, header_size)) {
+        const auto version = ov::util::pugixml::get_binary_document_root_attr(model, "net", "version");
+        model.clear();
+        model.seekg(0, model.beg);
+        return get_ir_version(version);
+    }
+
     auto ir_version = get_ir_version(header, HEADER_SIZE_LIM);
     if (ir_version == 0lu) {
         pugi::xml_document doc;
@@ -239,6 +259,22 @@ InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const
     }
     bool enable_mmap = variants[variants.size() - 1].is<bool>() ? variants[variants.size() - 1].as<bool>() : false;
 
+    // the binary topology is mapped as is, there is nothing to parse
+    if (local_model_stream.is_open()) {
+        char magic[sizeof(uint64_t) * 4] = {};
+        local_model_stream.read(magic, sizeof(magic));
+        const auto magic_size = static_cast<size_t>(local_model_stream.gcount());
+        local_model_stream.clear();
+        local_model_stream.seekg(0, local_model_stream.beg);
+        if (ov::util::pugixml::is_binary_document(magic, magic_size)) {
+            local_model_stream.close();
+            auto mapped_memory = ov::load_mmap_object(model_path);
+            model_buf = std::make_shared<ov::SharedBuffer<std::shared_ptr<MappedMemory>>>(mapped_memory->data(),
+                                                                                        mapped_memory->size(),
+                                                                                        mapped_memory);
+        }
+    }
+
     // Find weights if only path to xml was provided
     if (weights_path.empty()) {
         auto pos = model_path.rfind('.');
@@ -254,7 +290,9 @@ InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const
             weights_path.clear();
         }
     }
+    std::string weights_fingerprint;
     if (!weights_path.empty()) {
+        weights_fingerprint = ov::util::get_file_fingerprint(ov::util::path_to_string(weights_path));
         if (enable_mmap) {
             auto mapped_memory = ov::load_mmap_object(weights_path);
             weights = std::make_shared<ov::SharedBuffer<std::shared_ptr<MappedMemory>>>(mapped_memory->data(),
@@ -285,7 +323,13 @@ InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const
         }
     }
 
-    return create_input_model(ov::util::path_to_string(weights_path));
+    auto input_model = create_input_model(ov::util::path_to_string(weights_path));
+    // the weights which might have been changed while being read are not identified by the file version
+    if (input_model && !weights_fingerprint.empty() &&
+        weights_fingerprint == ov::util::get_file_fingerprint(ov::util::path_to_string(weights_path))) {
+        input_model->set_weights_fingerprint(std::move(weights_fingerprint));
+    }
+    return input_model;
 }
 
 std::shared_ptr<ov::Model> FrontEnd::convert(const InputModel::Ptr& model) const {
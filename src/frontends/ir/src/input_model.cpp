@@ -4,7 +4,9 @@
 
 #include "input_model.hpp"
 
+#include <iterator>
 #include <pugixml.hpp>
+#include <string>
 
 #include "ir_deserializer.hpp"
 #include "openvino/core/except.hpp"
@@ -206,6 +208,7 @@ class InputModel::InputModelIRImpl {
     pugi::xml_node m_root;
     pugi::xml_document m_xml_doc;
     std::string m_weights_path;
+    std::string m_weights_fingerprint;
 
 public:
     InputModelIRImpl(std::istream& model,
@@ -215,8 +218,18 @@ public:
         : m_weights(weights),
           m_extensions(extensions),
           m_weights_path(std::move(weights_path)) {
-        pugi::xml_parse_result res = m_xml_doc.load(model);
-        OPENVINO_ASSERT(res.status == pugi::status_ok, res.description(), " at offset ", res.offset);
+        char magic[sizeof(uint64_t) * 4] = {};
+        model.read(magic, sizeof(magic));
+        const auto magic_size = static_cast<size_t>(model.gcount());
+        model.clear();
+        model.seekg(0, model.beg);
+        if (ov::util::pugixml::is_binary_document(magic, magic_size)) {
+            const std::string content{std::istreambuf_iterator<char>(model), std::istreambuf_iterator<char>()};
+            ov::util::pugixml::load_binary_document(m_xml_doc, content.data(), content.size());
+        } else {
+            pugi::xml_parse_result res = m_xml_doc.load(model);
+            OPENVINO_ASSERT(res.status == pugi::status_ok, res.description(), " at offset ", res.offset);
+        }
         init_opset();
     }
 
@@ -227,11 +240,20 @@ public:
         : m_weights(weights),
           m_extensions(extensions),
           m_weights_path(std::move(weights_path)) {
-        auto res = m_xml_doc.load_buffer(model->get_ptr(), model->size(), pugi::parse_default, pugi::encoding_utf8);
-        OPENVINO_ASSERT(res.status == pugi::status_ok, res.description(), " at offset ", res.offset);
+        if (ov::util::pugixml::is_binary_document(model->get_ptr<char>(), model->size())) {
+            ov::util::pugixml::load_binary_document(m_xml_doc, model->get_ptr<char>(), model->size());
+        } else {
+            auto res =
+                m_xml_doc.load_buffer(model->get_ptr(), model->size(), pugi::parse_default, pugi::encoding_utf8);
+            OPENVINO_ASSERT(res.status == pugi::status_ok, res.description(), " at offset ", res.offset);
+        }
         init_opset();
     }
 
+    void set_weights_fingerprint(std::string fingerprint) {
+        m_weights_fingerprint = std::move(fingerprint);
+    }
+
     std::shared_ptr<ov::Model> convert();
 
 private:
@@ -257,6 +279,10 @@ InputModel::InputModel(const std::shared_ptr<ov::AlignedBuffer>& model,
     _impl = std::make_shared<InputModelIRImpl>(model, weights, extensions, std::move(weights_path));
 }
 
+void InputModel::set_weights_fingerprint(std::string fingerprint) {
+    _impl->set_weights_fingerprint(std::move(fingerprint));
+}
+
 std::shared_ptr<ov::Model> InputModel::convert() {
     return _impl->convert();
 }
@@ -272,6 +298,8 @@ std::shared_ptr<ov::Model> InputModel::InputModelIRImpl::convert() {
     model->get_rt_info()["version"] = int64_t(version);
     if (!m_weights_path.empty())
         model->get_rt_info()["__weights_path"] = m_weights_path;
+    if (!m_weights_fingerprint.empty())
+        model->get_rt_info()["__weights_fingerprint"] = m_weights_fingerprint;
     parse_pre_process(m_root, m_weights, model);
 
     return model;
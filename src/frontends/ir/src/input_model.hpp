@@ -6,6 +6,7 @@
 
 #include <istream>
 #include <memory>
+#include <string>
 
 #include "openvino/frontend/manager.hpp"
 #include "openvino/frontend/visibility.hpp"
@@ -30,6 +31,9 @@ public:
                const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions,
                std::string weights_path = {});
 
+    // the version of the weights file the weights were read from (see ov::util::get_file_fingerprint)
+    void set_weights_fingerprint(std::string fingerprint);
+
     std::shared_ptr<Model> convert();
 };
 
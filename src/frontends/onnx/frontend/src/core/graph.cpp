@@ -4,6 +4,7 @@
 
 #include "core/graph.hpp"
 
+#include <algorithm>
 #include <exception>
 #include <functional>
 #include <numeric>
@@ -11,12 +12,14 @@
 
 #include "core/node.hpp"
 #include "core/null_node.hpp"
+#include "core/tensor.hpp"
 #include "core/transform.hpp"
 #include "core/value_info.hpp"
 #include "exceptions.hpp"
 #include "onnx_framework_node.hpp"
 #include "openvino/core/descriptor_tensor.hpp"
 #include "openvino/core/node.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/frontend/exception.hpp"
 #include "openvino/frontend/onnx/extension/conversion.hpp"
 #include "openvino/frontend/onnx/node_context.hpp"
@@ -99,6 +102,45 @@ Model::ModelOpSet build_model_opset(const ModelProto& model_proto, const Operato
     return opset;
 }
 
+/// The initializers of the bigger graphs are decoded concurrently.
+constexpr size_t parallel_decoding_threshold = 16 * 1024 * 1024;
+
+/// The subgraphs of a node are converted concurrently if they have at least this number of nodes in total.
+constexpr size_t parallel_conversion_threshold = 64;
+
+/// Returns the number of bytes to be decoded for the initializer.
+size_t get_decoded_size(const TensorProto& tensor) {
+    if (tensor.has_raw_data()) {
+        return tensor.raw_data().size();
+    }
+    if (tensor.has_data_location() &&
+        tensor.data_location() == TensorProto_DataLocation::TensorProto_DataLocation_EXTERNAL) {
+        return TensorExternalData(tensor).size();
+    }
+    return sizeof(float) * tensor.float_data_size() + sizeof(int32_t) * tensor.int32_data_size() +
+           sizeof(int64_t) * tensor.int64_data_size() + sizeof(uint64_t) * tensor.uint64_data_size() +
+           sizeof(double) * tensor.double_data_size();
+}
+
+/// Runs the tasks on the threads of the OpenVINO threading backend, the first error of the tasks is rethrown.
+void run_in_parallel(size_t tasks_count, const std::function<void(size_t)>& task) {
+    std::vector<std::exception_ptr> errors(tasks_count);
+    ov::parallel_for(tasks_count, [&](size_t idx) {
+        try {
+            task(idx);
+        } catch (...) {
+            errors[idx] = std::current_exception();
+        }
+    });
+
+    // the error is reported the same way as in the sequential run
+    for (const auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
 /// Copies only the extensions required by the Subgraph class.
 /// The source is an extension holder retrieved from the parent graph object.
 ov::frontend::ExtensionHolder subgraph_required_extensions(
@@ -132,25 +174,45 @@ Graph::Graph(const std::string& model_dir,
 
     std::map<std::string, Tensor> initializers;
 
-    // Process all initializers in the graph
+    std::vector<const TensorProto*> initializer_tensors;
+    size_t initializers_size = 0;
     for (const auto& initializer_tensor : m_model->get_graph().initializer()) {
         if (initializer_tensor.has_name()) {
-            Tensor tensor = Tensor{initializer_tensor, m_model_dir, m_mmap_cache};
-            std::shared_ptr<ov::op::v0::Constant> ov_constant;
-            // For each initializer create a Constant node and store it in cache
-            try {
-                ov_constant = tensor.get_ov_constant();
-            } catch (const error::invalid_external_data&) {
-                // invalid external data makes initializers creation impossible
-                throw;
-            } catch (const ov::Exception&) {
-                ov_constant = ov::frontend::onnx::common::make_failsafe_constant(tensor.get_ov_type());
-            }
+            initializer_tensors.push_back(&initializer_tensor);
+            initializers_size += detail::get_decoded_size(initializer_tensor);
+        }
+    }
 
-            initializers.emplace(initializer_tensor.name(), tensor);
-            ov_constant->get_output_tensor(0).set_names({initializer_tensor.name()});
-            m_cache->emplace_node(initializer_tensor.name(), std::move(ov_constant));
+    // With mmap enabled the model is kept alive by the constants, so they refer to its inline raw data
+    const auto data_owner = m_mmap_cache ? std::shared_ptr<const ModelProto>(model_proto) : nullptr;
+    std::vector<std::shared_ptr<ov::op::v0::Constant>> constants(initializer_tensors.size());
+    const auto decode_initializer = [&](size_t idx) {
+        const Tensor tensor{*initializer_tensors[idx], m_model_dir, m_mmap_cache, data_owner};
+        // For each initializer create a Constant node
+        try {
+            constants[idx] = tensor.get_ov_constant();
+        } catch (const error::invalid_external_data&) {
+            // invalid external data makes initializers creation impossible
+            throw;
+        } catch (const ov::Exception&) {
+            constants[idx] = ov::frontend::onnx::common::make_failsafe_constant(tensor.get_ov_type());
         }
+    };
+    if (initializers_size >= detail::parallel_decoding_threshold) {
+        detail::run_in_parallel(initializer_tensors.size(), decode_initializer);
+    } else {
+        for (size_t idx = 0; idx < initializer_tensors.size(); ++idx) {
+            decode_initializer(idx);
+        }
+    }
+
+    // Store the initializers in cache in the order of the model
+    for (size_t idx = 0; idx < initializer_tensors.size(); ++idx) {
+        const auto& initializer_tensor = *initializer_tensors[idx];
+        auto& ov_constant = constants[idx];
+        initializers.emplace(initializer_tensor.name(), Tensor{initializer_tensor, m_model_dir, m_mmap_cache});
+        ov_constant->get_output_tensor(0).set_names({initializer_tensor.name()});
+        m_cache->emplace_node(initializer_tensor.name(), std::move(ov_constant));
     }
 
     // Process all ONNX graph inputs, convert them to OV nodes and store in cache
@@ -186,9 +248,23 @@ void Graph::convert_to_ov_nodes() {
         }
         if (node.has_subgraphs()) {
             const auto& subgraphs = node.get_subgraphs();
+            std::vector<std::shared_ptr<Subgraph>> subgraphs_to_convert;
+            size_t subgraphs_nodes = 0;
             for (auto& kv : subgraphs) {
-                auto& subgraph = kv.second;
-                subgraph->convert();
+                subgraphs_to_convert.push_back(kv.second);
+                subgraphs_nodes += kv.second->get_nodes_count();
+            }
+            const auto convert_subgraph = [&subgraphs_to_convert](size_t idx) {
+                subgraphs_to_convert[idx]->convert();
+            };
+            // The user conversion extensions and telemetry may be not thread safe
+            if (subgraphs_to_convert.size() > 1 && subgraphs_nodes >= detail::parallel_conversion_threshold &&
+                m_extensions.conversions.empty() && !m_extensions.telemetry) {
+                detail::run_in_parallel(subgraphs_to_convert.size(), convert_subgraph);
+            } else {
+                for (size_t idx = 0; idx < subgraphs_to_convert.size(); ++idx) {
+                    convert_subgraph(idx);
+                }
             }
         }
         ov::OutputVector ov_nodes{make_ov_nodes(node)};
@@ -462,6 +538,7 @@ Subgraph::Subgraph(const std::shared_ptr<ModelProto>& model_proto, Graph* parent
       m_parent_graph(parent_graph) {}
 
 bool Subgraph::is_ov_node_in_cache(const std::string& name) const {
+    std::lock_guard<std::mutex> lock(*m_cache_mutex);
     if (m_cache->contains(name)) {
         return true;
     }
@@ -469,6 +546,8 @@ bool Subgraph::is_ov_node_in_cache(const std::string& name) const {
 }
 
 Output<ov::Node> Subgraph::get_ov_node_from_cache(const std::string& name) {
+    // the sibling subgraphs may be converted concurrently
+    std::lock_guard<std::mutex> lock(*m_cache_mutex);
     if (m_cache->contains(name)) {
         return m_cache->get_node(name);
     }
@@ -7,6 +7,7 @@
 #include <onnx/onnx_pb.h>
 
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -40,6 +41,9 @@ public:
     const std::string& get_name() const {
         return m_model->get_graph().name();
     }
+    size_t get_nodes_count() const {
+        return static_cast<size_t>(m_model->get_graph().node_size());
+    }
     const std::string& model_dir() const {
         return m_model_dir;
     }
@@ -125,6 +129,7 @@ private:
     Graph* m_parent_graph;
     std::vector<std::string> m_inputs_from_parent;
     std::unordered_map<std::shared_ptr<ov::op::v0::Parameter>, std::string> m_parameter_to_parent_node_map;
+    std::unique_ptr<std::mutex> m_cache_mutex = std::make_unique<std::mutex>();
 };
 
 inline std::ostream& operator<<(std::ostream& outs, const Graph& graph) {
@@ -266,6 +266,19 @@ std::vector<std::string> Tensor::get_data() const {
     ONNX_INVALID_DATA_TYPE(m_tensor_proto->data_type(), "STRING");
 }
 
+bool Tensor::is_raw_data_shareable() const {
+    if (!m_model_proto || !m_tensor_proto->has_raw_data()) {
+        return false;
+    }
+    const auto ov_type = get_ov_type();
+    if (ov_type == ov::element::string) {
+        return false;
+    }
+    // the raw data has the same layout as the constant, but may be misaligned for the element type
+    const auto alignment = std::max<size_t>(ov_type.size(), 1);
+    return reinterpret_cast<uintptr_t>(m_tensor_proto->raw_data().data()) % alignment == 0;
+}
+
 std::shared_ptr<ov::op::v0::Constant> Tensor::get_ov_constant() const {
     if (m_tensor_proto->has_segment()) {
         FRONT_END_THROW("Loading segments isn't supported");
@@ -302,6 +315,15 @@ std::shared_ptr<ov::op::v0::Constant> Tensor::get_ov_constant() const {
                 "The size of the external data file does not match the byte size of an initializer '" + get_name() +
                 "' in the model");
         }
+    } else if (element_count == shape_size(m_shape) && is_raw_data_shareable()) {
+        // the model outlives the constant, so the inline data is not copied
+        const auto& raw_data = m_tensor_proto->raw_data();
+        constant = std::make_shared<ov::op::v0::Constant>(
+            ov_type,
+            m_shape,
+            std::make_shared<ov::SharedBuffer<std::shared_ptr<const ModelProto>>>(const_cast<char*>(raw_data.data()),
+                                                                                  raw_data.size(),
+                                                                                  m_model_proto));
     } else if (element_count == shape_size(m_shape)) {
         switch (m_tensor_proto->data_type()) {
         case TensorProto_DataType::TensorProto_DataType_FLOAT:
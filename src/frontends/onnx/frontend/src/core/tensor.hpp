@@ -7,6 +7,7 @@
 #include <onnx/onnx_pb.h>
 
 #include <algorithm>
+#include <memory>
 #include <utility>
 #include <vector>
 
@@ -26,6 +27,7 @@ namespace ov {
 namespace frontend {
 namespace onnx {
 
+using ::ONNX_NAMESPACE::ModelProto;
 using ::ONNX_NAMESPACE::TensorProto;
 using ::ONNX_NAMESPACE::TensorProto_DataLocation;
 using ::ONNX_NAMESPACE::TensorProto_DataType;
@@ -87,11 +89,19 @@ public:
     };
 
     Tensor() = delete;
-    Tensor(const TensorProto& tensor, const std::string& model_dir, detail::MappedMemoryHandles mmap_cache)
+    /// \brief      Creates the tensor from the ONNX tensor proto.
+    ///
+    /// \param[in]  model_proto  The model owning the tensor proto. If set, the constant created from the
+    ///                          inline raw data refers to the data in the model instead of copying it.
+    Tensor(const TensorProto& tensor,
+           const std::string& model_dir,
+           detail::MappedMemoryHandles mmap_cache,
+           std::shared_ptr<const ModelProto> model_proto = nullptr)
         : m_tensor_proto{&tensor},
           m_shape{std::begin(tensor.dims()), std::end(tensor.dims())},
           m_model_dir{model_dir},
-          m_mmap_cache{mmap_cache} {
+          m_mmap_cache{mmap_cache},
+          m_model_proto{std::move(model_proto)} {
         if (m_shape == ov::Shape{0}) {
             // It's possible to construct a tensor in ONNX with "dims: 0" property
             // Such tensor contains a scalar. This results in a ov::Shape{0} stored in m_shape.
@@ -206,6 +216,8 @@ private:
         return std::vector<T>(buffer->get_ptr<T>(), buffer->get_ptr<T>() + (buffer->size() / sizeof(T)));
     }
 
+    bool is_raw_data_shareable() const;
+
     const void* get_data_ptr() const {
         if (has_external_data()) {
             FRONT_END_THROW("Unexpected usage of method for externally stored data");
@@ -272,6 +284,7 @@ private:
     ov::Shape m_shape;
     std::string m_model_dir;
     detail::MappedMemoryHandles m_mmap_cache;
+    std::shared_ptr<const ModelProto> m_model_proto;
 };
 
 inline std::ostream& operator<<(std::ostream& outs, const Tensor& tensor) {
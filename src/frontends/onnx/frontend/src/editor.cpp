@@ -300,6 +300,8 @@ struct ONNXModelEditor::Impl {
     std::shared_ptr<ModelProto> m_model_proto;
     EdgeMapper m_edge_mapper;
     bool m_is_mapper_updated = false;
+    // the constants of the converted models may refer to the raw data of the initializers
+    bool m_is_data_shared = false;
 
     Impl() = delete;
 
@@ -309,6 +311,16 @@ struct ONNXModelEditor::Impl {
 
     Impl(const std::string& model_path) : Impl(std::make_shared<ModelProto>(parse_from_file(model_path))) {}
 
+    /// \brief Makes a private copy of the model before its initializers are modified if the converted models
+    ///        still refer to them.
+    void detach_shared_data() {
+        if (m_is_data_shared && m_model_proto.use_count() > 1) {
+            m_model_proto = std::make_shared<ModelProto>(*m_model_proto);
+            m_is_mapper_updated = false;
+        }
+        m_is_data_shared = false;
+    }
+
     Impl(std::istream& model_stream) : Impl(std::make_shared<ModelProto>(parse_from_istream(model_stream))) {}
 
 #if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
@@ -465,6 +477,7 @@ void ONNXModelEditor::extract_subgraph(const std::vector<InputEdge>& inputs,
         return;
     }
 
+    m_pimpl->detach_shared_data();
     if (!outputs.empty()) {
         m_pimpl->m_model_proto->mutable_graph()->mutable_output()->Clear();
     }
@@ -542,6 +555,7 @@ std::string ONNXModelEditor::model_string() const {
 }
 
 std::shared_ptr<Model> ONNXModelEditor::get_function() const {
+    m_pimpl->m_is_data_shared = m_pimpl->m_is_data_shared || m_mmap_cache != nullptr;
     return ov::frontend::onnx::detail::import_onnx_model(m_pimpl->m_model_proto,
                                                          m_model_path,
                                                          m_mmap_cache,
@@ -550,6 +564,7 @@ std::shared_ptr<Model> ONNXModelEditor::get_function() const {
 
 void ONNXModelEditor::set_input_values(
     const std::map<std::string, std::shared_ptr<ov::op::v0::Constant>>& input_values) {
+    m_pimpl->detach_shared_data();
     auto onnx_graph = m_pimpl->m_model_proto->mutable_graph();
 
     for (const auto& input : input_values) {
@@ -739,6 +754,7 @@ std::vector<std::string> ONNXModelEditor::get_output_ports(const EditorNode& nod
 }
 
 std::shared_ptr<Model> ONNXModelEditor::decode() {
+    m_pimpl->m_is_data_shared = m_pimpl->m_is_data_shared || m_mmap_cache != nullptr;
     return ov::frontend::onnx::detail::decode_to_framework_nodes(m_pimpl->m_model_proto,
                                                                  m_model_path,
                                                                  m_mmap_cache,
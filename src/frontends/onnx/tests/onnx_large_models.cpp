@@ -0,0 +1,218 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <onnx/onnx_pb.h>
+
+#include <algorithm>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "onnx_utils.hpp"
+#include "openvino/core/type.hpp"
+#include "openvino/frontend/manager.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/if.hpp"
+#include "openvino/op/negative.hpp"
+#include "openvino/op/relu.hpp"
+
+using namespace ov;
+using namespace ov::frontend;
+using namespace ov::frontend::onnx::tests;
+using namespace ::ONNX_NAMESPACE;
+
+namespace {
+ModelProto make_model() {
+    ModelProto model;
+    model.set_ir_version(8);
+    auto opset = model.add_opset_import();
+    opset->set_domain("");
+    opset->set_version(13);
+    model.mutable_graph()->set_name("large_model");
+    return model;
+}
+
+void set_tensor_type(ValueInfoProto& value_info, const std::string& name, int64_t size) {
+    value_info.set_name(name);
+    auto tensor_type = value_info.mutable_type()->mutable_tensor_type();
+    tensor_type->set_elem_type(TensorProto_DataType_FLOAT);
+    tensor_type->mutable_shape()->add_dim()->set_dim_value(size);
+}
+
+void add_initializer(GraphProto& graph, const std::string& name, const std::vector<float>& values) {
+    auto initializer = graph.add_initializer();
+    initializer->set_name(name);
+    initializer->set_data_type(TensorProto_DataType_FLOAT);
+    initializer->add_dims(static_cast<int64_t>(values.size()));
+    initializer->set_raw_data(std::string(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(float)));
+}
+
+void add_node(GraphProto& graph,
+              const std::string& op_type,
+              const std::vector<std::string>& inputs,
+              const std::string& output) {
+    auto node = graph.add_node();
+    node->set_op_type(op_type);
+    for (const auto& input : inputs) {
+        node->add_input(input);
+    }
+    node->add_output(output);
+}
+
+// Y = A + B, where B is both an input and an initializer
+ModelProto make_add_model(const std::vector<float>& values) {
+    auto model = make_model();
+    auto graph = model.mutable_graph();
+    const auto size = static_cast<int64_t>(values.size());
+    set_tensor_type(*graph->add_input(), "A", size);
+    set_tensor_type(*graph->add_input(), "B", size);
+    add_initializer(*graph, "B", values);
+    add_node(*graph, "Add", {"A", "B"}, "Y");
+    set_tensor_type(*graph->add_output(), "Y", size);
+    return model;
+}
+
+InputModel::Ptr load(const FrontEnd::Ptr& frontend, const ModelProto& model, bool enable_mmap) {
+    std::stringstream stream;
+    model.SerializeToOstream(&stream);
+    std::istream* is = &stream;
+    return frontend->load(is, enable_mmap);
+}
+
+std::shared_ptr<op::v0::Constant> get_constant(const std::shared_ptr<Model>& model, const std::string& name) {
+    for (const auto& op : model->get_ordered_ops()) {
+        const auto constant = ov::as_type_ptr<op::v0::Constant>(op);
+        if (constant && constant->get_output_tensor(0).get_names().count(name)) {
+            return constant;
+        }
+    }
+    return nullptr;
+}
+
+size_t count_ops(const std::shared_ptr<Model>& model, const DiscreteTypeInfo& type_info) {
+    const auto ops = model->get_ops();
+    return static_cast<size_t>(std::count_if(ops.begin(), ops.end(), [&type_info](const std::shared_ptr<ov::Node>& op) {
+        return op->get_type_info() == type_info;
+    }));
+}
+}  // namespace
+
+class OnnxFeLargeModelFixture : public ::testing::TestWithParam<bool> {
+protected:
+    FrontEnd::Ptr m_frontend = FrontEndManager().load_by_framework(ONNX_FE);
+};
+
+TEST_P(OnnxFeLargeModelFixture, initializers_above_parallel_decoding_threshold) {
+    // 5 initializers of 4 MB, so the 16 MB threshold of the parallel decoding is exceeded
+    constexpr size_t initializers = 5;
+    constexpr size_t size = 1024 * 1024;
+    auto model_proto = make_model();
+    auto graph = model_proto.mutable_graph();
+    std::vector<std::string> names;
+    for (size_t i = 0; i < initializers; i++) {
+        std::vector<float> values(size);
+        std::iota(values.begin(), values.end(), static_cast<float>(i * size));
+        names.push_back("init_" + std::to_string(i));
+        add_initializer(*graph, names.back(), values);
+    }
+    add_node(*graph, "Concat", names, "Y");
+    graph->mutable_node(0)->add_attribute()->set_name("axis");
+    graph->mutable_node(0)->mutable_attribute(0)->set_type(AttributeProto_AttributeType_INT);
+    graph->mutable_node(0)->mutable_attribute(0)->set_i(0);
+    set_tensor_type(*graph->add_output(), "Y", static_cast<int64_t>(initializers * size));
+
+    std::shared_ptr<Model> model;
+    OV_ASSERT_NO_THROW(model = m_frontend->convert(load(m_frontend, model_proto, GetParam())));
+
+    for (size_t i = 0; i < initializers; i++) {
+        const auto constant = get_constant(model, names[i]);
+        ASSERT_NE(constant, nullptr) << names[i];
+        const auto values = constant->cast_vector<float>();
+        ASSERT_EQ(values.size(), size);
+        EXPECT_EQ(values.front(), static_cast<float>(i * size));
+        EXPECT_EQ(values.back(), static_cast<float>((i + 1) * size - 1));
+    }
+}
+
+TEST_P(OnnxFeLargeModelFixture, raw_data_is_shared_with_mmap) {
+    const auto in_model = load(m_frontend, make_add_model(std::vector<float>(256, 2.f)), GetParam());
+
+    const auto first = m_frontend->convert(in_model);
+    const auto second = m_frontend->convert(in_model);
+    const auto first_constant = get_constant(first, "B");
+    const auto second_constant = get_constant(second, "B");
+    ASSERT_NE(first_constant, nullptr);
+    ASSERT_NE(second_constant, nullptr);
+    EXPECT_EQ(second_constant->cast_vector<float>(), std::vector<float>(256, 2.f));
+    // with mmap both constants refer to the raw data of the same ModelProto, otherwise the data is copied
+    EXPECT_EQ(first_constant->get_data_ptr() == second_constant->get_data_ptr(), GetParam());
+}
+
+TEST_P(OnnxFeLargeModelFixture, editing_shared_initializers_keeps_converted_models) {
+    const auto in_model = load(m_frontend, make_add_model(std::vector<float>(256, 2.f)), GetParam());
+    const auto original = m_frontend->convert(in_model);
+
+    // the initializer is rewritten after the conversion, the constants of the converted model must not see it
+    const std::vector<float> new_values(256, 5.f);
+    in_model->set_tensor_value(in_model->get_place_by_tensor_name("B"), new_values.data());
+    const auto edited = m_frontend->convert(in_model);
+
+    const auto original_constant = get_constant(original, "B");
+    const auto edited_constant = get_constant(edited, "B");
+    ASSERT_NE(original_constant, nullptr);
+    ASSERT_NE(edited_constant, nullptr);
+    EXPECT_EQ(original_constant->cast_vector<float>(), std::vector<float>(256, 2.f));
+    EXPECT_EQ(edited_constant->cast_vector<float>(), new_values);
+}
+
+TEST_P(OnnxFeLargeModelFixture, subgraphs_above_parallel_conversion_threshold) {
+    // two branches of 40 nodes each, so the 64 nodes threshold of the concurrent conversion is exceeded
+    constexpr size_t branch_nodes = 40;
+    auto model_proto = make_model();
+    auto graph = model_proto.mutable_graph();
+    auto cond = graph->add_input();
+    cond->set_name("cond");
+    cond->mutable_type()->mutable_tensor_type()->set_elem_type(TensorProto_DataType_BOOL);
+    cond->mutable_type()->mutable_tensor_type()->mutable_shape();
+    set_tensor_type(*graph->add_input(), "X", 4);
+
+    add_node(*graph, "If", {"cond"}, "Y");
+    for (const auto& [name, op_type] : {std::pair<std::string, std::string>{"then_branch", "Relu"},
+                                        std::pair<std::string, std::string>{"else_branch", "Neg"}}) {
+        auto attribute = graph->mutable_node(0)->add_attribute();
+        attribute->set_name(name);
+        attribute->set_type(AttributeProto_AttributeType_GRAPH);
+        auto branch = attribute->mutable_g();
+        branch->set_name(name);
+        // the first node of the branch consumes the tensor of the parent graph
+        std::string input = "X";
+        for (size_t i = 0; i < branch_nodes; i++) {
+            const auto output = name + "_" + std::to_string(i);
+            add_node(*branch, op_type, {input}, output);
+            input = output;
+        }
+        set_tensor_type(*branch->add_output(), input, 4);
+    }
+    set_tensor_type(*graph->add_output(), "Y", 4);
+
+    std::shared_ptr<Model> model;
+    OV_ASSERT_NO_THROW(model = m_frontend->convert(load(m_frontend, model_proto, GetParam())));
+
+    std::shared_ptr<op::v8::If> if_op;
+    for (const auto& op : model->get_ordered_ops()) {
+        if (const auto casted = ov::as_type_ptr<op::v8::If>(op)) {
+            if_op = casted;
+        }
+    }
+    ASSERT_NE(if_op, nullptr);
+    EXPECT_EQ(count_ops(if_op->get_then_body(), op::v0::Relu::get_type_info_static()), branch_nodes);
+    EXPECT_EQ(count_ops(if_op->get_else_body(), op::v0::Negative::get_type_info_static()), branch_nodes);
+    // both branches refer to the same input of the parent graph
+    EXPECT_EQ(if_op->get_input_size(), 2u);
+}
+
+INSTANTIATE_TEST_SUITE_P(OnnxFeLargeModel, OnnxFeLargeModelFixture, ::testing::Bool());
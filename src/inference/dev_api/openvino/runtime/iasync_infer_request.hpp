@@ -154,6 +154,29 @@ public:
      */
     const std::vector<ov::Output<const ov::Node>>& get_outputs() const override;
 
+    /**
+     * @brief Sets the properties of the request: ov::hint::request_priority and ov::hint::request_deadline are passed
+     * to the executors of the pipeline stages with each task (see ov::threading::ITaskExecutor::run_with_priority)
+     * @param properties Map of pairs: (property name, property value)
+     */
+    virtual void set_property(const ov::AnyMap& properties);
+
+    /**
+     * @brief Gets a property of the request
+     * @param name Property name
+     * @return Property value
+     */
+    virtual ov::Any get_property(const std::string& name) const;
+
+    /**
+     * @brief Converts the scheduling attributes of a task to the request properties (ov::hint::request_priority and
+     * ov::hint::request_deadline counted from now), so the plugins executing the requests of other devices in their
+     * pipeline stages pass the attributes of the stage task to these requests
+     * @param priority Scheduling attributes of the task
+     * @return Map of pairs: (property name, property value)
+     */
+    static ov::AnyMap get_request_properties(const ov::threading::TaskPriority& priority);
+
 protected:
     using Stage = std::pair<std::shared_ptr<ov::threading::ITaskExecutor>, ov::threading::Task>;
     /**
@@ -216,6 +239,8 @@ private:
         std::function<void(std::exception_ptr)> m_callback;
     };
 
+    void update_task_priority();
+
     void run_first_stage(const Pipeline::iterator itBeginStage,
                          const Pipeline::iterator itEndStage,
                          const std::shared_ptr<ov::threading::ITaskExecutor> callbackExecutor = {});
@@ -250,6 +275,7 @@ private:
                                 m_futures.end());
                 m_promise = {};
                 m_futures.emplace_back(m_promise.get_future().share());
+                update_task_priority();
             } break;
             case InferState::STOP:
                 break;
@@ -277,6 +303,9 @@ private:
         m_sync_callback_executor;  //!< Used to run post inference callback in synchronous pipline
     mutable std::mutex m_mutex;
     std::function<void(std::exception_ptr)> m_callback;
+    ov::hint::Priority m_priority = ov::hint::Priority::DEFAULT;
+    uint32_t m_deadline = 0;
+    ov::threading::TaskPriority m_task_priority;  //!< Scheduling attributes of the tasks of the ongoing inference
 };
 
 }  // namespace ov
@@ -9,8 +9,10 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "openvino/runtime/common.hpp"
 #include "openvino/runtime/threading/istreams_executor.hpp"
@@ -23,7 +25,10 @@ namespace threading {
  * @ingroup ov_dev_api_threading
  * @brief CPU Streams executor implementation. The executor splits the CPU into groups of threads,
  *        that can be pinned to cores or NUMA nodes.
- *        It uses custom threads to pull tasks from single queue.
+ *        It uses custom threads to pull tasks from single queue. If the work stealing is enabled in the config,
+ *        each stream pulls the tasks from its own queue and steals the tasks of the other streams of the same NUMA
+ *        node when the own queue is empty. The queued tasks are ordered by the priority class and the deadline
+ *        passed to run_with_priority(), the tasks of the same priority and deadline are executed in FIFO order.
  */
 class OPENVINO_RUNTIME_API CPUStreamsExecutor : public IStreamsExecutor {
 public:
@@ -32,6 +37,19 @@ public:
      */
     using Ptr = std::shared_ptr<CPUStreamsExecutor>;
 
+    /**
+     * @brief Task scheduling statistics of the executor
+     */
+    struct Statistics {
+        uint64_t tasks = 0;                   //!< Number of the tasks queued by run() and run_with_priority()
+        uint64_t steals = 0;                  //!< Number of the tasks executed by a stream other than the one
+                                              //!< they were queued to
+        uint64_t missed_deadlines = 0;        //!< Number of the inferences (the tasks sharing
+                                              //!< TaskPriority::deadline_missed) completed after their deadline
+        std::vector<size_t> max_queue_depth;  //!< Maximal depth of each task queue: one per stream if the work
+                                              //!< stealing is enabled, the single shared queue otherwise
+    };
+
     /**
      * @brief Constructor
      * @param config Stream executor parameters
@@ -45,6 +63,8 @@ public:
 
     void run(Task task) override;
 
+    void run_with_priority(Task task, const TaskPriority& priority) override;
+
     void execute(Task task) override;
 
     int get_stream_id() override;
@@ -59,6 +79,12 @@ public:
 
     void cpu_reset() override;
 
+    /**
+     * @brief Returns the task scheduling statistics accumulated since the executor creation
+     * @return Statistics
+     */
+    Statistics get_statistics() const;
+
 private:
     struct Impl;
     std::unique_ptr<Impl> _impl;
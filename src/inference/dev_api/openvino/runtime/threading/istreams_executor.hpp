@@ -99,6 +99,8 @@ public:
         int _sub_streams = 0;
         std::vector<int> _rank = {};
         bool _add_lock = true;
+        bool _work_stealing = false;  //!< Whether each stream has its own task queue and idle streams steal the tasks
+                                      //!< queued to the busy streams of the same NUMA node
 
         /**
          * @brief Get and reserve cpu ids based on configuration and hardware information,
@@ -131,6 +133,7 @@ public:
          * @param[in]  cpu_pinning                  @copybrief Config::_cpu_pinning
          * @param[in]  streams_info_table           @copybrief Config::_streams_info_table
          * @param[in]  rank                         @copybrief Config::_rank
+         * @param[in]  work_stealing                @copybrief Config::_work_stealing
          */
         Config(std::string name = "StreamsExecutor",
                int streams = 1,
@@ -141,7 +144,8 @@ public:
                bool cores_limit = true,
                std::vector<std::vector<int>> streams_info_table = {},
                std::vector<int> rank = {},
-               bool add_lock = true)
+               bool add_lock = true,
+               bool work_stealing = false)
             : _name{std::move(name)},
               _streams{streams},
               _threads_per_stream{threads_per_stream},
@@ -151,7 +155,8 @@ public:
               _cores_limit{cores_limit},
               _streams_info_table{std::move(streams_info_table)},
               _rank{std::move(rank)},
-              _add_lock(add_lock) {
+              _add_lock(add_lock),
+              _work_stealing(work_stealing) {
             update_executor_config(_add_lock);
         }
 
@@ -213,6 +218,9 @@ public:
         std::vector<int> get_rank() const {
             return _rank;
         }
+        bool get_work_stealing() const {
+            return _work_stealing;
+        }
         StreamsMode get_sub_stream_mode() const {
             const auto proc_type_table = get_proc_type_table();
             int sockets = proc_type_table.size() > 1 ? static_cast<int>(proc_type_table.size()) - 1 : 1;
@@ -223,7 +231,7 @@ public:
             if (_name == config._name && _streams == config._streams &&
                 _threads_per_stream == config._threads_per_stream &&
                 _thread_preferred_core_type == config._thread_preferred_core_type &&
-                _rank == config._rank) {
+                _rank == config._rank && _work_stealing == config._work_stealing) {
                 return true;
             } else {
                 return false;
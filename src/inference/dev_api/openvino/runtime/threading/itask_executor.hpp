@@ -9,11 +9,14 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <vector>
 
 #include "openvino/runtime/common.hpp"
+#include "openvino/runtime/properties.hpp"
 
 namespace ov {
 namespace threading {
@@ -25,6 +28,20 @@ namespace threading {
  */
 using Task = std::function<void()>;
 
+/**
+ * @brief Scheduling attributes of a task. The executors supporting them run the task of the higher priority class
+ *        first and the tasks of the same class in the order of their deadlines
+ * @ingroup ov_dev_api_threading
+ */
+struct TaskPriority {
+    using Clock = std::chrono::steady_clock;
+    ov::hint::Priority priority = ov::hint::Priority::DEFAULT;  //!< Priority class of the task
+    Clock::time_point deadline = Clock::time_point::max();      //!< Time the task should be completed by
+    std::shared_ptr<std::atomic_bool> deadline_missed;           //!< Shared by the tasks of one inference, so a missed
+                                                                 //!< deadline is counted once. If not set, every task
+                                                                 //!< completed after the deadline is counted
+};
+
 /**
 * @interface ITaskExecutor
 * @ingroup ov_dev_api_threading
@@ -75,6 +92,14 @@ public:
      * @param tasks A vector of tasks to execute
      */
     virtual void run_and_wait(const std::vector<Task>& tasks);
+
+    /**
+     * @brief Execute ov::Task inside task executor context with the scheduling attributes.
+     *        Default implementation ignores the attributes and calls run()
+     * @param task A task to start
+     * @param priority Scheduling attributes of the task
+     */
+    virtual void run_with_priority(Task task, const TaskPriority& priority);
 };
 
 }  // namespace threading
@@ -16,6 +16,7 @@
 #include "openvino/core/node_output.hpp"
 #include "openvino/runtime/common.hpp"
 #include "openvino/runtime/profiling_info.hpp"
+#include "openvino/runtime/properties.hpp"
 #include "openvino/runtime/tensor.hpp"
 #include "openvino/runtime/variable_state.hpp"
 
@@ -327,6 +328,45 @@ public:
      */
     CompiledModel get_compiled_model();
 
+    /**
+     * @brief Sets properties for the current inference request, for example ov::hint::request_priority and
+     * ov::hint::request_deadline. The properties apply to the subsequent inferences.
+     *
+     * @param properties Map of pairs: (property name, property value).
+     */
+    void set_property(const AnyMap& properties);
+
+    /**
+     * @brief Sets properties for the current inference request.
+     *
+     * @tparam Properties Should be the pack of `std::pair<std::string, ov::Any>` types.
+     * @param properties Optional pack of pairs: (property name, property value).
+     */
+    template <typename... Properties>
+    util::EnableIfAllStringAny<void, Properties...> set_property(Properties&&... properties) {
+        set_property(AnyMap{std::forward<Properties>(properties)...});
+    }
+
+    /**
+     * @brief Gets a property of the current inference request.
+     *
+     * @param name Property key, the supported ones are listed by the ov::supported_properties key.
+     * @return Property value.
+     */
+    Any get_property(const std::string& name) const;
+
+    /**
+     * @brief Gets a property of the current inference request.
+     *
+     * @tparam T Type of a returned value.
+     * @param property  Property  object.
+     * @return Value of property.
+     */
+    template <typename T, PropertyMutability mutability>
+    T get_property(const ov::Property<T, mutability>& property) const {
+        return get_property(property.name()).template as<T>();
+    }
+
     /**
      * @brief Checks if the current InferRequest object is not initialized.
      * @return True if the current InferRequest object is not initialized; false, otherwise.
@@ -302,6 +302,21 @@ inline std::istream& operator>>(std::istream& is, Priority& priority) {
  */
 static constexpr Property<Priority> model_priority{"MODEL_PRIORITY"};
 
+/**
+ * @brief Priority class of an infer request, set with ov::InferRequest::set_property
+ * The queued tasks of the requests with the higher priority are executed by the device first
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<Priority> request_priority{"REQUEST_PRIORITY"};
+
+/**
+ * @brief Deadline (in milliseconds since the request start) of an infer request, set with
+ * ov::InferRequest::set_property. The queued tasks of the requests of the same priority class are executed in the
+ * order of their deadlines, the tasks of the requests without the deadline (zero, the default) are executed last.
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<uint32_t> request_deadline{"REQUEST_DEADLINE"};
+
 /**
  * @brief Enum to define possible performance mode hints
  * @ingroup ov_runtime_cpp_prop_api
@@ -876,6 +891,14 @@ static constexpr Property<uint32_t, PropertyMutability::RO> max_batch_size{"MAX_
  */
 static constexpr Property<uint32_t, PropertyMutability::RW> auto_batch_timeout{"AUTO_BATCH_TIMEOUT"};
 
+/**
+ * @brief Read-write property to set the p99 latency target (in milliseconds) of a single request for the
+ * auto-batching. When set (non-zero), the time to collect the inputs and the batch size are chosen adaptively from the
+ * observed request arrival rate and execution latency, instead of the fixed ov::auto_batch_timeout.
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<uint32_t, PropertyMutability::RW> auto_batch_latency_target{"AUTO_BATCH_LATENCY_TARGET"};
+
 /**
  * @brief Read-only property to provide a hint for a range for number of async infer requests. If device supports
  * streams, the metric provides range for number of IRs per stream.
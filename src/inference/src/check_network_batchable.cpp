@@ -38,23 +38,31 @@ NetworkBatchAbility is_model_batchable(const std::shared_ptr<const ov::Model>& m
     m.register_pass<ov::pass::FindBatch>(true, strictly_track_dims);
     m.run_passes(function);
     bool any_batched_inputs = false;
+    bool any_dynamic_batch = false;
     // do not reshape/re-batch originally batched networks and when there are no inputs with the N* layouts
     // input(s) should have the batch dim as the first dim or none (current limitation of the auto-batching impl)
     const auto& params = function->get_parameters();
     for (size_t input_id = 0; input_id < params.size(); input_id++) {
         const auto& input = params[input_id];
         const auto& shape = input->get_partial_shape();
-        // currently no plugin support batched execution for dynamic networks
-        if (shape.is_dynamic())
+        // the only dynamic dimension supported for the batched execution is the batch itself
+        if (shape.rank().is_dynamic())
             return NetworkBatchAbility::NO;
-        // check the batch dim: either 0th (and the original batch size of 1) or none
+        for (size_t s = 1; s < shape.size(); s++)
+            if (shape[s].is_dynamic())
+                return NetworkBatchAbility::NO;
+        // check the batch dim: either 0th (and the original batch size of 1 or dynamic) or none
         if (shape.size() && shape[0].has_symbol()) {
-            const auto& static_shape = input->get_shape();
-            if (static_shape[0] != 1)
+            // the batched inputs should be either all static or all dynamic
+            if (any_batched_inputs && any_dynamic_batch != shape[0].is_dynamic())
+                return NetworkBatchAbility::NO;
+            if (shape[0].is_static() && shape[0] != 1)
                 return NetworkBatchAbility::NO;
-            else
-                any_batched_inputs = true;
+            any_dynamic_batch = shape[0].is_dynamic();
+            any_batched_inputs = true;
         } else {
+            if (shape.is_dynamic())
+                return NetworkBatchAbility::NO;
             // if the 0-th dim is not for the batch, then we support only the case when NONE dimension is batch
             for (size_t s = 1; s < shape.size(); s++)
                 if (shape[s].has_symbol())
@@ -64,6 +72,9 @@ NetworkBatchAbility is_model_batchable(const std::shared_ptr<const ov::Model>& m
     if (!any_batched_inputs)
         return NetworkBatchAbility::NO;
 
+    if (any_dynamic_batch)
+        return model_has_suitable_do(model) ? NetworkBatchAbility::NO : NetworkBatchAbility::AS_IS_DYNAMIC;
+
     return model_has_suitable_do(model) ? NetworkBatchAbility::WITH_HETERO : NetworkBatchAbility::AS_IS;
 }
 
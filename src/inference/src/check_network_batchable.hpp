@@ -13,9 +13,10 @@ namespace details {
 /**
  * @brief Checks if the input model is batch-able (e.g. no dynamic inputs, inputs has the batch dimension, etc)
  * @param model A model to check for automatic-batching applicability
- * @return An enum value indicating whether the model can be safely batched (with HETERO or as is) or not
+ * @return An enum value indicating whether the model can be safely batched (with HETERO or as is) or not,
+ * AS_IS_DYNAMIC is for the models with the dynamic batch dimension (batched without reshaping)
  */
-enum class NetworkBatchAbility : uint32_t { NO = 0, AS_IS, WITH_HETERO };
+enum class NetworkBatchAbility : uint32_t { NO = 0, AS_IS, WITH_HETERO, AS_IS_DYNAMIC };
 NetworkBatchAbility is_model_batchable(const std::shared_ptr<const ov::Model>& model,
                                        const std::string& deviceNoBatch,
                                        bool strictly_track_dims);
@@ -287,6 +287,14 @@ CompiledModel InferRequest::get_compiled_model() {
     OV_INFER_REQ_CALL_STATEMENT(return {std::const_pointer_cast<ICompiledModel>(_impl->get_compiled_model()), _so});
 }
 
+void InferRequest::set_property(const AnyMap& properties) {
+    OV_INFER_REQ_CALL_STATEMENT(_impl->set_property(properties));
+}
+
+Any InferRequest::get_property(const std::string& name) const {
+    OV_INFER_REQ_CALL_STATEMENT(return _impl->get_property(name));
+}
+
 bool InferRequest::operator!() const noexcept {
     return !_impl;
 }
@@ -208,7 +208,9 @@ static const auto core_properties_names =
     ov::util::make_array(ov::cache_dir.name(), ov::enable_mmap.name(), ov::force_tbb_terminate.name());
 
 static const auto auto_batch_properties_names =
-    ov::util::make_array(ov::auto_batch_timeout.name(), ov::hint::allow_auto_batching.name());
+    ov::util::make_array(ov::auto_batch_timeout.name(),
+                         ov::auto_batch_latency_target.name(),
+                         ov::hint::allow_auto_batching.name());
 
 ov::util::Path extract_weight_path(const std::string& compiled_properties) {
     if (auto start = compiled_properties.find(ov::weights_path.name()); start != std::string::npos) {
@@ -1200,6 +1202,12 @@ std::shared_ptr<const ov::Model> ov::CoreImpl::apply_auto_batching(const std::sh
     switch (res) {
     case ov::details::NetworkBatchAbility::NO:
         return model;
+    case ov::details::NetworkBatchAbility::AS_IS_DYNAMIC:
+        // the device handles the dynamic batch on its own, so the requests are stitched only when asked explicitly
+        if (strictly_check_dims)
+            return model;
+        deviceName = "BATCH:" + batchConfig;
+        break;
     case ov::details::NetworkBatchAbility::AS_IS:
         deviceName = "BATCH:" + batchConfig;
         break;
@@ -4,6 +4,9 @@
 
 #include "openvino/runtime/iasync_infer_request.hpp"
 
+#include <algorithm>
+#include <future>
+#include <limits>
 #include <memory>
 
 #include "openvino/runtime/isync_infer_request.hpp"
@@ -25,6 +28,20 @@ struct ImmediateStreamsExecutor : public ov::threading::ITaskExecutor {
             _streamsExecutor->execute(std::move(task));
         }
     }
+    void run_with_priority(ov::threading::Task task, const ov::threading::TaskPriority& priority) override {
+        if (_streamsExecutor->get_streams_num() > 1) {
+            std::packaged_task<void()> packaged_task{std::move(task)};
+            auto future = packaged_task.get_future();
+            _streamsExecutor->run_with_priority(
+                [&packaged_task] {
+                    packaged_task();
+                },
+                priority);
+            future.get();
+        } else {
+            _streamsExecutor->execute(std::move(task));
+        }
+    }
     std::shared_ptr<ov::threading::IStreamsExecutor> _streamsExecutor;
 };
 
@@ -121,7 +138,17 @@ void ov::IAsyncInferRequest::run_first_stage(const Pipeline::iterator itBeginSta
                                              const std::shared_ptr<ov::threading::ITaskExecutor> callbackExecutor) {
     auto& firstStageExecutor = std::get<Stage_e::EXECUTOR>(*itBeginStage);
     OPENVINO_ASSERT(nullptr != firstStageExecutor);
-    firstStageExecutor->run(make_next_stage_task(itBeginStage, itEndStage, std::move(callbackExecutor)));
+    firstStageExecutor->run_with_priority(make_next_stage_task(itBeginStage, itEndStage, std::move(callbackExecutor)),
+                                          m_task_priority);
+}
+
+void ov::IAsyncInferRequest::update_task_priority() {
+    m_task_priority.priority = m_priority;
+    m_task_priority.deadline = m_deadline
+                                   ? ov::threading::TaskPriority::Clock::now() + std::chrono::milliseconds(m_deadline)
+                                   : ov::threading::TaskPriority::Clock::time_point::max();
+    // the stages of one inference share the flag, so the executors count the missed deadline once per inference
+    m_task_priority.deadline_missed = m_deadline ? std::make_shared<std::atomic_bool>(false) : nullptr;
 }
 
 ov::threading::Task ov::IAsyncInferRequest::make_next_stage_task(
@@ -141,7 +168,9 @@ ov::threading::Task ov::IAsyncInferRequest::make_next_stage_task(
                     auto& nextStage = *itNextStage;
                     auto& nextStageExecutor = std::get<Stage_e::EXECUTOR>(nextStage);
                     OPENVINO_ASSERT(nullptr != nextStageExecutor);
-                    nextStageExecutor->run(make_next_stage_task(itNextStage, itEndStage, std::move(callbackExecutor)));
+                    nextStageExecutor->run_with_priority(
+                        make_next_stage_task(itNextStage, itEndStage, std::move(callbackExecutor)),
+                        m_task_priority);
                 }
             } catch (...) {
                 currentException = std::current_exception();
@@ -235,6 +264,45 @@ void ov::IAsyncInferRequest::set_tensors(const ov::Output<const ov::Node>& port,
     return m_sync_request->set_tensors(port, tensors);
 }
 
+void ov::IAsyncInferRequest::set_property(const ov::AnyMap& properties) {
+    check_state();
+    for (const auto& property : properties) {
+        if (property.first == ov::hint::request_priority.name()) {
+            m_priority = property.second.as<ov::hint::Priority>();
+        } else if (property.first == ov::hint::request_deadline.name()) {
+            m_deadline = property.second.as<uint32_t>();
+        } else {
+            OPENVINO_THROW("Unsupported property ", property.first, " for the infer request");
+        }
+    }
+}
+
+ov::Any ov::IAsyncInferRequest::get_property(const std::string& name) const {
+    if (name == ov::supported_properties) {
+        return decltype(ov::supported_properties)::value_type{
+            ov::PropertyName{ov::hint::request_priority.name(), ov::PropertyMutability::RW},
+            ov::PropertyName{ov::hint::request_deadline.name(), ov::PropertyMutability::RW}};
+    } else if (name == ov::hint::request_priority) {
+        return decltype(ov::hint::request_priority)::value_type(m_priority);
+    } else if (name == ov::hint::request_deadline) {
+        return decltype(ov::hint::request_deadline)::value_type(m_deadline);
+    }
+    OPENVINO_THROW("Unsupported property ", name, " for the infer request");
+}
+
+ov::AnyMap ov::IAsyncInferRequest::get_request_properties(const ov::threading::TaskPriority& priority) {
+    uint32_t deadline = 0;
+    if (priority.deadline != ov::threading::TaskPriority::Clock::time_point::max()) {
+        const auto left = std::chrono::duration_cast<std::chrono::milliseconds>(
+                              priority.deadline - ov::threading::TaskPriority::Clock::now())
+                              .count();
+        // the deadline which has already passed is still the most urgent one, 0 would disable it
+        deadline = static_cast<uint32_t>(
+            std::min<int64_t>(std::max<int64_t>(left, 1), std::numeric_limits<uint32_t>::max()));
+    }
+    return {ov::hint::request_priority(priority.priority), ov::hint::request_deadline(deadline)};
+}
+
 void ov::IAsyncInferRequest::stop_and_wait() {
     Futures futures;
     InferState state = InferState::IDLE;
@@ -4,8 +4,10 @@
 
 #include "openvino/runtime/threading/cpu_streams_executor.hpp"
 
+#include <algorithm>
 #include <atomic>
 #include <condition_variable>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <queue>
@@ -331,6 +333,49 @@ struct CPUStreamsExecutor::Impl {
         std::mutex _stream_map_mutex;
     };
 
+    // the queued task, the queues are heaps where the task of the higher priority class, then of the earlier
+    // deadline, then queued earlier is on top, so the tasks without the scheduling attributes are executed in FIFO order
+    struct QueuedTask {
+        Task _task;
+        TaskPriority _priority;
+        uint64_t _order = 0;
+        bool operator<(const QueuedTask& other) const {
+            if (_priority.priority != other._priority.priority) {
+                return _priority.priority < other._priority.priority;
+            }
+            if (_priority.deadline != other._priority.deadline) {
+                return _priority.deadline > other._priority.deadline;
+            }
+            return _order > other._order;
+        }
+    };
+    using TaskQueue = std::vector<QueuedTask>;
+    static void push_task(TaskQueue& queue, QueuedTask task) {
+        queue.push_back(std::move(task));
+        std::push_heap(queue.begin(), queue.end());
+    }
+    static QueuedTask pop_task(TaskQueue& queue) {
+        std::pop_heap(queue.begin(), queue.end());
+        auto task = std::move(queue.back());
+        queue.pop_back();
+        return task;
+    }
+
+    // the task queue of the stream when the work stealing is enabled
+    struct StreamQueue {
+        std::mutex _mutex;
+        TaskQueue _tasks;
+        size_t _maxDepth = 0;
+    };
+    // the streams of the same NUMA node, which steal the tasks from each other
+    struct StreamGroup {
+        std::mutex _mutex;
+        std::condition_variable _condVar;
+        size_t _pending = 0;
+        bool _stopped = false;
+        std::vector<size_t> _queues;
+    };
+
     explicit Impl(const Config& config)
         : _config{config},
           _streams(
@@ -342,6 +387,13 @@ struct CPUStreamsExecutor::Impl {
         auto numaNodes = get_available_numa_nodes();
         int streams_num = _config.get_streams();
         auto processor_ids = _config.get_stream_processor_ids();
+        if (_config.get_work_stealing()) {
+            for (auto streamId = 0; streamId < streams_num; ++streamId) {
+                _streamQueues.emplace_back(new StreamQueue);
+            }
+            _queueNumaNodes.resize(_streamQueues.size(), 0);
+            _queueGroups.resize(_streamQueues.size(), 0);
+        }
         if (streams_num != 0) {
             std::copy_n(std::begin(numaNodes),
                         std::min<std::size_t>(streams_num, numaNodes.size()),
@@ -356,35 +408,164 @@ struct CPUStreamsExecutor::Impl {
             }
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config.get_name() + "_" + std::to_string(streamId));
+                if (_config.get_work_stealing()) {
+                    RunStealingStream(streamId);
+                    return;
+                }
                 for (bool stopped = false; !stopped;) {
-                    Task task;
+                    QueuedTask task;
                     {
                         std::unique_lock<std::mutex> lock(_mutex);
                         _queueCondVar.wait(lock, [&] {
                             return !_taskQueue.empty() || (stopped = _isStopped);
                         });
                         if (!_taskQueue.empty()) {
-                            task = std::move(_taskQueue.front());
-                            _taskQueue.pop();
+                            task = pop_task(_taskQueue);
                         }
                     }
-                    if (task) {
+                    if (task._task) {
                         Execute(task, *(_streams.local()));
                     }
                 }
             });
         }
         _streams.set_thread_ids_map(_threads);
+        if (_config.get_work_stealing() && streams_num > 0) {
+            init_stream_groups();
+        }
+    }
+
+    // the streams of the same NUMA node share the tasks, so the task is never stolen across the NUMA nodes
+    // (and hence sockets) which keeps the memory of the stream arenas and the model local
+    void init_stream_groups() {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _threadsReady = true;
+        _queueCondVar.notify_all();
+        _queueCondVar.wait(lock, [&] {
+            return _registeredQueues == _streamQueues.size();
+        });
+        std::map<int, size_t> numaNodeGroups;
+        for (size_t queueId = 0; queueId < _streamQueues.size(); ++queueId) {
+            auto group = numaNodeGroups.emplace(_queueNumaNodes[queueId], _streamGroups.size());
+            if (group.second) {
+                _streamGroups.emplace_back(new StreamGroup);
+            }
+            _queueGroups[queueId] = group.first->second;
+            _streamGroups[group.first->second]->_queues.push_back(queueId);
+        }
+        _groupsReady = true;
+        _queueCondVar.notify_all();
     }
 
-    void Enqueue(Task task) {
+    void RunStealingStream(const size_t queueId) {
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _queueCondVar.wait(lock, [&] {
+                return _threadsReady;
+            });
+        }
+        // the stream is created ahead of the first task to know the NUMA node it is bound to
+        auto stream = _streams.local();
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _queueNumaNodes[queueId] = stream->_numaNodeId;
+            ++_registeredQueues;
+            _queueCondVar.notify_all();
+            _queueCondVar.wait(lock, [&] {
+                return _groupsReady;
+            });
+        }
+        current_queue() = {this, queueId};
+        auto& group = *_streamGroups[_queueGroups[queueId]];
+        for (bool stopped = false; !stopped;) {
+            QueuedTask task;
+            {
+                std::unique_lock<std::mutex> lock(group._mutex);
+                group._condVar.wait(lock, [&] {
+                    return group._pending > 0 || (stopped = group._stopped);
+                });
+                if (group._pending == 0) {
+                    continue;
+                }
+                --group._pending;
+                // the pending counter never exceeds the number of the tasks queued to the group, and the other streams
+                // of the group can't take a task while the group lock is held, so the reserved task is always found
+                task = PopTask(queueId, group);
+            }
+            OPENVINO_ASSERT(task._task, "The reserved task is not found in the stream group queues");
+            Execute(task, *stream);
+        }
+    }
+
+    QueuedTask PopTask(const size_t queueId, const StreamGroup& group) {
+        QueuedTask task;
+        {
+            auto& queue = *_streamQueues[queueId];
+            std::lock_guard<std::mutex> lock(queue._mutex);
+            if (!queue._tasks.empty()) {
+                return pop_task(queue._tasks);
+            }
+        }
+        // steal the most urgent task of the most loaded stream
+        size_t victimId = queueId;
+        size_t victimDepth = 0;
+        for (auto otherId : group._queues) {
+            auto& queue = *_streamQueues[otherId];
+            std::lock_guard<std::mutex> lock(queue._mutex);
+            if (queue._tasks.size() > victimDepth) {
+                victimId = otherId;
+                victimDepth = queue._tasks.size();
+            }
+        }
+        if (victimId != queueId) {
+            auto& queue = *_streamQueues[victimId];
+            std::lock_guard<std::mutex> lock(queue._mutex);
+            if (!queue._tasks.empty()) {
+                task = pop_task(queue._tasks);
+                _stealsNum++;
+            }
+        }
+        return task;
+    }
+
+    void EnqueueToStream(QueuedTask task) {
+        // the tasks queued from the stream itself (e.g. the next stage of the pipeline) stay on this stream,
+        // the tasks from the other threads are distributed over the streams in the round robin order
+        const auto& current = current_queue();
+        const size_t queueId = current.first == this ? current.second : _nextQueue++ % _streamQueues.size();
+        {
+            auto& queue = *_streamQueues[queueId];
+            std::lock_guard<std::mutex> lock(queue._mutex);
+            push_task(queue._tasks, std::move(task));
+            queue._maxDepth = std::max(queue._maxDepth, queue._tasks.size());
+        }
+        auto& group = *_streamGroups[_queueGroups[queueId]];
+        {
+            std::lock_guard<std::mutex> lock(group._mutex);
+            ++group._pending;
+        }
+        group._condVar.notify_one();
+    }
+
+    void Enqueue(Task task, const TaskPriority& priority = {}) {
+        QueuedTask queued_task{std::move(task), priority, _tasksNum++};
+        if (_config.get_work_stealing()) {
+            EnqueueToStream(std::move(queued_task));
+            return;
+        }
         {
             std::lock_guard<std::mutex> lock(_mutex);
-            _taskQueue.emplace(std::move(task));
+            push_task(_taskQueue, std::move(queued_task));
+            _maxQueueDepth = std::max(_maxQueueDepth, _taskQueue.size());
         }
         _queueCondVar.notify_one();
     }
 
+    static std::pair<const Impl*, size_t>& current_queue() {
+        static thread_local std::pair<const Impl*, size_t> queue{nullptr, 0};
+        return queue;
+    }
+
     void Execute(const Task& task, Stream& stream) {
 #if OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO
         auto& arena = stream._taskArena;
@@ -400,6 +581,15 @@ struct CPUStreamsExecutor::Impl {
 #endif
     }
 
+    void Execute(const QueuedTask& task, Stream& stream) {
+        Execute(task._task, stream);
+        if (task._priority.deadline != TaskPriority::Clock::time_point::max() &&
+            TaskPriority::Clock::now() > task._priority.deadline &&
+            (!task._priority.deadline_missed || !task._priority.deadline_missed->exchange(true))) {
+            _missedDeadlinesNum++;
+        }
+    }
+
     void pin_stream_to_cpus() {
 #if OV_THREAD == OV_THREAD_SEQ
         if (_config.get_cpu_pinning()) {
@@ -452,7 +642,7 @@ struct CPUStreamsExecutor::Impl {
     std::vector<std::thread> _threads;
     std::mutex _mutex;
     std::condition_variable _queueCondVar;
-    std::queue<Task> _taskQueue;
+    TaskQueue _taskQueue;
     bool _isStopped = false;
     std::vector<int> _usedNumaNodes;
     CustomThreadLocal _streams;
@@ -460,6 +650,18 @@ struct CPUStreamsExecutor::Impl {
     bool _isExit = false;
     std::vector<int> _cpu_ids_all;
     std::mutex _cpu_ids_mutex;
+    std::vector<std::unique_ptr<StreamQueue>> _streamQueues;
+    std::vector<std::unique_ptr<StreamGroup>> _streamGroups;
+    std::vector<int> _queueNumaNodes;
+    std::vector<size_t> _queueGroups;
+    size_t _registeredQueues = 0;
+    bool _threadsReady = false;
+    bool _groupsReady = false;
+    std::atomic<size_t> _nextQueue{0};
+    std::atomic<uint64_t> _tasksNum{0};
+    std::atomic<uint64_t> _stealsNum{0};
+    std::atomic<uint64_t> _missedDeadlinesNum{0};
+    size_t _maxQueueDepth = 0;
 };
 
 int CPUStreamsExecutor::get_stream_id() {
@@ -505,6 +707,23 @@ void CPUStreamsExecutor::cpu_reset() {
     }
 }
 
+CPUStreamsExecutor::Statistics CPUStreamsExecutor::get_statistics() const {
+    Statistics statistics;
+    statistics.tasks = _impl->_tasksNum;
+    statistics.steals = _impl->_stealsNum;
+    statistics.missed_deadlines = _impl->_missedDeadlinesNum;
+    if (_impl->_config.get_work_stealing()) {
+        for (auto& queue : _impl->_streamQueues) {
+            std::lock_guard<std::mutex> lock(queue->_mutex);
+            statistics.max_queue_depth.push_back(queue->_maxDepth);
+        }
+    } else {
+        std::lock_guard<std::mutex> lock(_impl->_mutex);
+        statistics.max_queue_depth.push_back(_impl->_maxQueueDepth);
+    }
+    return statistics;
+}
+
 CPUStreamsExecutor::CPUStreamsExecutor(const IStreamsExecutor::Config& config) : _impl{new Impl{config}} {}
 
 CPUStreamsExecutor::~CPUStreamsExecutor() {
@@ -513,6 +732,13 @@ CPUStreamsExecutor::~CPUStreamsExecutor() {
         _impl->_isStopped = true;
     }
     _impl->_queueCondVar.notify_all();
+    for (auto& group : _impl->_streamGroups) {
+        {
+            std::lock_guard<std::mutex> lock(group->_mutex);
+            group->_stopped = true;
+        }
+        group->_condVar.notify_all();
+    }
     for (auto& thread : _impl->_threads) {
         if (thread.joinable()) {
             thread.join();
@@ -532,5 +758,13 @@ void CPUStreamsExecutor::run(Task task) {
     }
 }
 
+void CPUStreamsExecutor::run_with_priority(Task task, const TaskPriority& priority) {
+    if (0 == _impl->_config.get_streams()) {
+        _impl->Defer(std::move(task));
+    } else {
+        _impl->Enqueue(std::move(task), priority);
+    }
+}
+
 }  // namespace threading
 }  // namespace ov
@@ -4,6 +4,7 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
 #include <future>
 #include <thread>
 
@@ -236,6 +237,21 @@ static auto Executors = ::testing::Values(
         return std::make_shared<CPUStreamsExecutor>(
             IStreamsExecutor::Config{"TestCPUStreamsExecutor", streams, threads / streams});
     },
+    [] {
+        auto streams = get_number_of_cpu_cores();
+        auto threads = parallel_get_max_threads();
+        return std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor",
+                                                                             streams,
+                                                                             threads / streams,
+                                                                             ov::hint::SchedulingCoreType::ANY_CORE,
+                                                                             false,
+                                                                             false,
+                                                                             true,
+                                                                             {},
+                                                                             {},
+                                                                             true,
+                                                                             true});
+    },
     [] {
         return std::make_shared<ImmediateExecutor>();
     });
@@ -260,6 +276,143 @@ static auto AsyncExecutors = ::testing::Values(
         auto threads = parallel_get_max_threads();
         return std::make_shared<CPUStreamsExecutor>(
             IStreamsExecutor::Config{"TestCPUStreamsExecutor", streams, threads / streams});
+    },
+    [] {
+        auto streams = get_number_of_cpu_cores();
+        auto threads = parallel_get_max_threads();
+        return std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor",
+                                                                             streams,
+                                                                             threads / streams,
+                                                                             ov::hint::SchedulingCoreType::ANY_CORE,
+                                                                             false,
+                                                                             false,
+                                                                             true,
+                                                                             {},
+                                                                             {},
+                                                                             true,
+                                                                             true});
     });
 
 INSTANTIATE_TEST_SUITE_P(ASyncTaskExecutorTests, ASyncTaskExecutorTests, AsyncExecutors);
+
+TEST(CPUStreamsExecutorWorkStealingTests, idleStreamStealsTasks) {
+    if (get_num_numa_nodes() > 1) {
+        GTEST_SKIP() << "The streams may belong to different NUMA nodes, so the tasks are not stolen between them";
+    }
+    constexpr int num_tasks = 16;
+    IStreamsExecutor::Config config{"TestCPUStreamsExecutor",
+                                    2,
+                                    1,
+                                    ov::hint::SchedulingCoreType::ANY_CORE,
+                                    false,
+                                    false,
+                                    true,
+                                    {},
+                                    {},
+                                    true,
+                                    true};
+    auto taskExecutor = std::make_shared<CPUStreamsExecutor>(config);
+    std::promise<void> other_tasks_done;
+    auto other_tasks_done_future = other_tasks_done.get_future().share();
+    std::atomic<int> executed{0};
+    std::vector<Future> futures;
+    // the tasks are queued to both streams in turn, the stream executing the first task is blocked until the rest of
+    // the tasks are executed by the other stream, so either the first task or the tasks queued after it are stolen
+    futures.emplace_back(async(taskExecutor, [&] {
+        other_tasks_done_future.wait();
+    }));
+    for (int i = 1; i < num_tasks; ++i) {
+        futures.emplace_back(async(taskExecutor, [&] {
+            if (++executed == num_tasks - 1) {
+                other_tasks_done.set_value();
+            }
+        }));
+    }
+    for (auto&& future : futures) {
+        OV_ASSERT_NO_THROW(future.get());
+    }
+    const auto statistics = taskExecutor->get_statistics();
+    ASSERT_EQ(static_cast<uint64_t>(num_tasks), statistics.tasks);
+    ASSERT_GE(statistics.steals, 1u);
+    ASSERT_EQ(2u, statistics.max_queue_depth.size());
+}
+
+TEST(CPUStreamsExecutorPriorityTests, tasksAreOrderedByPriorityAndDeadline) {
+    for (bool work_stealing : {false, true}) {
+        IStreamsExecutor::Config config{"TestCPUStreamsExecutor",
+                                        1,
+                                        1,
+                                        ov::hint::SchedulingCoreType::ANY_CORE,
+                                        false,
+                                        false,
+                                        true,
+                                        {},
+                                        {},
+                                        true,
+                                        work_stealing};
+        auto taskExecutor = std::make_shared<CPUStreamsExecutor>(config);
+        std::promise<void> started;
+        std::promise<void> blocked;
+        auto blocked_future = blocked.get_future().share();
+        std::mutex mutex;
+        std::vector<int> order;
+        std::vector<Future> futures;
+        // the only stream is blocked until all the tasks are queued
+        futures.emplace_back(async(taskExecutor, [&] {
+            started.set_value();
+            blocked_future.wait();
+        }));
+        started.get_future().wait();
+        auto run = [&](int id, TaskPriority priority) {
+            auto task = std::make_shared<std::packaged_task<void()>>([&, id] {
+                std::lock_guard<std::mutex> lock{mutex};
+                order.push_back(id);
+            });
+            futures.emplace_back(task->get_future());
+            taskExecutor->run_with_priority(
+                [task] {
+                    (*task)();
+                },
+                priority);
+        };
+        const auto now = TaskPriority::Clock::now();
+        const auto no_deadline = TaskPriority::Clock::time_point::max();
+        run(0, {});
+        run(1, {ov::hint::Priority::LOW, no_deadline});
+        run(2, {ov::hint::Priority::MEDIUM, now + std::chrono::hours(1)});
+        run(3, {ov::hint::Priority::HIGH, no_deadline});
+        run(4, {ov::hint::Priority::MEDIUM, now - std::chrono::milliseconds(1)});
+        run(5, {});
+        blocked.set_value();
+        for (auto&& future : futures) {
+            OV_ASSERT_NO_THROW(future.get());
+        }
+        ASSERT_EQ(std::vector<int>({3, 4, 2, 0, 5, 1}), order);
+        ASSERT_EQ(1u, taskExecutor->get_statistics().missed_deadlines);
+    }
+}
+
+TEST(CPUStreamsExecutorPriorityTests, missedDeadlineIsCountedOncePerInference) {
+    IStreamsExecutor::Config config{"TestCPUStreamsExecutor"};
+    auto taskExecutor = std::make_shared<CPUStreamsExecutor>(config);
+    auto run = [&](const TaskPriority& priority) {
+        auto task = std::make_shared<std::packaged_task<void()>>([] {});
+        auto future = task->get_future();
+        taskExecutor->run_with_priority(
+            [task] {
+                (*task)();
+            },
+            priority);
+        future.get();
+    };
+    const auto passed_deadline = TaskPriority::Clock::now() - std::chrono::milliseconds(1);
+    // two stages of the same inference
+    TaskPriority inference{ov::hint::Priority::MEDIUM, passed_deadline, std::make_shared<std::atomic_bool>(false)};
+    run(inference);
+    run(inference);
+    ASSERT_EQ(1u, taskExecutor->get_statistics().missed_deadlines);
+    // the tasks without the shared flag are counted one by one
+    run({ov::hint::Priority::MEDIUM, passed_deadline});
+    run({ov::hint::Priority::MEDIUM, passed_deadline});
+    ASSERT_EQ(3u, taskExecutor->get_statistics().missed_deadlines);
+}
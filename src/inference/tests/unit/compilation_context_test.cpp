@@ -8,16 +8,20 @@
 
 #include <chrono>
 #include <fstream>
+#include <numeric>
 #include <string>
 #include <thread>
+#include <vector>
 
 #include "common_test_utils/common_utils.hpp"
 #include "common_test_utils/test_constants.hpp"
 #include "openvino/core/preprocess/pre_post_process.hpp"
+#include "openvino/core/rt_info/weightless_caching_attributes.hpp"
 #include "openvino/op/add.hpp"
 #include "openvino/op/constant.hpp"
 #include "openvino/op/multiply.hpp"
 #include "openvino/op/parameter.hpp"
+#include "openvino/util/file_util.hpp"
 #include "transformations/rt_info/fused_names_attribute.hpp"
 #include "transformations/rt_info/primitives_priority_attribute.hpp"
 
@@ -381,6 +385,46 @@ TEST(NetworkContext_ModelName, HashOfExistingFile) {
               ov::ModelCache::compute_hash(file2, {{"key", "value"}}));
 }
 
+TEST(NetworkContext, HashOfWeightsFileConstantIsMemoized) {
+    auto weights_path = ov::test::utils::generateTestFilePrefix() + ".bin";
+    FileGuard guard(weights_path);
+    {
+        std::ofstream os(weights_path, std::ios::binary);
+        os << "weights";
+    }
+
+    // bigger than the data edges hashed on every lookup
+    std::vector<float> values(16 * 1024);
+    std::iota(values.begin(), values.end(), 0.f);
+    auto constant = std::make_shared<ov::op::v0::Constant>(ov::element::f32, ov::Shape{values.size()}, values);
+    constant->get_rt_info()[ov::WeightlessCacheAttribute::get_type_info_static()] =
+        ov::WeightlessCacheAttribute(constant->get_byte_size(), 0, ov::element::f32);
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{values.size()});
+    auto add = std::make_shared<ov::op::v1::Add>(param, constant);
+    auto model = std::make_shared<ov::Model>(ov::OutputVector{add}, ov::ParameterVector{param});
+    auto& rt_info = model->get_rt_info();
+    rt_info["__weights_path"] = weights_path;
+    rt_info["__weights_fingerprint"] = ov::util::get_file_fingerprint(weights_path);
+
+    const auto hash = ov::ModelCache::compute_hash(model, {});
+    // the memo is hit while the weights file is unchanged, so the data in between the edges is not hashed again
+    const_cast<float*>(constant->get_data_ptr<float>())[values.size() / 2] = -1.f;
+    ASSERT_EQ(hash, ov::ModelCache::compute_hash(model, {}));
+
+    // the weights file version taken at the reading doesn't match the file anymore
+    {
+        std::ofstream os(weights_path, std::ios::binary | std::ios::app);
+        os << "changed";
+    }
+    const auto changed_hash = ov::ModelCache::compute_hash(model, {});
+    ASSERT_NE(hash, changed_hash);
+
+    // the memo keyed by the new file version is filled with the actual data
+    rt_info["__weights_fingerprint"] = ov::util::get_file_fingerprint(weights_path);
+    ASSERT_EQ(changed_hash, ov::ModelCache::compute_hash(model, {}));
+    ASSERT_EQ(changed_hash, ov::ModelCache::compute_hash(model, {}));
+}
+
 TEST(NetworkContext, HashOfSameModelWithClone) {
     auto model1 = create_simple_model();
     // test model with friendly name
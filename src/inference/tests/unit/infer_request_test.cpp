@@ -148,3 +148,22 @@ TEST_F(OVInferRequestBaseTests, canReportErrorInSetCompletionCallback) {
     EXPECT_CALL(*mock_impl.get(), set_callback(_)).WillOnce(Throw(std::runtime_error("compare")));
     OV_EXPECT_THROW_HAS_SUBSTRING(request.set_callback(nullptr), std::runtime_error, "compare");
 }
+
+// set_property
+TEST_F(OVInferRequestBaseTests, canForwardSetProperty) {
+    EXPECT_CALL(*mock_impl.get(), set_property(_)).Times(1);
+    OV_ASSERT_NO_THROW(request.set_property(ov::hint::request_priority(ov::hint::Priority::HIGH)));
+}
+
+TEST_F(OVInferRequestBaseTests, canReportErrorInSetProperty) {
+    EXPECT_CALL(*mock_impl.get(), set_property(_)).WillOnce(Throw(std::runtime_error("compare")));
+    OV_EXPECT_THROW_HAS_SUBSTRING(request.set_property(ov::hint::request_deadline(10)), std::runtime_error, "compare");
+}
+
+// get_property
+TEST_F(OVInferRequestBaseTests, canForwardGetProperty) {
+    EXPECT_CALL(*mock_impl.get(), get_property(_)).WillOnce(Return(ov::Any(ov::hint::Priority::HIGH)));
+    ov::hint::Priority priority = ov::hint::Priority::LOW;
+    OV_ASSERT_NO_THROW(priority = request.get_property(ov::hint::request_priority));
+    ASSERT_EQ(ov::hint::Priority::HIGH, priority);
+}
@@ -78,6 +78,10 @@ struct ThisRequestExecutor : public ov::threading::ITaskExecutor {
         (*m_workptrptr)->m_fallback_exec = m_fallback_exec;
         (*m_workptrptr)->m_inferrequest->start_async();
     };
+    void run_with_priority(ov::threading::Task task, const ov::threading::TaskPriority& priority) override {
+        (*m_workptrptr)->m_inferrequest->set_property(ov::IAsyncInferRequest::get_request_properties(priority));
+        run(std::move(task));
+    }
     WorkerInferRequest** m_workptrptr = nullptr;
     AutoImmediateExecutor::Ptr m_fallback_exec;
 };
@@ -176,6 +176,10 @@ Pipeline Schedule::get_async_pipeline(const ISyncInferPtr& infer_request, Worker
             });
                 m_inferrequest->start_async();
             };
+            void run_with_priority(ov::threading::Task task, const ov::threading::TaskPriority& priority) override {
+                m_inferrequest->set_property(ov::IAsyncInferRequest::get_request_properties(priority));
+                run(std::move(task));
+            }
             const SoAsyncInferRequest& m_inferrequest;
             std::exception_ptr m_exceptionptr;
             ov::threading::Task m_task;
@@ -6,6 +6,8 @@
 
 #include "async_infer_request.hpp"
 
+#include "batching_policy.hpp"
+
 namespace ov {
 namespace autobatch_plugin {
 
@@ -45,6 +47,10 @@ AsyncInferRequest::AsyncInferRequest(const std::shared_ptr<SyncInferRequest>& re
                 m_task = std::move(task);
                 m_inferrequest->start_async();
             };
+            void run_with_priority(ov::threading::Task task, const ov::threading::TaskPriority& priority) override {
+                m_inferrequest->set_property(ov::IAsyncInferRequest::get_request_properties(priority));
+                run(std::move(task));
+            }
             const ov::SoPtr<ov::IAsyncInferRequest>& m_inferrequest;
             std::exception_ptr m_exceptionptr;
             ov::threading::Task m_task;
@@ -65,14 +71,21 @@ AsyncInferRequest::AsyncInferRequest(const std::shared_ptr<SyncInferRequest>& re
                 std::pair<AsyncInferRequest*, ov::threading::Task> t;
                 t.first = _this;
                 t.second = std::move(task);
+                if (workerInferRequest->_batching_policy)
+                    workerInferRequest->_batching_policy->on_arrival();
                 workerInferRequest->_tasks.push(t);
                 // it is ok to call size() here as the queue only grows (and the bulk removal happens under the mutex)
                 const int sz = static_cast<int>(workerInferRequest->_tasks.size());
-                if (sz == workerInferRequest->_batch_size) {
+                // with the adaptive timeout the worker starts counting it from the first request of the batch
+                if (sz == workerInferRequest->_batch_size || (workerInferRequest->_batching_policy && sz == 1)) {
                     workerInferRequest->_is_wakeup = true;
                     workerInferRequest->_cond.notify_one();
                 }
             };
+            void run_with_priority(ov::threading::Task task, const ov::threading::TaskPriority& priority) override {
+                _this->m_task_priority = priority;
+                run(std::move(task));
+            }
             AsyncInferRequest* _this = nullptr;
         };
         m_pipeline = {
@@ -32,6 +32,9 @@ public:
                      const std::vector<ov::SoPtr<ov::ITensor>>& tensors) override;
 
     ov::SoPtr<ov::IAsyncInferRequest> m_request_without_batch;
+
+    // the scheduling attributes of the ongoing inference, passed to the request executing it
+    ov::threading::TaskPriority m_task_priority;
 };
 }  // namespace autobatch_plugin
 }  // namespace ov
\ No newline at end of file
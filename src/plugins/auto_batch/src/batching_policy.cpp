@@ -0,0 +1,117 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include "batching_policy.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <set>
+
+#include "openvino/core/except.hpp"
+
+namespace ov {
+namespace autobatch_plugin {
+
+void BatchingPolicy::Estimate::update(double value) {
+    if (!m_valid) {
+        m_mean = value;
+        m_deviation = value / 2;
+        m_valid = true;
+        return;
+    }
+    m_deviation = 0.75 * m_deviation + 0.25 * std::abs(value - m_mean);
+    m_mean = 0.875 * m_mean + 0.125 * value;
+}
+
+BatchingPolicy::BatchingPolicy(uint32_t latency_target_ms, std::vector<uint32_t> batch_sizes)
+    : m_latency_target(latency_target_ms),
+      m_batch_sizes([&batch_sizes] {
+          std::sort(batch_sizes.begin(), batch_sizes.end());
+          batch_sizes.erase(std::unique(batch_sizes.begin(), batch_sizes.end()), batch_sizes.end());
+          return std::move(batch_sizes);
+      }()) {
+    OPENVINO_ASSERT(!m_batch_sizes.empty() && m_batch_sizes.front() > 0, "Invalid batch sizes for the batching policy");
+}
+
+void BatchingPolicy::on_arrival(Clock::time_point time) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_has_arrival) {
+        m_interarrival.update(std::chrono::duration<double, std::milli>(time - m_last_arrival).count());
+    }
+    m_last_arrival = time;
+    m_has_arrival = true;
+}
+
+void BatchingPolicy::on_executed(uint32_t batch_size, Clock::duration latency) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_execution_latency[batch_size].update(std::chrono::duration<double, std::milli>(latency).count());
+}
+
+double BatchingPolicy::get_execution_latency(uint32_t batch_size) const {
+    for (auto it = m_execution_latency.lower_bound(batch_size); it != m_execution_latency.end(); ++it) {
+        if (it->second.valid())
+            return it->second.upper();
+    }
+    // only smaller batches were measured, assume the latency grows linearly with the batch size
+    for (auto it = m_execution_latency.rbegin(); it != m_execution_latency.rend(); ++it) {
+        if (it->second.valid())
+            return it->second.upper() * batch_size / it->first;
+    }
+    // nothing is measured yet, leave the half of the target to the execution
+    return m_latency_target / 2.0;
+}
+
+std::chrono::milliseconds BatchingPolicy::get_timeout() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto get_budget = [this](uint32_t batch_size) {
+        return std::max(0.0, m_latency_target - get_execution_latency(batch_size));
+    };
+    auto to_timeout = [](double ms) {
+        return std::chrono::milliseconds(static_cast<int64_t>(ms));
+    };
+
+    const auto max_batch_size = m_batch_sizes.back();
+    const auto budget = get_budget(max_batch_size);
+    if (!m_interarrival.valid() || m_interarrival.mean() <= 0)
+        return to_timeout(budget);
+
+    // the number of requests expected to be collected by the end of the budget
+    const auto expected = 1 + budget / m_interarrival.mean();
+    if (expected >= max_batch_size)
+        return to_timeout(budget);
+    if (expected < 2)
+        return to_timeout(0);  // no more requests are expected in time, no reason to wait
+    // the batch is not going to fill, collect what is possible for the intermediate batch size
+    return to_timeout(get_budget(select_batch_size(static_cast<uint32_t>(expected))));
+}
+
+uint32_t BatchingPolicy::select_batch_size(uint32_t num_requests) const {
+    auto it = std::lower_bound(m_batch_sizes.begin(), m_batch_sizes.end(), num_requests);
+    return it == m_batch_sizes.end() ? m_batch_sizes.back() : *it;
+}
+
+std::vector<uint32_t> BatchingPolicy::split(uint32_t num_requests) const {
+    std::vector<uint32_t> batches;
+    // the intermediate sizes only: the largest one is shared by all the worker slots
+    std::set<uint32_t> available;
+    for (auto batch_size : m_batch_sizes) {
+        if (batch_size > 1 && batch_size < m_batch_sizes.back())
+            available.insert(batch_size);
+    }
+    while (num_requests > 1 && !available.empty()) {
+        // the smallest batch fitting all the requests, otherwise the largest one
+        auto it = available.lower_bound(num_requests);
+        if (it == available.end())
+            --it;
+        batches.push_back(*it);
+        num_requests -= std::min(*it, num_requests);
+        available.erase(it);
+    }
+    batches.insert(batches.end(), num_requests, 1);
+    return batches;
+}
+
+}  // namespace autobatch_plugin
+}  // namespace ov
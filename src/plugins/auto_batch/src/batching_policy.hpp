@@ -0,0 +1,94 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include "plugin.hpp"
+
+namespace ov {
+namespace autobatch_plugin {
+
+/**
+ * @brief Chooses when to flush the collected requests and which compiled batch size to execute them with,
+ * so the p99 latency (collection + execution) stays within the target while the batches are as large as possible.
+ * The request inter-arrival time and the execution latency per batch size are tracked online.
+ */
+class BatchingPolicy {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @param latency_target_ms p99 latency target of a single request
+     * @param batch_sizes the compiled batch sizes, the largest one is the batch size of the worker requests
+     */
+    BatchingPolicy(uint32_t latency_target_ms, std::vector<uint32_t> batch_sizes);
+
+    void on_arrival(Clock::time_point time = Clock::now());
+
+    void on_executed(uint32_t batch_size, Clock::duration latency);
+
+    /**
+     * @brief Returns how long the collected requests may wait for the batch to fill
+     */
+    std::chrono::milliseconds get_timeout() const;
+
+    /**
+     * @brief Returns the smallest compiled batch size fitting the collected requests
+     */
+    uint32_t select_batch_size(uint32_t num_requests) const;
+
+    /**
+     * @brief Splits the requests collected by the timeout (less than the largest batch size) into the batches of the
+     * intermediate compiled sizes, each size is used at most once. The remaining requests are returned as the batches
+     * of size 1.
+     */
+    std::vector<uint32_t> split(uint32_t num_requests) const;
+
+    uint32_t get_latency_target() const {
+        return m_latency_target;
+    }
+
+private:
+    // Mean and mean deviation smoothed the same way as the TCP round trip time (RFC 6298),
+    // the upper estimate (mean + 4 * deviation) is used as the p99 approximation
+    struct Estimate {
+        void update(double value);
+        double upper() const {
+            return m_mean + 4 * m_deviation;
+        }
+        bool valid() const {
+            return m_valid;
+        }
+        double mean() const {
+            return m_mean;
+        }
+
+    private:
+        double m_mean = 0;
+        double m_deviation = 0;
+        bool m_valid = false;
+    };
+
+    // p99 execution latency (ms) of the batch size, falls back to the closest measured larger size
+    double get_execution_latency(uint32_t batch_size) const;
+
+    const uint32_t m_latency_target;
+    const std::vector<uint32_t> m_batch_sizes;
+
+    mutable std::mutex m_mutex;
+    std::map<uint32_t, Estimate> m_execution_latency;  // ms
+    Estimate m_interarrival;                            // ms
+    Clock::time_point m_last_arrival;
+    bool m_has_arrival = false;
+};
+
+}  // namespace autobatch_plugin
+}  // namespace ov
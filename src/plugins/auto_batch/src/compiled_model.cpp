@@ -5,10 +5,26 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #include "compiled_model.hpp"
 
+#include <algorithm>
+
 #include "async_infer_request.hpp"
+#include "batching_policy.hpp"
+#include "openvino/runtime/make_tensor.hpp"
 
 namespace ov {
 namespace autobatch_plugin {
+namespace {
+// the requests executed together run with the most urgent scheduling attributes of them
+ov::AnyMap get_request_properties(
+    const std::vector<std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task>>& tasks) {
+    ov::threading::TaskPriority priority;
+    for (const auto& task : tasks) {
+        priority.priority = std::max(priority.priority, task.first->m_task_priority.priority);
+        priority.deadline = std::min(priority.deadline, task.first->m_task_priority.deadline);
+    }
+    return ov::IAsyncInferRequest::get_request_properties(priority);
+}
+}  // namespace
 CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
                              const std::shared_ptr<const ov::IPlugin>& plugin,
                              const ov::AnyMap& config,
@@ -17,18 +33,35 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
                              const std::set<std::size_t>& batched_outputs,
                              const ov::SoPtr<ov::ICompiledModel>& compiled_model_with_batch,
                              const ov::SoPtr<ov::ICompiledModel>& compiled_model_without_batch,
-                             const ov::SoPtr<ov::IRemoteContext>& context)
+                             const ov::SoPtr<ov::IRemoteContext>& context,
+                             const std::map<uint32_t, ov::SoPtr<ov::ICompiledModel>>& compiled_models_partial_batch)
     : ov::ICompiledModel(model, plugin, context),
       m_config(config),
       m_batched_inputs(batched_inputs),
       m_batched_outputs(batched_outputs),
       m_compiled_model_with_batch(compiled_model_with_batch),
-      m_compiled_model_without_batch(compiled_model_without_batch) {
+      m_compiled_model_without_batch(compiled_model_without_batch),
+      m_compiled_models_partial_batch(compiled_models_partial_batch) {
     // WA for gcc 4.8 ( fails compilation with member init-list)
     m_device_info = device_info;
     auto time_out = config.find(ov::auto_batch_timeout.name());
     OPENVINO_ASSERT(time_out != config.end(), "No timeout property be set in config, default will be used!");
     m_time_out = time_out->second.as<std::uint32_t>();
+    for (const auto& input_id : m_batched_inputs) {
+        if (m_compiled_model_with_batch && input_id < model->inputs().size() &&
+            model->input(input_id).get_partial_shape()[0].is_dynamic())
+            m_dynamic_batch = true;
+    }
+    auto latency_target = config.find(ov::auto_batch_latency_target.name());
+    if (m_compiled_model_with_batch && latency_target != config.end() && latency_target->second.as<uint32_t>() > 0) {
+        std::vector<uint32_t> batch_sizes = {1, m_device_info.device_batch_size};
+        for (const auto& compiled_model : m_compiled_models_partial_batch)
+            batch_sizes.push_back(compiled_model.first);
+        // any number of the requests is executed at once with the dynamic batch
+        for (uint32_t batch_size = 2; m_dynamic_batch && batch_size < m_device_info.device_batch_size; batch_size++)
+            batch_sizes.push_back(batch_size);
+        m_batching_policy = std::make_shared<BatchingPolicy>(latency_target->second.as<uint32_t>(), batch_sizes);
+    }
 }
 
 CompiledModel::~CompiledModel() {
@@ -65,10 +98,34 @@ CompiledModel::GetWorkerInferRequest() const {
         workerRequestPtr->_batch_size = m_device_info.device_batch_size;
         workerRequestPtr->_completion_tasks.resize(workerRequestPtr->_batch_size);
         workerRequestPtr->_is_wakeup = false;
+        workerRequestPtr->_batching_policy = m_batching_policy;
+        for (const auto& compiled_model : m_compiled_models_partial_batch) {
+            auto& request = workerRequestPtr->_infer_requests_partial_batch[compiled_model.first];
+            request = {compiled_model.second->create_infer_request(), compiled_model.second._so};
+        }
+        if (m_dynamic_batch) {
+            auto create_batch_tensors = [this](const std::vector<ov::Output<const ov::Node>>& ports,
+                                               const std::set<std::size_t>& batched_ports) {
+                std::vector<ov::SoPtr<ov::ITensor>> tensors;
+                for (size_t port_id = 0; port_id < ports.size(); port_id++) {
+                    auto shape = ports[port_id].get_partial_shape();
+                    if (batched_ports.count(port_id))
+                        shape[0] = m_device_info.device_batch_size;
+                    tensors.push_back({ov::make_tensor(ports[port_id].get_element_type(), shape.to_shape()), nullptr});
+                }
+                return tensors;
+            };
+            workerRequestPtr->_dynamic_batch_inputs = create_batch_tensors(inputs(), m_batched_inputs);
+            workerRequestPtr->_dynamic_batch_outputs = create_batch_tensors(outputs(), m_batched_outputs);
+        }
         workerRequestPtr->_infer_request_batched->set_callback(
             [workerRequestPtr](std::exception_ptr exceptionPtr) mutable {
                 if (exceptionPtr)
                     workerRequestPtr->_exception_ptr = exceptionPtr;
+                if (workerRequestPtr->_batching_policy)
+                    workerRequestPtr->_batching_policy->on_executed(
+                        workerRequestPtr->_batch_size,
+                        std::chrono::steady_clock::now() - workerRequestPtr->_start_time);
                 OPENVINO_ASSERT(workerRequestPtr->_completion_tasks.size() == (size_t)workerRequestPtr->_batch_size);
                 // notify the individual requests on the completion
                 for (int c = 0; c < workerRequestPtr->_batch_size; c++) {
@@ -84,7 +141,11 @@ CompiledModel::GetWorkerInferRequest() const {
                 std::cv_status status;
                 {
                     std::unique_lock<std::mutex> lock(workerRequestPtr->_mutex);
-                    status = workerRequestPtr->_cond.wait_for(lock, std::chrono::milliseconds(m_time_out));
+                    auto time_out = std::chrono::milliseconds(m_time_out);
+                    // the adaptive timeout counts from the first collected request (the worker is notified on it)
+                    if (m_batching_policy && workerRequestPtr->_tasks.size())
+                        time_out = m_batching_policy->get_timeout();
+                    status = workerRequestPtr->_cond.wait_for(lock, time_out);
                     if ((status != std::cv_status::timeout) && (workerRequestPtr->_is_wakeup == false))
                         continue;
                     workerRequestPtr->_is_wakeup = false;
@@ -95,25 +156,61 @@ CompiledModel::GetWorkerInferRequest() const {
                     // as we pop the tasks from the queue only here
                     // it is ok to call size() (as the _tasks can only grow in parallel)
                     const int sz = static_cast<int>(workerRequestPtr->_tasks.size());
-                    if (sz == workerRequestPtr->_batch_size) {
-                        std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task> t;
+                    const bool is_full = sz == workerRequestPtr->_batch_size;
+                    if (is_full && !m_dynamic_batch) {
+                        std::vector<std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task>> tasks(
+                            sz);
                         for (int n = 0; n < sz; n++) {
+                            auto& t = tasks[n];
                             OPENVINO_ASSERT(workerRequestPtr->_tasks.try_pop(t));
                             workerRequestPtr->_completion_tasks[n] = std::move(t.second);
                             t.first->m_sync_request->copy_inputs_if_needed();
                             t.first->m_sync_request->m_batched_request_status =
                                 ov::autobatch_plugin::SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED;
                         }
+                        workerRequestPtr->_infer_request_batched->set_property(get_request_properties(tasks));
+                        workerRequestPtr->_start_time = std::chrono::steady_clock::now();
                         workerRequestPtr->_infer_request_batched->start_async();
-                    } else if ((status == std::cv_status::timeout) && sz) {
+                    } else if ((status == std::cv_status::timeout || is_full) && sz) {
                         // timeout to collect the batch is over, have to execute the requests in the batch1 mode
+                        // (or with the intermediate batch sizes, when compiled)
                         std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task> t;
-                        // popping all tasks collected by the moment of the time-out and execute each with batch1
+                        // popping all tasks collected by the moment of the time-out
+                        std::vector<std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task>> tasks;
+                        bool has_remote_tensors = false;
+                        for (int n = 0; n < sz; n++) {
+                            OPENVINO_ASSERT(workerRequestPtr->_tasks.try_pop(t));
+                            has_remote_tensors = has_remote_tensors || t.first->m_sync_request->has_remote_tensors();
+                            tasks.push_back(std::move(t));
+                        }
+                        if (m_dynamic_batch && !has_remote_tensors) {
+                            ExecuteDynamicBatch(*workerRequestPtr, std::move(tasks));
+                            continue;
+                        }
+                        // the remote tensors can't be copied to the batch by the host, so these go with batch1
+                        std::vector<uint32_t> batches(sz, 1);
+                        if (m_batching_policy && !has_remote_tensors)
+                            batches = m_batching_policy->split(sz);
                         std::atomic<int> arrived = {0};
                         std::promise<void> all_completed;
                         auto all_completed_future = all_completed.get_future();
-                        for (int n = 0; n < sz; n++) {
-                            OPENVINO_ASSERT(workerRequestPtr->_tasks.try_pop(t));
+                        auto next_task = tasks.begin();
+                        for (const auto batch_size : batches) {
+                            if (batch_size > 1) {
+                                const auto num_tasks = std::min<ptrdiff_t>(batch_size, tasks.end() - next_task);
+                                std::vector<std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task>>
+                                    batch_tasks(next_task, next_task + num_tasks);
+                                next_task += num_tasks;
+                                ExecutePartialBatch(workerRequestPtr->_infer_requests_partial_batch.at(batch_size),
+                                                    std::move(batch_tasks),
+                                                    batch_size,
+                                                    [sz, num_tasks, &arrived, &all_completed] {
+                                                        if (sz == (arrived += static_cast<int>(num_tasks)))
+                                                            all_completed.set_value();
+                                                    });
+                                continue;
+                            }
+                            t = *next_task++;
                             t.first->m_request_without_batch->set_callback(
                                 [t, sz, &arrived, &all_completed](std::exception_ptr p) {
                                     if (p)
@@ -126,6 +223,8 @@ CompiledModel::GetWorkerInferRequest() const {
                             t.first->m_sync_request->m_batched_request_status =
                                 ov::autobatch_plugin::SyncInferRequest::eExecutionFlavor::TIMEOUT_EXECUTED;
                             t.first->m_sync_request->set_tensors_to_another_request(t.first->m_request_without_batch);
+                            t.first->m_request_without_batch->set_property(
+                                ov::IAsyncInferRequest::get_request_properties(t.first->m_task_priority));
                             t.first->m_request_without_batch->start_async();
                         }
                         all_completed_future.get();
@@ -138,6 +237,78 @@ CompiledModel::GetWorkerInferRequest() const {
     return {m_worker_requests.back(), static_cast<int>(batch_id)};
 }
 
+void CompiledModel::ExecutePartialBatch(
+    ov::SoPtr<ov::IAsyncInferRequest>& request,
+    std::vector<std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task>> tasks,
+    uint32_t batch_size,
+    std::function<void()> on_completed) const {
+    for (size_t n = 0; n < tasks.size(); n++) {
+        tasks[n].first->m_sync_request->copy_inputs_to_batch(request, n, batch_size);
+        tasks[n].first->m_sync_request->m_batched_request_status =
+            ov::autobatch_plugin::SyncInferRequest::eExecutionFlavor::PARTIAL_BATCH_EXECUTED;
+    }
+    auto policy = m_batching_policy;
+    const auto start_time = std::chrono::steady_clock::now();
+    request->set_callback([tasks, batch_size, start_time, policy, on_completed, &request](std::exception_ptr p) {
+        if (policy)
+            policy->on_executed(batch_size, std::chrono::steady_clock::now() - start_time);
+        for (size_t n = 0; n < tasks.size(); n++) {
+            auto& sync_request = tasks[n].first->m_sync_request;
+            if (p)
+                sync_request->m_exception_ptr = p;
+            else
+                sync_request->copy_outputs_from_batch(request, n, batch_size);
+            tasks[n].second();
+        }
+        on_completed();
+    });
+    request->set_property(get_request_properties(tasks));
+    request->start_async();
+}
+
+void CompiledModel::ExecuteDynamicBatch(
+    WorkerInferRequest& worker_request,
+    std::vector<std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task>> tasks) const {
+    std::sort(tasks.begin(), tasks.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.first->m_sync_request->get_batch_id() < rhs.first->m_sync_request->get_batch_id();
+    });
+    const auto batch_size = tasks.size();
+    const auto first_batch_id = tasks.front().first->m_sync_request->get_batch_id();
+    // the requests of the adjacent slots share the memory of the full batch tensors, so no copy is needed
+    const bool is_contiguous = tasks.back().first->m_sync_request->get_batch_id() - first_batch_id + 1 == batch_size;
+    auto& request = worker_request._infer_request_batched;
+    auto set_batch_tensors = [&](const std::vector<ov::Output<const ov::Node>>& ports,
+                                 const std::vector<ov::SoPtr<ov::ITensor>>& batch_tensors,
+                                 const std::set<std::size_t>& batched_ports) {
+        for (size_t port_id = 0; port_id < ports.size(); port_id++) {
+            const auto& batch_tensor = batch_tensors[port_id];
+            if (!batched_ports.count(port_id)) {
+                request->set_tensor(ports[port_id], batch_tensor);
+                continue;
+            }
+            auto shape = batch_tensor->get_shape();
+            const auto size_per_batch = batch_tensor->get_byte_size() / shape[0];
+            shape[0] = batch_size;
+            auto ptr = static_cast<uint8_t*>(batch_tensor->data()) + size_per_batch * first_batch_id;
+            request->set_tensor(ports[port_id],
+                                {is_contiguous ? ov::make_tensor(batch_tensor->get_element_type(), shape, ptr)
+                                               : ov::make_tensor(batch_tensor->get_element_type(), shape),
+                                 nullptr});
+        }
+    };
+    set_batch_tensors(inputs(), worker_request._dynamic_batch_inputs, m_batched_inputs);
+    set_batch_tensors(outputs(), worker_request._dynamic_batch_outputs, m_batched_outputs);
+    m_dynamic_batch_executions++;
+
+    std::promise<void> completed;
+    auto completed_future = completed.get_future();
+    ExecutePartialBatch(request, std::move(tasks), static_cast<uint32_t>(batch_size), [&completed] {
+        completed.set_value();
+    });
+    // the batched request is busy until the completion
+    completed_future.get();
+}
+
 std::shared_ptr<ov::IAsyncInferRequest> CompiledModel::create_infer_request() const {
     ov::SoPtr<ov::IAsyncInferRequest> infer_request_without_batch = {
         m_compiled_model_without_batch->create_infer_request(),
@@ -212,7 +383,10 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
                 ov::PropertyName{ov::optimal_number_of_infer_requests.name(), ov::PropertyMutability::RO},
                 ov::PropertyName{ov::model_name.name(), ov::PropertyMutability::RO},
                 ov::PropertyName{ov::execution_devices.name(), ov::PropertyMutability::RO},
-                ov::PropertyName{ov::auto_batch_timeout.name(), ov::PropertyMutability::RW}};
+                ov::PropertyName{ov::auto_batch_timeout.name(), ov::PropertyMutability::RW},
+                ov::PropertyName{ov::auto_batch_latency_target.name(), ov::PropertyMutability::RO}};
+        } else if (name == dynamic_batch_executions) {
+            return m_dynamic_batch_executions.load();
         } else if (name == ov::auto_batch_timeout) {
             uint32_t time_out = m_time_out;
             return time_out;
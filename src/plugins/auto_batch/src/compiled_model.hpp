@@ -5,7 +5,10 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #pragma once
 
+#include <atomic>
 #include <condition_variable>
+#include <functional>
+#include <map>
 #include <thread>
 
 #include "openvino/runtime/iasync_infer_request.hpp"
@@ -17,6 +20,12 @@ namespace ov {
 namespace autobatch_plugin {
 
 class AsyncInferRequest;
+class BatchingPolicy;
+
+// the number of the executions of the stitched requests of the model with the dynamic batch dim (not the batch1
+// fallbacks), for the diagnostics and the tests
+static constexpr ov::Property<uint64_t, ov::PropertyMutability::RO> dynamic_batch_executions{
+    "AUTO_BATCH_DYNAMIC_BATCH_EXECUTIONS"};
 
 class CompiledModel : public ov::ICompiledModel {
 public:
@@ -31,6 +40,13 @@ public:
         std::mutex _mutex;
         std::exception_ptr _exception_ptr;
         bool _is_wakeup;
+        // requests compiled with the intermediate batch sizes to execute the partially collected batches
+        std::map<uint32_t, ov::SoPtr<ov::IAsyncInferRequest>> _infer_requests_partial_batch;
+        std::chrono::steady_clock::time_point _start_time;
+        std::shared_ptr<BatchingPolicy> _batching_policy;
+        // the dynamic batch: the tensors of the full batch, the requests own the views into their slots
+        std::vector<ov::SoPtr<ov::ITensor>> _dynamic_batch_inputs;
+        std::vector<ov::SoPtr<ov::ITensor>> _dynamic_batch_outputs;
     };
 
     CompiledModel(const std::shared_ptr<ov::Model>& model,
@@ -41,7 +57,8 @@ public:
                   const std::set<std::size_t>& batched_outputs,
                   const ov::SoPtr<ov::ICompiledModel>& compiled_model_with_batch,
                   const ov::SoPtr<ov::ICompiledModel>& compiled_model_without_batch,
-                  const ov::SoPtr<ov::IRemoteContext>& context);
+                  const ov::SoPtr<ov::IRemoteContext>& context,
+                  const std::map<uint32_t, ov::SoPtr<ov::ICompiledModel>>& compiled_models_partial_batch = {});
 
     void set_property(const ov::AnyMap& properties) override;
 
@@ -68,6 +85,14 @@ protected:
 
     std::pair<std::shared_ptr<ov::autobatch_plugin::CompiledModel::WorkerInferRequest>, int> GetWorkerInferRequest()
         const;
+    // executes the requests collected by the timeout with the request of the intermediate batch size
+    void ExecutePartialBatch(ov::SoPtr<ov::IAsyncInferRequest>& request,
+                             std::vector<std::pair<AsyncInferRequest*, ov::threading::Task>> tasks,
+                             uint32_t batch_size,
+                             std::function<void()> on_completed) const;
+    // stitches the collected requests into the single request of the model with the dynamic batch dim
+    void ExecuteDynamicBatch(WorkerInferRequest& worker_request,
+                             std::vector<std::pair<AsyncInferRequest*, ov::threading::Task>> tasks) const;
     mutable std::vector<std::shared_ptr<WorkerInferRequest>> m_worker_requests;
     mutable std::mutex m_worker_requests_mutex;
 
@@ -79,6 +104,12 @@ protected:
 
     ov::SoPtr<ov::ICompiledModel> m_compiled_model_with_batch;
     ov::SoPtr<ov::ICompiledModel> m_compiled_model_without_batch;
+    std::map<uint32_t, ov::SoPtr<ov::ICompiledModel>> m_compiled_models_partial_batch;
+    // set when the auto_batch_latency_target is, replaces the fixed timeout
+    std::shared_ptr<BatchingPolicy> m_batching_policy;
+    // the model has the dynamic batch dim, so m_compiled_model_with_batch is the same as the one without batch
+    bool m_dynamic_batch = false;
+    mutable std::atomic<uint64_t> m_dynamic_batch_executions = {0};
 };
 }  // namespace autobatch_plugin
 }  // namespace ov
@@ -22,6 +22,7 @@ namespace autobatch_plugin {
 std::vector<ov::PropertyName> supported_configKeys = {
     ov::PropertyName{ov::device::priorities.name(), ov::PropertyMutability::RW},
     ov::PropertyName{ov::auto_batch_timeout.name(), ov::PropertyMutability::RW},
+    ov::PropertyName{ov::auto_batch_latency_target.name(), ov::PropertyMutability::RW},
     ov::PropertyName{ov::enable_profiling.name(), ov::PropertyMutability::RW}};
 
 inline ov::AnyMap merge_properties(ov::AnyMap config, const ov::AnyMap& user_config) {
@@ -117,7 +118,8 @@ OV_DEFINE_PLUGIN_CREATE_FUNCTION(Plugin, version)
 
 Plugin::Plugin() {
     set_device_name("BATCH");
-    m_plugin_config.insert(ov::auto_batch_timeout(1000));  // default value (ms)
+    m_plugin_config.insert(ov::auto_batch_timeout(1000));      // default value (ms)
+    m_plugin_config.insert(ov::auto_batch_latency_target(0));  // adaptive batching is off by default
     m_plugin_config.insert(ov::enable_profiling(false));
 }
 
@@ -150,6 +152,8 @@ std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<
 
     std::set<std::size_t> batched_inputs;
     std::set<std::size_t> batched_outputs;
+    // the model with the dynamic batch dim is executed with any number of the collected requests as is
+    bool dynamic_batch = false;
     // check that the auto-batching is applicable in general
     try {
         // if applicable, the Auto-Batching is implicitly enabled via the performance hints
@@ -168,20 +172,31 @@ std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<
         pass_manager.run_passes(cloned_model);
         // do not reshape/re-batch originally batched networks and when there are no inputs with the N* layouts
         // input(s) should have the batch dim as the first dim (current limitation of the auto-batching impl)
+        // the batch dim is the only dynamic dim supported,
+        // either all the batched inputs/outputs have it dynamic or none of them
+        auto check_dynamic_dims = [&dynamic_batch](const ov::PartialShape& shape, bool batched) {
+            if (shape.rank().is_dynamic())
+                OPENVINO_THROW("Auto-batching does not support dynamic networks!");
+            for (size_t s = batched ? 1 : 0; s < shape.size(); s++)
+                if (shape[s].is_dynamic())
+                    OPENVINO_THROW("Auto-batching does not support dynamic networks!");
+            if (batched && shape[0].is_dynamic() != dynamic_batch)
+                OPENVINO_THROW("Auto-batching does not support the mix of the static and dynamic batch dims!");
+        };
         const auto& params = cloned_model->get_parameters();
         for (size_t input_id = 0; input_id < params.size(); input_id++) {
             const auto& input = params[input_id];
             const auto& shape = input->get_partial_shape();
-            // currently no plugin support batched execution for dynamic networks
-            if (shape.is_dynamic())
-                OPENVINO_THROW("Auto-batching does not support dynamic networks!");
-            // check the batch dim: either 0th (and the original batch size of 1) or none
+            // check the batch dim: either 0th (and the original batch size of 1 or dynamic) or none
             if (shape.size() && shape[0].has_symbol()) {
-                const auto& static_shape = input->get_shape();
-                if (static_shape[0] != 1)
+                if (batched_inputs.empty())
+                    dynamic_batch = shape[0].is_dynamic();
+                check_dynamic_dims(shape, true);
+                if (shape[0].is_static() && shape[0] != 1)
                     OPENVINO_THROW("Auto-batching does not reshape/re-batch originally batched networks!");
                 batched_inputs.insert(input_id);  // batched dim for the input
             } else {
+                check_dynamic_dims(shape, false);
                 // if the 0-th dim is not for the batch, then we support only the case when NONE dimension is batch
                 for (size_t s = 1; s < shape.size(); s++)
                     if (shape[s].has_symbol())
@@ -193,14 +208,14 @@ std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<
         for (size_t output_id = 0; output_id < results.size(); output_id++) {
             const auto& output = results[output_id];
             const auto& shape = output->get_output_partial_shape(0);
-            if (shape.is_dynamic())
-                OPENVINO_THROW("Auto-batching does not support dynamic networks!");
-            // check the batch dim: either 0th (and the original batch size of 1) or none
+            // check the batch dim: either 0th (and the original batch size of 1 or dynamic) or none
             if (shape.size() && shape[0].has_symbol()) {
-                if (shape[0] != 1)
+                check_dynamic_dims(shape, true);
+                if (shape[0].is_static() && shape[0] != 1)
                     OPENVINO_THROW("Auto-batching does not reshape/re-batch originally batched networks!");
                 batched_outputs.insert(output_id);
             } else {
+                check_dynamic_dims(shape, false);
                 // if the 0-th dim is not for the batch, then we support only the case when NONE dimension is batch
                 for (size_t s = 1; s < shape.size(); s++)
                     if (shape[s].get_symbol())
@@ -211,6 +226,7 @@ std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<
             OPENVINO_THROW("Auto-batching supports only networks with inputs/outputs featuring batched dim!");
     } catch (const ov::Exception&) {
         meta_device.device_batch_size = 1;
+        dynamic_batch = false;
     }
 
     if (!meta_device.device_batch_size) {
@@ -219,8 +235,17 @@ std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<
         // auto cloned_model = model->clone();
         ov::AnyMap options = {ov::hint::model(std::const_pointer_cast<ov::Model>(model))};
         auto supported_properties = core->get_property(device_name, ov::supported_properties);
+        unsigned int opt_batch_size = 0;
         if (std::count(supported_properties.begin(), supported_properties.end(), ov::optimal_batch_size)) {
-            unsigned int opt_batch_size = core->get_property(device_name, ov::optimal_batch_size, options);
+            try {
+                opt_batch_size = core->get_property(device_name, ov::optimal_batch_size, options);
+            } catch (const ov::Exception&) {
+                // the device may be unable to deduce the batch size of the dynamic model, no batching then
+                if (!dynamic_batch)
+                    throw;
+            }
+        }
+        if (opt_batch_size) {
             auto requests = core->get_property(device_name, ov::hint::num_requests);
             const auto& reqs = properties.find(ov::hint::num_requests.name());
             if (reqs != properties.end())
@@ -268,28 +293,46 @@ std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<
         if (supported_configKeys.end() != std::find(supported_configKeys.begin(), supported_configKeys.end(), c.first))
             compiled_model_config.insert(c);
     }
-    ov::SoPtr<ov::ICompiledModel> compiled_model_with_batch;
-    auto reshaped = model->clone();
-    if (meta_device.device_batch_size > 1 && batched_inputs.size()) {
-        try {
-            auto inputs = reshaped->inputs();
-            std::map<std::size_t, ov::PartialShape> partial_shapes;
-            for (size_t input_id = 0; input_id < inputs.size(); input_id++) {
-                auto input_shape = inputs[input_id].get_shape();
-                if (batched_inputs.find(input_id) != batched_inputs.end()) {
-                    input_shape[0] = meta_device.device_batch_size;
-                }
-                partial_shapes.insert({input_id, ov::PartialShape(input_shape)});
+    auto compile_with_batch = [&](uint32_t batch_size) {
+        auto reshaped = model->clone();
+        auto inputs = reshaped->inputs();
+        std::map<std::size_t, ov::PartialShape> partial_shapes;
+        for (size_t input_id = 0; input_id < inputs.size(); input_id++) {
+            auto input_shape = inputs[input_id].get_shape();
+            if (batched_inputs.find(input_id) != batched_inputs.end()) {
+                input_shape[0] = batch_size;
             }
+            partial_shapes.insert({input_id, ov::PartialShape(input_shape)});
+        }
 
-            reshaped->reshape(partial_shapes);
-            compiled_model_with_batch = context
-                                            ? core->compile_model(reshaped, context, device_config_no_auto_batch)
-                                            : core->compile_model(reshaped, device_name, device_config_no_auto_batch);
+        reshaped->reshape(partial_shapes);
+        return context ? core->compile_model(reshaped, context, device_config_no_auto_batch)
+                       : core->compile_model(reshaped, device_name, device_config_no_auto_batch);
+    };
+    ov::SoPtr<ov::ICompiledModel> compiled_model_with_batch;
+    if (meta_device.device_batch_size > 1 && batched_inputs.size() && dynamic_batch) {
+        // no recompilation, the same compiled model executes the stitched requests
+        compiled_model_with_batch = compiled_model_without_batch;
+    } else if (meta_device.device_batch_size > 1 && batched_inputs.size()) {
+        try {
+            compiled_model_with_batch = compile_with_batch(meta_device.device_batch_size);
         } catch (const ov::Exception&) {
             meta_device.device_batch_size = 1;
         }
     }
+    // with the latency target the partially collected batches are executed with the intermediate batch sizes
+    std::map<uint32_t, ov::SoPtr<ov::ICompiledModel>> compiled_models_partial_batch;
+    const auto latency_target = full_properties.find(ov::auto_batch_latency_target.name());
+    if (compiled_model_with_batch && !dynamic_batch && latency_target != full_properties.end() &&
+        latency_target->second.as<uint32_t>() > 0) {
+        for (uint32_t batch_size = 2; batch_size < meta_device.device_batch_size; batch_size *= 2) {
+            try {
+                compiled_models_partial_batch[batch_size] = compile_with_batch(batch_size);
+            } catch (const ov::Exception&) {
+                // the partial batches not fitting the device are executed with the larger batch size
+            }
+        }
+    }
 
     ov::SoPtr<ov::IRemoteContext> device_context;
     if (!context) {
@@ -311,7 +354,8 @@ std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<
                                            batched_outputs,
                                            compiled_model_with_batch,
                                            compiled_model_without_batch,
-                                           device_context);
+                                           device_context,
+                                           compiled_models_partial_batch);
 }
 
 ov::SupportedOpsMap Plugin::query_model(const std::shared_ptr<const ov::Model>& model,
@@ -49,13 +49,19 @@ size_t SyncInferRequest::get_batch_size() const {
     return m_batch_size;
 }
 
+size_t SyncInferRequest::get_batch_id() const {
+    return m_batch_id;
+}
+
 void SyncInferRequest::share_tensors_with_batched_req(const std::set<std::size_t>& batched_inputs,
                                                       const std::set<std::size_t>& batched_outputs) {
     const auto inputs = get_inputs();
     for (size_t input_id = 0; input_id < inputs.size(); input_id++) {
         const auto& input = inputs[input_id];
         ov::SoPtr<ov::ITensor> res;
-        auto batched_tensor = m_batched_request_wrapper->_infer_request_batched->get_tensor(input);
+        auto batched_tensor = m_batched_request_wrapper->_dynamic_batch_inputs.empty()
+                                  ? m_batched_request_wrapper->_infer_request_batched->get_tensor(input)
+                                  : m_batched_request_wrapper->_dynamic_batch_inputs[input_id];
         if (!batched_tensor._so)
             batched_tensor._so = m_batched_request_wrapper->_infer_request_batched._so;
         res =
@@ -67,7 +73,9 @@ void SyncInferRequest::share_tensors_with_batched_req(const std::set<std::size_t
     for (size_t output_id = 0; output_id < outputs.size(); output_id++) {
         const auto& output = outputs[output_id];
         ov::SoPtr<ov::ITensor> res;
-        auto batched_tensor = m_batched_request_wrapper->_infer_request_batched->get_tensor(output);
+        auto batched_tensor = m_batched_request_wrapper->_dynamic_batch_outputs.empty()
+                                  ? m_batched_request_wrapper->_infer_request_batched->get_tensor(output)
+                                  : m_batched_request_wrapper->_dynamic_batch_outputs[output_id];
         if (!batched_tensor._so)
             batched_tensor._so = m_batched_request_wrapper->_infer_request_batched._so;
         res = create_shared_tensor_on_batched_tensor(batched_tensor,
@@ -142,6 +150,49 @@ void SyncInferRequest::copy_outputs_if_needed() {
     }
 }
 
+void SyncInferRequest::copy_inputs_to_batch(ov::SoPtr<ov::IAsyncInferRequest>& req,
+                                            size_t batch_id,
+                                            size_t batch_size) {
+    for (const auto& it : get_inputs()) {
+        // this request is already in BUSY state, so using the internal functions safely
+        auto src_tensor = get_tensor(it);
+        auto dst_tensor = req->get_tensor(it);
+        auto ptrDst = static_cast<char*>(dst_tensor->data());
+        size_t szDst = dst_tensor->get_byte_size();
+        size_t szSrc = src_tensor->get_byte_size();
+        // the tensors of the inputs without the batch dim have the same size
+        size_t offset = szSrc != szDst ? batch_id * szDst / batch_size : 0;
+        if (ptrDst + offset != src_tensor->data())
+            memcpy(ptrDst + offset, src_tensor->data(), szSrc);
+    }
+}
+
+void SyncInferRequest::copy_outputs_from_batch(ov::SoPtr<ov::IAsyncInferRequest>& req,
+                                               size_t batch_id,
+                                               size_t batch_size) {
+    for (const auto& it : get_outputs()) {
+        // this request is already in BUSY state, so using the internal functions safely
+        auto src_tensor = req->get_tensor(it);
+        auto dst_tensor = get_tensor(it);
+        auto ptrSrc = static_cast<char*>(src_tensor->data());
+        size_t szDst = dst_tensor->get_byte_size();
+        size_t szSrc = src_tensor->get_byte_size();
+        size_t offset = szSrc != szDst ? batch_id * szSrc / batch_size : 0;
+        if (ptrSrc + offset != dst_tensor->data())
+            memcpy(dst_tensor->data(), ptrSrc + offset, szDst);
+    }
+}
+
+bool SyncInferRequest::has_remote_tensors() const {
+    for (const auto& ports : {get_inputs(), get_outputs()}) {
+        for (const auto& it : ports) {
+            if (std::dynamic_pointer_cast<ov::IRemoteTensor>(get_tensor(it)._ptr))
+                return true;
+        }
+    }
+    return false;
+}
+
 void SyncInferRequest::infer() {
     OPENVINO_NOT_IMPLEMENTED;
 }
@@ -27,6 +27,13 @@ public:
 
     void copy_outputs_if_needed();
 
+    // Batch-Device impl specific: copies the data to/from the batch_id slot of the request with another batch size
+    void copy_inputs_to_batch(ov::SoPtr<ov::IAsyncInferRequest>& req, size_t batch_id, size_t batch_size);
+
+    void copy_outputs_from_batch(ov::SoPtr<ov::IAsyncInferRequest>& req, size_t batch_id, size_t batch_size);
+
+    bool has_remote_tensors() const;
+
     void infer() override;
 
     std::vector<ov::SoPtr<ov::IVariableState>> query_state() const override;
@@ -40,11 +47,14 @@ public:
     enum eExecutionFlavor : uint8_t {
         NOT_EXECUTED,
         BATCH_EXECUTED,
-        TIMEOUT_EXECUTED
+        TIMEOUT_EXECUTED,
+        PARTIAL_BATCH_EXECUTED
     } m_batched_request_status = eExecutionFlavor::NOT_EXECUTED;
 
     size_t get_batch_size() const;
 
+    size_t get_batch_id() const;
+
 protected:
     void copy_tensor_if_needed(const ov::SoPtr<ov::ITensor>& src, ov::SoPtr<ov::ITensor>& dst, const bool bInput);
 
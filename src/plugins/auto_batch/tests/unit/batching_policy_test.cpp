@@ -0,0 +1,82 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "batching_policy.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace ov::mock_autobatch_plugin;
+using namespace std::chrono;
+
+class BatchingPolicyTest : public ::testing::Test {
+public:
+    std::shared_ptr<BatchingPolicy> m_policy;
+
+    void SetUp() override {
+        m_policy = std::make_shared<BatchingPolicy>(100, std::vector<uint32_t>{8, 1, 4, 2});
+    }
+
+    void TearDown() override {
+        m_policy.reset();
+    }
+
+    void arrive(milliseconds interarrival, size_t num) {
+        auto time = BatchingPolicy::Clock::now();
+        for (size_t n = 0; n < num; n++) {
+            m_policy->on_arrival(time);
+            time += interarrival;
+        }
+    }
+};
+
+TEST_F(BatchingPolicyTest, TimeoutWithoutStatistics) {
+    // half of the latency target is reserved for the execution
+    EXPECT_EQ(m_policy->get_timeout(), milliseconds(50));
+}
+
+TEST_F(BatchingPolicyTest, TimeoutUnderHighLoad) {
+    for (size_t n = 0; n < 64; n++)
+        m_policy->on_executed(8, milliseconds(20));
+    arrive(milliseconds(1), 64);
+    // the batch fills in time, so all the budget left after the execution may be spent to collect it
+    EXPECT_NEAR(m_policy->get_timeout().count(), 80, 1);
+}
+
+TEST_F(BatchingPolicyTest, TimeoutUnderLowLoad) {
+    for (size_t n = 0; n < 64; n++)
+        m_policy->on_executed(8, milliseconds(20));
+    arrive(milliseconds(200), 64);
+    // no other request comes within the latency target
+    EXPECT_EQ(m_policy->get_timeout(), milliseconds(0));
+}
+
+TEST_F(BatchingPolicyTest, TimeoutForIntermediateBatch) {
+    for (size_t n = 0; n < 64; n++) {
+        m_policy->on_executed(8, milliseconds(60));
+        m_policy->on_executed(4, milliseconds(30));
+    }
+    arrive(milliseconds(12), 64);
+    // only ~4 requests are collected within the budget of the full batch, the budget of the batch 4 is used
+    EXPECT_NEAR(m_policy->get_timeout().count(), 70, 1);
+}
+
+TEST_F(BatchingPolicyTest, SelectBatchSize) {
+    EXPECT_EQ(m_policy->select_batch_size(1), 1u);
+    EXPECT_EQ(m_policy->select_batch_size(3), 4u);
+    EXPECT_EQ(m_policy->select_batch_size(8), 8u);
+    EXPECT_EQ(m_policy->select_batch_size(9), 8u);
+}
+
+TEST_F(BatchingPolicyTest, Split) {
+    EXPECT_EQ(m_policy->split(1), std::vector<uint32_t>({1}));
+    EXPECT_EQ(m_policy->split(2), std::vector<uint32_t>({2}));
+    EXPECT_EQ(m_policy->split(3), std::vector<uint32_t>({4}));
+    EXPECT_EQ(m_policy->split(6), std::vector<uint32_t>({4, 2}));
+    EXPECT_EQ(m_policy->split(7), std::vector<uint32_t>({4, 2, 1}));
+}
+
+TEST(BatchingPolicyNoIntermediateTest, Split) {
+    BatchingPolicy policy(100, {1, 8});
+    EXPECT_EQ(policy.split(3), std::vector<uint32_t>({1, 1, 1}));
+}
@@ -16,17 +16,87 @@ struct RequestExecutor : ov::threading::ITaskExecutor {
         m_task = std::move(task);
         m_request->start_async();
     };
+    void run_with_priority(ov::threading::Task task, const ov::threading::TaskPriority& priority) override {
+        m_request->set_property(ov::IAsyncInferRequest::get_request_properties(priority));
+        run(std::move(task));
+    }
     ov::SoPtr<ov::IAsyncInferRequest>& m_request;
     std::exception_ptr m_exception_ptr;
     ov::threading::Task m_task;
 };
 
+namespace ov {
+namespace hetero {
+// leases a request of the submodel from the pool of the stage and continues the pipeline from its callback
+struct StageExecutor : ov::threading::ITaskExecutor {
+    StageExecutor(std::shared_ptr<InferRequest> request, size_t stage)
+        : m_request(std::move(request)),
+          m_stage(stage) {}
+    void run(ov::threading::Task task) override {
+        run_with_priority(std::move(task), {});
+    };
+    void run_with_priority(ov::threading::Task task, const ov::threading::TaskPriority& priority) override {
+        m_task = std::move(task);
+        m_priority = priority;
+        m_request->m_stage_pools[m_stage]->acquire([this](const StagePool::Lease& lease) {
+            start(lease);
+        });
+    }
+    void start(const StagePool::Lease& lease) {
+        m_exception_ptr = nullptr;
+        try {
+            m_request->bind_stage(m_stage, lease);
+            auto& subrequest = m_request->m_stage_pools[m_stage]->get_request(lease.request);
+            // the pooled request may have served a request of another priority, the deadline counts from now
+            subrequest->set_property(ov::IAsyncInferRequest::get_request_properties(m_priority));
+            subrequest->set_callback([this, lease](std::exception_ptr exception_ptr) {
+                m_exception_ptr = std::move(exception_ptr);
+                finish(lease);
+            });
+            subrequest->start_async();
+        } catch (...) {
+            m_exception_ptr = std::current_exception();
+            finish(lease);
+        }
+    }
+    void finish(const StagePool::Lease& lease) {
+        // the request goes back to the pool before the next stage, which may be the end of the HETERO request
+        auto task = std::move(m_task);
+        m_request->m_stage_pools[m_stage]->release_request(lease.request);
+        task();
+    }
+    std::shared_ptr<InferRequest> m_request;
+    size_t m_stage;
+    std::exception_ptr m_exception_ptr;
+    ov::threading::Task m_task;
+    ov::threading::TaskPriority m_priority;
+};
+}  // namespace hetero
+}  // namespace ov
+
 ov::hetero::AsyncInferRequest::AsyncInferRequest(const std::shared_ptr<ov::hetero::InferRequest>& request,
                                                  const std::shared_ptr<ov::threading::ITaskExecutor>& task_executor,
                                                  const std::shared_ptr<ov::threading::ITaskExecutor>& callback_executor)
     : ov::IAsyncInferRequest(request, task_executor, callback_executor),
       m_infer_request(std::static_pointer_cast<ov::hetero::InferRequest>(request)) {
     m_pipeline.clear();
+    if (!m_infer_request->m_stage_pools.empty()) {
+        const auto stages = m_infer_request->m_stage_pools.size();
+        for (size_t stage = 0; stage < stages; stage++) {
+            auto stage_executor = std::make_shared<StageExecutor>(m_infer_request, stage);
+            m_pipeline.emplace_back(stage_executor, [stage_executor, stages] {
+                // the intermediate tensors are kept until the last stage is done
+                if (nullptr != stage_executor->m_exception_ptr) {
+                    stage_executor->m_request->release_slots();
+                    std::rethrow_exception(stage_executor->m_exception_ptr);
+                }
+                if (stage_executor->m_stage + 1 == stages) {
+                    stage_executor->m_request->release_slots();
+                }
+            });
+        }
+        return;
+    }
     for (auto&& request : m_infer_request->m_subrequests) {
         auto request_executor = std::make_shared<RequestExecutor>(request);
         m_pipeline.emplace_back(request_executor, [request_executor] {
@@ -43,6 +113,10 @@ ov::hetero::AsyncInferRequest::~AsyncInferRequest() {
 
 void ov::hetero::AsyncInferRequest::cancel() {
     ov::IAsyncInferRequest::cancel();
+    // the pooled requests are shared with other HETERO requests
+    if (!m_infer_request->m_stage_pools.empty()) {
+        return;
+    }
     for (auto&& request : m_infer_request->m_subrequests) {
         request->cancel();
     }
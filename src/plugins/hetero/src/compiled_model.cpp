@@ -5,8 +5,10 @@
 #include "compiled_model.hpp"
 
 #include <memory>
+#include <set>
 
 #include "async_infer_request.hpp"
+#include "cost_model.hpp"
 #include "graph_debug_dump.hpp"
 #include "itt.hpp"
 #include "op/device_subgraph.hpp"
@@ -75,6 +77,8 @@ void ov::hetero::CompiledModel::compile_model(const std::vector<ov::hetero::Subm
         m_compiled_submodels.emplace_back(std::move(desc));
     }
     set_inputs_and_outputs();
+    m_partition_statistics = estimate_submodels(submodels, m_mapping_info, CostModel{m_cfg.device_performance});
+    init_stage_pools();
 }
 
 ov::hetero::CompiledModel::CompiledModel(std::istream& model,
@@ -168,6 +172,7 @@ ov::hetero::CompiledModel::CompiledModel(std::istream& model,
     }
     // clang-format on
     set_inputs_and_outputs();
+    init_stage_pools();
 }
 
 std::shared_ptr<ov::ISyncInferRequest> ov::hetero::CompiledModel::create_sync_infer_request() const {
@@ -227,7 +232,9 @@ ov::Any ov::hetero::CompiledModel::get_property(const std::string& name) const {
                                                     ov::optimal_number_of_infer_requests,
                                                     ov::execution_devices,
                                                     ov::loaded_from_cache,
-                                                    ov::hetero::number_of_submodels};
+                                                    ov::hetero::number_of_submodels,
+                                                    ov::hetero::pipeline_depth,
+                                                    ov::hetero::partition_statistics};
         return ro_properties;
     };
 
@@ -261,6 +268,10 @@ ov::Any ov::hetero::CompiledModel::get_property(const std::string& name) const {
                              comp_model_desc.compiled_model->get_property(ov::optimal_number_of_infer_requests.name())
                                  .as<unsigned int>());
         }
+        // keeps every stage of the pipeline busy
+        if (!m_stage_pools.empty()) {
+            value = std::max(value, static_cast<unsigned int>(m_cfg.pipeline_depth * m_stage_pools.size()));
+        }
         return decltype(ov::optimal_number_of_infer_requests)::value_type{value};
     } else if (ov::execution_devices == name) {
         std::vector<std::string> device_names;
@@ -272,6 +283,8 @@ ov::Any ov::hetero::CompiledModel::get_property(const std::string& name) const {
             device_names.push_back(comp_model_desc.device);
         }
         return decltype(ov::execution_devices)::value_type{std::move(device_names)};
+    } else if (ov::hetero::partition_statistics == name) {
+        return decltype(ov::hetero::partition_statistics)::value_type{m_partition_statistics};
     } else if (ov::hetero::number_of_submodels == name) {
         return decltype(ov::hetero::number_of_submodels)::value_type{
             (m_compiled_submodels.size() - get_hetero_plugin()->independent_submodel_size)};
@@ -319,6 +332,33 @@ void ov::hetero::CompiledModel::set_inputs_and_outputs() {
     }
 }
 
+void ov::hetero::CompiledModel::init_stage_pools() {
+    m_stage_pools.clear();
+    if (m_cfg.pipeline_depth == 0 || m_compiled_submodels.size() < 2) {
+        return;
+    }
+    // the outputs of the model are kept in the tensors of the HETERO request, the slots hold the rest of the links
+    std::set<NodeInfo> model_outputs(m_mapping_info._outputs_to_submodels_outputs.begin(),
+                                     m_mapping_info._outputs_to_submodels_outputs.end());
+    std::vector<std::set<size_t>> linked_outputs(m_compiled_submodels.size());
+    for (const auto& kvp : m_mapping_info._submodels_input_to_prev_output) {
+        if (model_outputs.count(kvp.second) == 0) {
+            linked_outputs[kvp.second.first].insert(kvp.second.second);
+        }
+    }
+    for (size_t i = 0; i < m_compiled_submodels.size(); i++) {
+        auto pool = std::make_shared<StagePool>(m_compiled_submodels[i].compiled_model,
+                                                m_cfg.pipeline_depth,
+                                                linked_outputs[i]);
+        // the states belong to the submodel requests, so they can't be shared between the HETERO requests
+        if (pool->has_states()) {
+            m_stage_pools.clear();
+            return;
+        }
+        m_stage_pools.emplace_back(std::move(pool));
+    }
+}
+
 void ov::hetero::CompiledModel::export_model(std::ostream& model_stream) const {
     OV_ITT_SCOPED_TASK(itt::domains::Hetero, "CompiledModel::export_model");
 
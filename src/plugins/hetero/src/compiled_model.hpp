@@ -9,6 +9,7 @@
 #include "openvino/runtime/so_ptr.hpp"
 #include "plugin.hpp"
 #include "remote_context.hpp"
+#include "stage_pool.hpp"
 #include "subgraph_collector.hpp"
 
 namespace ov {
@@ -56,6 +57,8 @@ private:
 
     void set_inputs_and_outputs();
 
+    void init_stage_pools();
+
     Configuration m_cfg;
     std::string m_name;
     const bool m_loaded_from_cache;
@@ -69,6 +72,10 @@ private:
         ov::SoPtr<ov::ICompiledModel> compiled_model;
     };
     std::vector<CompiledModelDesc> m_compiled_submodels;
+    // the estimations of the cost model, empty for the imported models
+    ov::AnyMap m_partition_statistics;
+    // shared by all infer requests in the pipeline mode, empty otherwise
+    std::vector<std::shared_ptr<StagePool>> m_stage_pools;
 };
 }  // namespace hetero
 }  // namespace ov
@@ -33,6 +33,12 @@ Configuration::Configuration(const ov::AnyMap& config, const Configuration& defa
                 }
             }
             modelDistributionPolicy = value.as<std::set<ov::hint::ModelDistributionPolicy>>();
+        } else if (ov::hetero::pipeline_depth == key) {
+            pipeline_depth = value.as<uint32_t>();
+        } else if (ov::hetero::partitioning_by_cost == key) {
+            partitioning_by_cost = value.as<bool>();
+        } else if (ov::hetero::device_performance == key) {
+            device_performance = value.as<std::map<std::string, float>>();
         } else if (ov::cache_encryption_callbacks == key) {
             encryption_callbacks = value.as<EncryptionCallbacks>();
         } else {
@@ -48,6 +54,12 @@ ov::Any Configuration::get(const std::string& name) const {
         return {device_priorities};
     } else if (name == ov::hint::model_distribution_policy) {
         return {modelDistributionPolicy};
+    } else if (name == ov::hetero::pipeline_depth) {
+        return {pipeline_depth};
+    } else if (name == ov::hetero::partitioning_by_cost) {
+        return {partitioning_by_cost};
+    } else if (name == ov::hetero::device_performance) {
+        return {device_performance};
     } else {
         OPENVINO_THROW("Property was not found: ", name);
     }
@@ -59,8 +71,15 @@ std::vector<ov::PropertyName> Configuration::get_supported() const {
 }
 
 ov::AnyMap Configuration::get_hetero_properties() const {
-    return {{ov::device::priorities.name(), device_priorities},
-            {ov::hint::model_distribution_policy.name(), modelDistributionPolicy}};
+    ov::AnyMap properties = {{ov::device::priorities.name(), device_priorities},
+                             {ov::hint::model_distribution_policy.name(), modelDistributionPolicy},
+                             {ov::hetero::pipeline_depth.name(), pipeline_depth},
+                             {ov::hetero::partitioning_by_cost.name(), partitioning_by_cost}};
+    // the empty map can't be read back from the exported string
+    if (!device_performance.empty()) {
+        properties.emplace(ov::hetero::device_performance.name(), device_performance);
+    }
+    return properties;
 }
 
 ov::AnyMap Configuration::get_device_properties() const {
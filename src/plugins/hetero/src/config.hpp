@@ -38,6 +38,12 @@ struct Configuration {
 
     std::set<ov::hint::ModelDistributionPolicy> modelDistributionPolicy = {};
 
+    uint32_t pipeline_depth = 0;
+
+    bool partitioning_by_cost = false;
+
+    std::map<std::string, float> device_performance;
+
     EncryptionCallbacks encryption_callbacks;
 
     ov::AnyMap device_properties;
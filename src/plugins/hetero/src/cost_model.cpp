@@ -0,0 +1,253 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cost_model.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <unordered_map>
+
+#include "openvino/core/except.hpp"
+#include "openvino/op/convolution.hpp"
+#include "openvino/op/group_conv.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/util/op_types.hpp"
+
+namespace {
+// the defaults for the devices without ov::hetero::device_performance
+constexpr float cpu_gflops = 100.0f;
+constexpr float accelerator_gflops = 400.0f;
+// host <-> device copy, GB/s
+constexpr double transfer_bandwidth = 8.0;
+// the cost of the submodel boundary itself: the synchronization and the start of the next request
+constexpr double transfer_latency_us = 20.0;
+
+bool has_computations(const std::shared_ptr<ov::Node>& node) {
+    return !ov::op::util::is_parameter(node) && !ov::op::util::is_output(node) && !ov::op::util::is_constant(node);
+}
+}  // namespace
+
+ov::hetero::CostModel::CostModel(std::map<std::string, float> device_performance)
+    : m_device_performance(std::move(device_performance)) {}
+
+double ov::hetero::CostModel::get_flops(const std::shared_ptr<ov::Node>& node) {
+    if (!has_computations(node)) {
+        return 0.0;
+    }
+    double output_elements = 0.0;
+    for (const auto& output : node->outputs()) {
+        if (output.get_partial_shape().is_static()) {
+            output_elements += static_cast<double>(ov::shape_size(output.get_shape()));
+        }
+    }
+    if (const auto matmul = ov::as_type_ptr<ov::op::v0::MatMul>(node)) {
+        const auto& shape_a = matmul->get_input_partial_shape(0);
+        if (shape_a.rank().is_static() && shape_a.size() > 0) {
+            const auto rank = shape_a.size();
+            const auto& k = shape_a[matmul->get_transpose_a() && rank > 1 ? rank - 2 : rank - 1];
+            if (k.is_static()) {
+                return 2.0 * output_elements * static_cast<double>(k.get_length());
+            }
+        }
+    } else if (ov::is_type<ov::op::v1::Convolution>(node) || ov::is_type<ov::op::v1::GroupConvolution>(node)) {
+        // the weights are [O, I, k...] or [G, O/G, I/G, k...]
+        const auto& weights = node->get_input_partial_shape(1);
+        if (weights.is_static()) {
+            const auto shape = weights.to_shape();
+            const size_t outputs = ov::is_type<ov::op::v1::GroupConvolution>(node) ? shape[0] * shape[1] : shape[0];
+            if (outputs > 0) {
+                const auto macs = static_cast<double>(ov::shape_size(shape)) / static_cast<double>(outputs);
+                return 2.0 * output_elements * macs;
+            }
+        }
+    }
+    return output_elements;
+}
+
+size_t ov::hetero::CostModel::get_bytes(const ov::Output<ov::Node>& output) {
+    if (!output.get_partial_shape().is_static()) {
+        return 0;
+    }
+    return (ov::shape_size(output.get_shape()) * output.get_element_type().bitwidth() + 7) / 8;
+}
+
+double ov::hetero::CostModel::get_compute_time(double flops, const std::string& device) const {
+    auto it = m_device_performance.find(device);
+    if (it == m_device_performance.end()) {
+        // "GPU.1" falls back to "GPU"
+        it = m_device_performance.find(device.substr(0, device.find('.')));
+    }
+    float gflops = 0.0f;
+    if (it != m_device_performance.end()) {
+        gflops = it->second;
+    } else {
+        gflops = device.find("CPU") == 0 ? cpu_gflops : accelerator_gflops;
+    }
+    OPENVINO_ASSERT(gflops > 0.0f, "Performance of device ", device, " must be positive");
+    return flops / (static_cast<double>(gflops) * 1e3);
+}
+
+double ov::hetero::CostModel::get_transfer_time(double bytes) const {
+    return transfer_latency_us + bytes / (transfer_bandwidth * 1e3);
+}
+
+ov::SupportedOpsMap ov::hetero::partition_by_cost(const std::shared_ptr<const ov::Model>& model,
+                                                  const std::vector<std::string>& devices,
+                                                  const std::map<std::string, ov::SupportedOpsMap>& query_results,
+                                                  const CostModel& cost_model) {
+    const auto ordered_ops = model->get_ordered_ops();
+    std::vector<std::shared_ptr<ov::Node>> nodes;
+    std::unordered_map<const ov::Node*, size_t> positions;
+    for (const auto& op : ordered_ops) {
+        if (has_computations(op)) {
+            positions[op.get()] = nodes.size();
+            nodes.push_back(op);
+        }
+    }
+    const size_t nodes_count = nodes.size();
+    const size_t devices_count = devices.size();
+
+    auto is_supported = [&](const std::shared_ptr<ov::Node>& node, size_t device) {
+        const auto it = query_results.find(devices[device]);
+        return it != query_results.end() && it->second.count(node->get_friendly_name()) != 0;
+    };
+
+    // the bytes of the activations crossing the cut right before every node
+    std::vector<double> cut_bytes(nodes_count + 1, 0.0);
+    for (size_t i = 0; i < nodes_count; i++) {
+        for (const auto& output : nodes[i]->outputs()) {
+            size_t last_use = i;
+            for (const auto& target : output.get_target_inputs()) {
+                const auto it = positions.find(target.get_node());
+                if (it != positions.end()) {
+                    last_use = std::max(last_use, it->second);
+                }
+            }
+            if (last_use > i) {
+                const auto bytes = static_cast<double>(CostModel::get_bytes(output));
+                cut_bytes[i + 1] += bytes;
+                cut_bytes[last_use + 1] -= bytes;
+            }
+        }
+    }
+    for (size_t i = 1; i <= nodes_count; i++) {
+        cut_bytes[i] += cut_bytes[i - 1];
+    }
+
+    // latency[i][d] - the minimal latency of the first i + 1 nodes with the node i on the device d
+    const double unreachable = std::numeric_limits<double>::infinity();
+    std::vector<std::vector<double>> latency(nodes_count, std::vector<double>(devices_count, unreachable));
+    std::vector<std::vector<size_t>> previous(nodes_count, std::vector<size_t>(devices_count, 0));
+    for (size_t i = 0; i < nodes_count; i++) {
+        bool supported_by_any = false;
+        for (size_t d = 0; d < devices_count; d++) {
+            supported_by_any = supported_by_any || is_supported(nodes[i], d);
+        }
+        // the unsupported nodes don't constrain the placement
+        const double flops = supported_by_any ? CostModel::get_flops(nodes[i]) : 0.0;
+        for (size_t d = 0; d < devices_count; d++) {
+            if (supported_by_any && !is_supported(nodes[i], d)) {
+                continue;
+            }
+            const double compute = cost_model.get_compute_time(flops, devices[d]);
+            if (i == 0) {
+                latency[i][d] = compute;
+                continue;
+            }
+            // the devices are visited in the priority order, so the ties are resolved in favor of the priority
+            for (size_t p = 0; p < devices_count; p++) {
+                const double transfer = p == d ? 0.0 : cost_model.get_transfer_time(cut_bytes[i]);
+                const double candidate = latency[i - 1][p] + transfer + compute;
+                if (candidate < latency[i][d]) {
+                    latency[i][d] = candidate;
+                    previous[i][d] = p;
+                }
+            }
+        }
+    }
+
+    ov::SupportedOpsMap result;
+    std::unordered_map<const ov::Node*, size_t> placement;
+    if (nodes_count > 0) {
+        size_t device = 0;
+        for (size_t d = 1; d < devices_count; d++) {
+            if (latency.back()[d] < latency.back()[device]) {
+                device = d;
+            }
+        }
+        OPENVINO_ASSERT(latency.back()[device] != unreachable,
+                        "Failed to partition model ",
+                        model->get_friendly_name());
+        for (size_t i = nodes_count; i-- > 0;) {
+            if (is_supported(nodes[i], device)) {
+                placement[nodes[i].get()] = device;
+                result[nodes[i]->get_friendly_name()] = devices[device];
+            }
+            device = previous[i][device];
+        }
+    }
+
+    auto assign = [&](const std::shared_ptr<ov::Node>& node, const ov::Node* neighbour) {
+        const auto it = placement.find(neighbour);
+        size_t device = it != placement.end() && is_supported(node, it->second) ? it->second : 0;
+        while (device < devices_count && !is_supported(node, device)) {
+            device++;
+        }
+        if (device < devices_count) {
+            placement[node.get()] = device;
+            result[node->get_friendly_name()] = devices[device];
+        }
+    };
+    // the parameters and the constants go with their first consumer, the results with their producer
+    for (const auto& op : ordered_ops) {
+        if (ov::op::util::is_parameter(op) || ov::op::util::is_constant(op)) {
+            const ov::Node* consumer = nullptr;
+            for (const auto& target : op->output(0).get_target_inputs()) {
+                if (placement.count(target.get_node()) != 0) {
+                    consumer = target.get_node();
+                    break;
+                }
+            }
+            assign(op, consumer);
+        }
+    }
+    for (const auto& op : ordered_ops) {
+        if (ov::op::util::is_output(op)) {
+            assign(op, op->get_input_node_ptr(0));
+        }
+    }
+    return result;
+}
+
+ov::AnyMap ov::hetero::estimate_submodels(
+    const std::vector<std::pair<std::string, std::shared_ptr<ov::Model>>>& submodels,
+    const SubgraphsMappingInfo& mapping_info,
+    const CostModel& cost_model) {
+    ov::AnyMap estimations;
+    for (size_t i = 0; i < submodels.size(); i++) {
+        const auto& [device, submodel] = submodels[i];
+        if (!submodel) {
+            continue;
+        }
+        double flops = 0.0;
+        for (const auto& op : submodel->get_ordered_ops()) {
+            flops += CostModel::get_flops(op);
+        }
+        size_t input_bytes = 0;
+        for (const auto& kvp : mapping_info._submodels_input_to_prev_output) {
+            if (kvp.first.first == i && kvp.first.second < submodel->get_parameters().size()) {
+                input_bytes += CostModel::get_bytes(submodel->get_parameters()[kvp.first.second]->output(0));
+            }
+        }
+        const double transfer_us = input_bytes > 0 ? cost_model.get_transfer_time(static_cast<double>(input_bytes))
+                                                   : 0.0;
+        estimations["SUBMODEL_" + std::to_string(i)] =
+            ov::AnyMap{{"DEVICE", device},
+                       {"FLOPS", flops},
+                       {"COMPUTE_US", cost_model.get_compute_time(flops, device)},
+                       {"INPUT_BYTES", input_bytes},
+                       {"TRANSFER_US", transfer_us}};
+    }
+    return estimations;
+}
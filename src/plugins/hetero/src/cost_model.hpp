@@ -0,0 +1,67 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "openvino/core/any.hpp"
+#include "openvino/core/model.hpp"
+#include "openvino/runtime/common.hpp"
+#include "subgraph_collector.hpp"
+
+namespace ov {
+namespace hetero {
+
+/**
+ * @brief Rough analytical estimation of the execution time of the nodes on the devices and of the transfers between
+ * the devices. The device performance is given in GFLOPS (see ov::hetero::device_performance), the devices without
+ * the value use the defaults of their kind.
+ */
+class CostModel {
+public:
+    explicit CostModel(std::map<std::string, float> device_performance = {});
+
+    /**
+     * @brief Estimated number of the floating point operations of the node, 0 for the nodes without computations
+     */
+    static double get_flops(const std::shared_ptr<ov::Node>& node);
+
+    static size_t get_bytes(const ov::Output<ov::Node>& output);
+
+    // microseconds
+    double get_compute_time(double flops, const std::string& device) const;
+
+    // microseconds, including the synchronization of the devices
+    double get_transfer_time(double bytes) const;
+
+private:
+    std::map<std::string, float> m_device_performance;
+};
+
+/**
+ * @brief Assigns the nodes of the model to the devices supporting them so that the estimated latency of the model,
+ * i.e. the compute time of the nodes plus the transfer time of the activations crossing the device boundaries, is
+ * minimal. The nodes are kept in the topological order, so every device change is a cut of all the live activations.
+ * The nodes without computations follow their neighbours, the nodes not supported by any device are left unassigned.
+ */
+ov::SupportedOpsMap partition_by_cost(const std::shared_ptr<const ov::Model>& model,
+                                      const std::vector<std::string>& devices,
+                                      const std::map<std::string, ov::SupportedOpsMap>& query_results,
+                                      const CostModel& cost_model);
+
+/**
+ * @brief Returns the estimations for every submodel as the map with the "DEVICE", "FLOPS", "COMPUTE_US",
+ * "INPUT_BYTES" (the activations received from the previous submodels) and "TRANSFER_US" keys
+ */
+ov::AnyMap estimate_submodels(const std::vector<std::pair<std::string, std::shared_ptr<ov::Model>>>& submodels,
+                              const SubgraphsMappingInfo& mapping_info,
+                              const CostModel& cost_model);
+
+}  // namespace hetero
+}  // namespace ov
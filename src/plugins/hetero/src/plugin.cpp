@@ -13,6 +13,7 @@
 #include <vector>
 
 #include "compiled_model.hpp"
+#include "cost_model.hpp"
 #include "itt.hpp"
 #include "op/device_subgraph.hpp"
 #include "openvino/core/graph_util.hpp"
@@ -295,6 +296,19 @@ std::pair<ov::SupportedOpsMap, ov::hetero::SubgraphsMappingInfo> ov::hetero::Plu
         }
     }
     model->add_results(new_outputs);
+    if (full_config.partitioning_by_cost && device_names.size() > 1) {
+        for (const auto& device_name : device_names) {
+            query_results[device_name] =
+                get_core()->query_model(model, device_name, properties_per_device.at(device_name));
+        }
+        supported_ops_final =
+            partition_by_cost(model, device_names, query_results, CostModel{full_config.device_performance});
+        mapping_info = ov::hetero::mask_model_subgraphs_by_ops(model,
+                                                               supported_ops_final,
+                                                               m_cfg.dump_dot_files(),
+                                                               allow_exception ? "" : get_device_name());
+        return {supported_ops_final, mapping_info};
+    }
     for (const auto& device_name : device_names) {
         // If there are some unsupported operations and it is a last device
         // exception should be raised when allowed
@@ -365,7 +379,11 @@ ov::Any ov::hetero::Plugin::get_property(const std::string& name, const ov::AnyM
         return ro_properties;
     };
     const auto& default_rw_properties = []() {
-        std::vector<ov::PropertyName> rw_properties{ov::device::priorities, ov::hint::model_distribution_policy};
+        std::vector<ov::PropertyName> rw_properties{ov::device::priorities,
+                                                    ov::hint::model_distribution_policy,
+                                                    ov::hetero::pipeline_depth,
+                                                    ov::hetero::partitioning_by_cost,
+                                                    ov::hetero::device_performance};
         return rw_properties;
     };
 
@@ -17,5 +17,33 @@ static constexpr Property<std::string, PropertyMutability::RO> caching_device_pr
  * @brief Read-only property showing number of compiled submodels
  */
 static constexpr Property<size_t, PropertyMutability::RO> number_of_submodels{"HETERO_NUMBER_OF_SUBMODELS"};
+
+/**
+ * @brief Number of the infer requests of every submodel shared by all infer requests of the compiled model.
+ * When it's set, the submodels run as the stages of a pipeline: a request takes a free submodel request of the next
+ * stage as soon as it's done with the current one, so the stages on different devices work on different requests at
+ * the same time. 0 (default) - every infer request owns one request of each submodel. Not applied to stateful models.
+ */
+static constexpr Property<uint32_t, PropertyMutability::RW> pipeline_depth{"HETERO_PIPELINE_DEPTH"};
+
+/**
+ * @brief Splits the model by the estimated cost instead of the device priorities: every node goes to one of the
+ * devices supporting it so that the estimated compute time plus the time of the transfers between the submodels is
+ * minimal. The estimations of the chosen submodels are available via ov::hetero::partition_statistics.
+ */
+static constexpr Property<bool, PropertyMutability::RW> partitioning_by_cost{"HETERO_PARTITIONING_BY_COST"};
+
+/**
+ * @brief Performance of the devices in GFLOPS used by the cost model, e.g. {CPU:150,GPU.1:1200}.
+ * The devices without the value are estimated by their kind.
+ */
+static constexpr Property<std::map<std::string, float>, PropertyMutability::RW> device_performance{
+    "HETERO_DEVICE_PERFORMANCE"};
+
+/**
+ * @brief Read-only property with the estimated compute and transfer time of every submodel, see CostModel.
+ * Not available for the imported models.
+ */
+static constexpr Property<ov::AnyMap, PropertyMutability::RO> partition_statistics{"HETERO_PARTITION_STATISTICS"};
 }  // namespace hetero
 }  // namespace ov
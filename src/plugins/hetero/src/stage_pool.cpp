@@ -0,0 +1,82 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "stage_pool.hpp"
+
+#include <utility>
+
+#include "openvino/core/except.hpp"
+#include "openvino/runtime/make_tensor.hpp"
+
+ov::hetero::StagePool::StagePool(const ov::SoPtr<ov::ICompiledModel>& compiled_model,
+                                 size_t size,
+                                 const std::set<size_t>& linked_outputs) {
+    OPENVINO_ASSERT(size > 0, "HETERO pipeline stage requires at least one infer request");
+    for (size_t i = 0; i < size; i++) {
+        m_requests.push_back({compiled_model->create_infer_request(), compiled_model._so});
+        m_free_requests.push_back(i);
+    }
+    const auto& outputs = compiled_model->outputs();
+    for (size_t i = 0; i < size; i++) {
+        std::map<size_t, ov::SoPtr<ov::ITensor>> slot;
+        for (const auto& output_idx : linked_outputs) {
+            const auto& output_tensor = m_requests.front()->get_tensor(outputs[output_idx]);
+            slot[output_idx] = {ov::make_tensor(output_tensor->get_element_type(), output_tensor->get_shape()),
+                                nullptr};
+        }
+        m_slots.emplace_back(std::move(slot));
+        m_free_slots.push_back(i);
+    }
+}
+
+void ov::hetero::StagePool::acquire(Handler handler) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_waiting.emplace_back(std::move(handler));
+    dispatch(lock);
+}
+
+void ov::hetero::StagePool::release_request(size_t request) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_free_requests.push_back(request);
+    dispatch(lock);
+}
+
+void ov::hetero::StagePool::release_slot(size_t slot) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_free_slots.push_back(slot);
+    dispatch(lock);
+}
+
+void ov::hetero::StagePool::dispatch(std::unique_lock<std::mutex>& lock) {
+    std::vector<std::pair<Handler, Lease>> ready;
+    while (!m_waiting.empty() && !m_free_requests.empty() && !m_free_slots.empty()) {
+        ready.emplace_back(std::move(m_waiting.front()), Lease{m_free_requests.front(), m_free_slots.front()});
+        m_waiting.pop_front();
+        m_free_requests.pop_front();
+        m_free_slots.pop_front();
+    }
+    // the handlers start the requests, which may release other leases of this pool from their callbacks
+    lock.unlock();
+    for (auto& [handler, lease] : ready) {
+        handler(lease);
+    }
+}
+
+const ov::SoPtr<ov::IAsyncInferRequest>& ov::hetero::StagePool::get_request(size_t request) const {
+    return m_requests.at(request);
+}
+
+ov::SoPtr<ov::ITensor> ov::hetero::StagePool::get_tensor(size_t slot, size_t output_idx) const {
+    const auto& tensors = m_slots.at(slot);
+    const auto it = tensors.find(output_idx);
+    return it == tensors.end() ? ov::SoPtr<ov::ITensor>{} : it->second;
+}
+
+bool ov::hetero::StagePool::has_states() const {
+    try {
+        return !m_requests.front()->query_state().empty();
+    } catch (const ov::NotImplemented&) {
+        return false;
+    }
+}
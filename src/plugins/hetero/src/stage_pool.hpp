@@ -0,0 +1,70 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <vector>
+
+#include "openvino/runtime/iasync_infer_request.hpp"
+#include "openvino/runtime/icompiled_model.hpp"
+#include "openvino/runtime/so_ptr.hpp"
+
+namespace ov {
+namespace hetero {
+
+/**
+ * @brief Pool of the infer requests of one submodel shared by all HETERO infer requests in the pipeline mode
+ * (see ov::hetero::pipeline_depth). Besides the requests the pool owns the slots of the tensors for the submodel
+ * outputs consumed by the following submodels. A HETERO request leases a slot until the whole pipeline is done, so the
+ * number of the intermediate results in flight after every stage is bounded by the number of the slots.
+ */
+class StagePool {
+public:
+    struct Lease {
+        size_t request;
+        size_t slot;
+    };
+    using Handler = std::function<void(const Lease&)>;
+
+    StagePool(const ov::SoPtr<ov::ICompiledModel>& compiled_model, size_t size, const std::set<size_t>& linked_outputs);
+
+    /**
+     * @brief Calls the handler once both a request and a slot are free: immediately or from the release of another
+     * lease. The waiting handlers are served in FIFO order and must not throw.
+     */
+    void acquire(Handler handler);
+
+    void release_request(size_t request);
+
+    void release_slot(size_t slot);
+
+    const ov::SoPtr<ov::IAsyncInferRequest>& get_request(size_t request) const;
+
+    /**
+     * @brief Returns the tensor of the slot for the linked output or an empty pointer for other outputs
+     */
+    ov::SoPtr<ov::ITensor> get_tensor(size_t slot, size_t output_idx) const;
+
+    bool has_states() const;
+
+private:
+    void dispatch(std::unique_lock<std::mutex>& lock);
+
+    std::vector<ov::SoPtr<ov::IAsyncInferRequest>> m_requests;
+    std::vector<std::map<size_t, ov::SoPtr<ov::ITensor>>> m_slots;
+
+    std::mutex m_mutex;
+    std::deque<size_t> m_free_requests;
+    std::deque<size_t> m_free_slots;
+    std::deque<Handler> m_waiting;
+};
+
+}  // namespace hetero
+}  // namespace ov
@@ -5,6 +5,8 @@
 #include "sync_infer_request.hpp"
 
 #include <algorithm>
+#include <future>
+#include <limits>
 #include <map>
 #include <memory>
 #include <string>
@@ -18,10 +20,19 @@
 #include "remote_tensor.hpp"
 
 ov::hetero::InferRequest::InferRequest(const std::shared_ptr<const ov::hetero::CompiledModel>& compiled_model)
-    : ov::ISyncInferRequest(compiled_model) {
-    for (auto&& comp_model_desc : compiled_model->m_compiled_submodels) {
-        auto& comp_model = comp_model_desc.compiled_model;
-        m_subrequests.push_back({comp_model->create_infer_request(), comp_model._so});
+    : ov::ISyncInferRequest(compiled_model),
+      m_stage_pools(compiled_model->m_stage_pools) {
+    if (!m_stage_pools.empty()) {
+        // the submodel requests and the intermediate tensors are leased from the pools for every inference,
+        // the request owns only the tensors of the model inputs and outputs
+        for (const auto& pool : m_stage_pools) {
+            m_subrequests.push_back(pool->get_request(0));
+        }
+    } else {
+        for (auto&& comp_model_desc : compiled_model->m_compiled_submodels) {
+            auto& comp_model = comp_model_desc.compiled_model;
+            m_subrequests.push_back({comp_model->create_infer_request(), comp_model._so});
+        }
     }
 
     for (size_t i = 0; i < compiled_model->inputs().size(); i++) {
@@ -35,6 +46,25 @@ ov::hetero::InferRequest::InferRequest(const std::shared_ptr<const ov::hetero::C
         m_port_to_subrequest_idx[port] = submodel_idx;
     }
 
+    if (!m_stage_pools.empty()) {
+        m_slots.resize(m_stage_pools.size(), std::numeric_limits<size_t>::max());
+        for (const auto& port : get_inputs()) {
+            allocate_tensor(port, [&port](ov::SoPtr<ov::ITensor>& tensor) {
+                tensor = {ov::make_tensor(port.get_element_type(),
+                                          port.get_partial_shape().is_dynamic() ? ov::Shape{0} : port.get_shape()),
+                          nullptr};
+            });
+        }
+        for (const auto& port : get_outputs()) {
+            allocate_tensor(port, [&port](ov::SoPtr<ov::ITensor>& tensor) {
+                tensor = {ov::make_tensor(port.get_element_type(),
+                                          port.get_partial_shape().is_dynamic() ? ov::Shape{0} : port.get_shape()),
+                          nullptr};
+            });
+        }
+        return;
+    }
+
     std::map<ov::Output<const ov::Node>, ov::SoPtr<ov::ITensor>> temp_tensor_map;
     for (const auto& kvp : compiled_model->m_mapping_info._submodels_input_to_prev_output) {
         const auto& submodel_idx_in = kvp.first.first;
@@ -55,7 +85,9 @@ ov::hetero::InferRequest::InferRequest(const std::shared_ptr<const ov::hetero::C
     }
 }
 
-ov::hetero::InferRequest::~InferRequest() = default;
+ov::hetero::InferRequest::~InferRequest() {
+    release_slots();
+}
 
 ov::SoPtr<ov::IAsyncInferRequest> ov::hetero::InferRequest::get_request(const ov::Output<const ov::Node>& port) const {
     auto found_port = find_port(port);
@@ -70,6 +102,9 @@ ov::SoPtr<ov::IAsyncInferRequest> ov::hetero::InferRequest::get_request(const ov
 }
 
 ov::SoPtr<ov::ITensor> ov::hetero::InferRequest::get_tensor(const ov::Output<const ov::Node>& port) const {
+    if (!m_stage_pools.empty()) {
+        return ov::ISyncInferRequest::get_tensor(port);
+    }
     const auto infer_request = get_request(port);
     auto tensor = infer_request->get_tensor(port);
     if (!tensor._so) {
@@ -82,7 +117,13 @@ void ov::hetero::InferRequest::set_tensor(const ov::Output<const ov::Node>& port
                                           const ov::SoPtr<ov::ITensor>& tensor) {
     if (auto remote = std::dynamic_pointer_cast<ov::hetero::RemoteTensor>(tensor._ptr)) {
         auto device_name = get_request(port)->get_compiled_model()->get_context()->get_device_name();
+        if (!m_stage_pools.empty()) {
+            ov::ISyncInferRequest::set_tensor(port, remote->get_tensor_by_name(device_name));
+            return;
+        }
         get_request(port)->set_tensor(port, remote->get_tensor_by_name(device_name));
+    } else if (!m_stage_pools.empty()) {
+        ov::ISyncInferRequest::set_tensor(port, tensor);
     } else {
         get_request(port)->set_tensor(port, tensor);
     }
@@ -90,6 +131,9 @@ void ov::hetero::InferRequest::set_tensor(const ov::Output<const ov::Node>& port
 
 std::vector<ov::SoPtr<ov::ITensor>> ov::hetero::InferRequest::get_tensors(
     const ov::Output<const ov::Node>& port) const {
+    if (!m_stage_pools.empty()) {
+        return ov::ISyncInferRequest::get_tensors(port);
+    }
     const auto infer_request = get_request(port);
     auto tensors = infer_request->get_tensors(port);
     for (auto& tensor : tensors) {
@@ -102,10 +146,16 @@ std::vector<ov::SoPtr<ov::ITensor>> ov::hetero::InferRequest::get_tensors(
 
 void ov::hetero::InferRequest::set_tensors(const ov::Output<const ov::Node>& port,
                                            const std::vector<ov::SoPtr<ov::ITensor>>& tensors) {
+    if (!m_stage_pools.empty()) {
+        return ov::ISyncInferRequest::set_tensors(port, tensors);
+    }
     return get_request(port)->set_tensors(port, tensors);
 }
 
 void ov::hetero::InferRequest::check_tensors() const {
+    if (!m_stage_pools.empty()) {
+        return ov::ISyncInferRequest::check_tensors();
+    }
     // Ignore `check_tensor` of inputs and outputs of Hetero Compiled Model because
     // `m_tensors` are not allocated
     return;
@@ -125,12 +175,91 @@ std::vector<ov::SoPtr<ov::IVariableState>> ov::hetero::InferRequest::query_state
 }
 
 void ov::hetero::InferRequest::infer() {
+    if (!m_stage_pools.empty()) {
+        for (size_t stage = 0; stage < m_stage_pools.size(); stage++) {
+            const auto& pool = m_stage_pools[stage];
+            std::promise<StagePool::Lease> promise;
+            auto future = promise.get_future();
+            pool->acquire([&promise](const StagePool::Lease& lease) {
+                promise.set_value(lease);
+            });
+            const auto lease = future.get();
+            try {
+                bind_stage(stage, lease);
+                m_subrequests[stage]->infer();
+            } catch (...) {
+                pool->release_request(lease.request);
+                release_slots();
+                throw;
+            }
+            pool->release_request(lease.request);
+        }
+        release_slots();
+        return;
+    }
     for (auto&& request : m_subrequests) {
         OPENVINO_ASSERT(request);
         request->infer();
     }
 }
 
+void ov::hetero::InferRequest::bind_stage(size_t stage, const StagePool::Lease& lease) {
+    const auto compiled_model = std::static_pointer_cast<const ov::hetero::CompiledModel>(get_compiled_model());
+    const auto& mapping_info = compiled_model->m_mapping_info;
+    const auto& request = m_stage_pools[stage]->get_request(lease.request);
+    m_subrequests[stage] = request;
+    m_slots[stage] = lease.slot;
+
+    const auto& submodel = request->get_compiled_model();
+    for (size_t i = 0; i < mapping_info._inputs_to_submodels_inputs.size(); i++) {
+        const auto& input = mapping_info._inputs_to_submodels_inputs[i];
+        if (input.first == stage) {
+            request->set_tensor(submodel->inputs()[input.second], ov::ISyncInferRequest::get_tensor(get_inputs()[i]));
+        }
+    }
+    for (size_t i = 0; i < mapping_info._outputs_to_submodels_outputs.size(); i++) {
+        const auto& output = mapping_info._outputs_to_submodels_outputs[i];
+        if (output.first == stage) {
+            request->set_tensor(submodel->outputs()[output.second],
+                                ov::ISyncInferRequest::get_tensor(get_outputs()[i]));
+        }
+    }
+    for (const auto& kvp : mapping_info._submodels_input_to_prev_output) {
+        if (kvp.first.first == stage) {
+            request->set_tensor(submodel->inputs()[kvp.first.second], get_linked_tensor(kvp.second));
+        } else if (kvp.second.first == stage) {
+            // the outputs of the model are already bound above
+            if (auto tensor = m_stage_pools[stage]->get_tensor(lease.slot, kvp.second.second)) {
+                request->set_tensor(submodel->outputs()[kvp.second.second], tensor);
+            }
+        }
+    }
+}
+
+ov::SoPtr<ov::ITensor> ov::hetero::InferRequest::get_linked_tensor(const NodeInfo& output) const {
+    if (auto tensor = m_stage_pools[output.first]->get_tensor(m_slots[output.first], output.second)) {
+        return tensor;
+    }
+    const auto compiled_model = std::static_pointer_cast<const ov::hetero::CompiledModel>(get_compiled_model());
+    const auto& model_outputs = compiled_model->m_mapping_info._outputs_to_submodels_outputs;
+    const auto it = std::find(model_outputs.begin(), model_outputs.end(), output);
+    OPENVINO_ASSERT(it != model_outputs.end(),
+                    "Cannot find the tensor of submodel ",
+                    output.first,
+                    " output ",
+                    output.second);
+    return ov::ISyncInferRequest::get_tensor(get_outputs()[std::distance(model_outputs.begin(), it)]);
+}
+
+void ov::hetero::InferRequest::release_slots() {
+    for (size_t stage = 0; stage < m_slots.size(); stage++) {
+        if (m_slots[stage] != std::numeric_limits<size_t>::max()) {
+            m_stage_pools[stage]->release_slot(m_slots[stage]);
+            m_slots[stage] = std::numeric_limits<size_t>::max();
+        }
+    }
+}
+
 std::vector<ov::ProfilingInfo> ov::hetero::InferRequest::get_profiling_info() const {
     std::vector<ov::ProfilingInfo> info;
     for (size_t i = 0; i < m_subrequests.size(); ++i) {
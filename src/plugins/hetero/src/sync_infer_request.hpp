@@ -15,12 +15,15 @@
 #include "openvino/runtime/iasync_infer_request.hpp"
 #include "openvino/runtime/isync_infer_request.hpp"
 #include "openvino/runtime/so_ptr.hpp"
+#include "stage_pool.hpp"
+#include "subgraph_collector.hpp"
 
 namespace ov {
 namespace hetero {
 
 class CompiledModel;
 class AsyncInferRequest;
+struct StageExecutor;
 
 class InferRequest : public ov::ISyncInferRequest {
 public:
@@ -47,11 +50,22 @@ public:
 
 private:
     friend class AsyncInferRequest;
+    friend struct StageExecutor;
 
     ov::SoPtr<ov::IAsyncInferRequest> get_request(const ov::Output<const ov::Node>& port) const;
 
+    // binds the leased request of the stage to the tensors of the model and the slots of the previous stages
+    void bind_stage(size_t stage, const StagePool::Lease& lease);
+    ov::SoPtr<ov::ITensor> get_linked_tensor(const NodeInfo& output) const;
+    void release_slots();
+
     std::vector<ov::SoPtr<ov::IAsyncInferRequest>> m_subrequests;
     std::map<ov::Output<const ov::Node>, size_t> m_port_to_subrequest_idx;
+
+    // not empty in the pipeline mode (see ov::hetero::pipeline_depth)
+    std::vector<std::shared_ptr<StagePool>> m_stage_pools;
+    // the slots of the stages leased by the current inference, max size_t if not leased
+    std::vector<size_t> m_slots;
 };
 
 }  // namespace hetero
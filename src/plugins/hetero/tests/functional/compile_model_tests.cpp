@@ -6,6 +6,7 @@
 #include "openvino/runtime/exec_model_info.hpp"
 #include "openvino/runtime/internal_properties.hpp"
 #include "openvino/runtime/properties.hpp"
+#include "properties.hpp"
 
 using namespace ov::hetero::tests;
 
@@ -123,4 +124,53 @@ TEST_F(HeteroTests, get_runtime_model) {
         ASSERT_TRUE(info.count(ov::exec_model_info::OUTPUT_PRECISIONS));
     }
     EXPECT_EQ(0, original_names.size());
-}
\ No newline at end of file
+}
+
+TEST_F(HeteroTests, infer_with_pipeline_depth) {
+    ov::AnyMap config = {ov::device::priorities("MOCK0,MOCK1"), ov::hetero::pipeline_depth(2)};
+    auto model = create_model_with_subtract();
+    auto compiled_model = core.compile_model(model, ov::test::utils::DEVICE_HETERO, config);
+    EXPECT_EQ(2, compiled_model.get_property(ov::hetero::pipeline_depth));
+
+    // more requests than the submodel requests in the pools
+    std::vector<ov::InferRequest> infer_requests;
+    std::vector<ov::Tensor> input_tensors;
+    for (size_t i = 0; i < 5; i++) {
+        auto input_tensor =
+            create_and_fill_tensor(compiled_model.input().get_element_type(), compiled_model.input().get_shape());
+        input_tensor.data<int64_t>()[0] = static_cast<int64_t>(i) * 100;
+        auto infer_request = compiled_model.create_infer_request();
+        infer_request.set_input_tensor(input_tensor);
+        infer_requests.emplace_back(std::move(infer_request));
+        input_tensors.emplace_back(std::move(input_tensor));
+    }
+    for (size_t iteration = 0; iteration < 3; iteration++) {
+        for (auto& infer_request : infer_requests) {
+            infer_request.start_async();
+        }
+        for (size_t i = 0; i < infer_requests.size(); i++) {
+            infer_requests[i].wait();
+            auto output_tensor = infer_requests[i].get_output_tensor();
+            ASSERT_EQ(input_tensors[i].get_shape(), output_tensor.get_shape());
+            EXPECT_EQ(memcmp(input_tensors[i].data(), output_tensor.data(), input_tensors[i].get_byte_size()), 0);
+        }
+    }
+    // the synchronous inference leases the submodel requests the same way
+    infer_requests[1].infer();
+    auto output_tensor = infer_requests[1].get_output_tensor();
+    EXPECT_EQ(memcmp(input_tensors[1].data(), output_tensor.data(), input_tensors[1].get_byte_size()), 0);
+}
+
+TEST_F(HeteroTests, compile_with_partitioning_by_cost) {
+    ov::AnyMap config = {ov::device::priorities("MOCK0,MOCK1"), ov::hetero::partitioning_by_cost(true)};
+    auto model = create_model_with_subtract_reshape();
+    auto compiled_model = core.compile_model(model, ov::test::utils::DEVICE_HETERO, config);
+    auto statistics = compiled_model.get_property(ov::hetero::partition_statistics);
+    EXPECT_EQ(compiled_model.get_property(ov::hetero::number_of_submodels), statistics.size());
+    for (const auto& submodel : statistics) {
+        const auto& estimations = submodel.second.as<ov::AnyMap>();
+        ASSERT_TRUE(estimations.count("DEVICE"));
+        ASSERT_TRUE(estimations.count("COMPUTE_US"));
+        ASSERT_TRUE(estimations.count("TRANSFER_US"));
+    }
+}
@@ -0,0 +1,86 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cost_model.hpp"
+
+#include <gtest/gtest.h>
+
+#include "openvino/op/ops.hpp"
+
+using namespace ov::hetero;
+
+namespace {
+// input -> matmul1 -> relu -> matmul2 -> res
+std::shared_ptr<ov::Model> create_matmul_model() {
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{1, 256});
+    param->set_friendly_name("input");
+    auto weights1 = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{256, 256}, {1});
+    weights1->set_friendly_name("weights1");
+    auto matmul1 = std::make_shared<ov::op::v0::MatMul>(param, weights1);
+    matmul1->set_friendly_name("matmul1");
+    auto relu = std::make_shared<ov::op::v0::Relu>(matmul1);
+    relu->set_friendly_name("relu");
+    auto weights2 = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{256, 256}, {1});
+    weights2->set_friendly_name("weights2");
+    auto matmul2 = std::make_shared<ov::op::v0::MatMul>(relu, weights2);
+    matmul2->set_friendly_name("matmul2");
+    auto result = std::make_shared<ov::op::v0::Result>(matmul2);
+    result->set_friendly_name("res");
+    return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param});
+}
+
+ov::SupportedOpsMap supported_ops(const std::string& device, const std::vector<std::string>& names) {
+    ov::SupportedOpsMap result;
+    for (const auto& name : names) {
+        result[name] = device;
+    }
+    return result;
+}
+
+const std::vector<std::string> all_ops = {"input", "weights1", "matmul1", "relu", "weights2", "matmul2", "res"};
+}  // namespace
+
+TEST(CostModelTest, matmul_flops) {
+    const auto model = create_matmul_model();
+    for (const auto& op : model->get_ordered_ops()) {
+        if (op->get_friendly_name() == "matmul1") {
+            EXPECT_EQ(2.0 * 256 * 256, CostModel::get_flops(op));
+        } else if (op->get_friendly_name() == "relu") {
+            EXPECT_EQ(256.0, CostModel::get_flops(op));
+        } else if (op->get_friendly_name() == "weights1") {
+            EXPECT_EQ(0.0, CostModel::get_flops(op));
+        }
+    }
+}
+
+TEST(CostModelTest, prefers_faster_device) {
+    const auto model = create_matmul_model();
+    const std::map<std::string, ov::SupportedOpsMap> query_results = {{"MOCK0", supported_ops("MOCK0", all_ops)},
+                                                                      {"MOCK1", supported_ops("MOCK1", all_ops)}};
+    const auto result =
+        partition_by_cost(model, {"MOCK0", "MOCK1"}, query_results, CostModel{{{"MOCK0", 1.0f}, {"MOCK1", 1000.0f}}});
+    EXPECT_EQ(supported_ops("MOCK1", all_ops), result);
+}
+
+TEST(CostModelTest, keeps_cheap_node_with_neighbours) {
+    const auto model = create_matmul_model();
+    const std::map<std::string, ov::SupportedOpsMap> query_results = {{"MOCK0", supported_ops("MOCK0", all_ops)},
+                                                                      {"MOCK1", supported_ops("MOCK1", {"relu"})}};
+    // the priority would move relu to MOCK1, which costs two transfers
+    const auto result =
+        partition_by_cost(model, {"MOCK1", "MOCK0"}, query_results, CostModel{{{"MOCK0", 100.0f}, {"MOCK1", 100.0f}}});
+    EXPECT_EQ(supported_ops("MOCK0", all_ops), result);
+}
+
+TEST(CostModelTest, splits_when_compute_dominates) {
+    const auto model = create_matmul_model();
+    const std::vector<std::string> mock1_ops = {"input", "weights1", "matmul1", "weights2", "matmul2", "res"};
+    const std::map<std::string, ov::SupportedOpsMap> query_results = {{"MOCK0", supported_ops("MOCK0", all_ops)},
+                                                                      {"MOCK1", supported_ops("MOCK1", mock1_ops)}};
+    const auto result =
+        partition_by_cost(model, {"MOCK0", "MOCK1"}, query_results, CostModel{{{"MOCK0", 1.0f}, {"MOCK1", 1000.0f}}});
+    auto expected = supported_ops("MOCK1", mock1_ops);
+    expected["relu"] = "MOCK0";
+    EXPECT_EQ(expected, result);
+}
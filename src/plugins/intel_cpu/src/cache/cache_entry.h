@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
@@ -17,7 +18,16 @@ class CacheEntryBase {
 public:
     enum class LookUpStatus : int8_t { Hit, Miss };
 
+    struct Statistics {
+        size_t hits = 0;
+        size_t misses = 0;
+        size_t evictions = 0;
+        size_t records = 0;
+    };
+
     virtual ~CacheEntryBase() = default;
+
+    [[nodiscard]] virtual Statistics getStatistics() const = 0;
 };
 
 /**
@@ -26,7 +36,8 @@ public:
  * comparison operator.
  * @tparam ValType is a type that must meet all the requirements to the std::unordered_map mapped type
  * @tparam ImplType is a type for the internal storage. It must provide put(KeyType, ValueType) and ValueType get(const
- * KeyType&) interface and must have constructor of type ImplType(size_t).
+ * KeyType&) interface and must have constructor of type ImplType(size_t). The put method returns the number of evicted
+ * records. The lookup statistics are thread safe, so the entry is thread safe as long as ImplType is.
  *
  * @note In this implementation default constructed value objects are treated as empty objects.
  */
@@ -57,15 +68,30 @@ public:
         auto retEmpty = ValType();
         if (retVal == retEmpty) {
             retStatus = LookUpStatus::Miss;
+            _misses.fetch_add(1, std::memory_order_relaxed);
             retVal = builder(key);
             if (retVal != retEmpty) {
-                _impl.put(key, retVal);
+                _evictions.fetch_add(_impl.put(key, retVal), std::memory_order_relaxed);
             }
+        } else {
+            _hits.fetch_add(1, std::memory_order_relaxed);
         }
         return {retVal, retStatus};
     }
 
+    [[nodiscard]] Statistics getStatistics() const override {
+        return {_hits.load(std::memory_order_relaxed),
+                _misses.load(std::memory_order_relaxed),
+                _evictions.load(std::memory_order_relaxed),
+                _impl.size()};
+    }
+
     ImplType _impl;
+
+private:
+    std::atomic_size_t _hits{0};
+    std::atomic_size_t _misses{0};
+    std::atomic_size_t _evictions{0};
 };
 
 }  // namespace ov::intel_cpu
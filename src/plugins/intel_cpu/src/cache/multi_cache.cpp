@@ -5,9 +5,50 @@
 #include "multi_cache.h"
 
 #include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
 
 namespace ov::intel_cpu {
 
 std::atomic_size_t MultiCache::_typeIdCounter{0};
 
+CacheEntryBase::Statistics MultiCache::getStatistics() const {
+    std::shared_lock<std::shared_mutex> lock;
+    if (_storageMutex) {
+        lock = std::shared_lock<std::shared_mutex>(*_storageMutex);
+    }
+
+    CacheEntryBase::Statistics result;
+    for (const auto& [id, entry] : _storage) {
+        const auto stats = entry->getStatistics();
+        result.hits += stats.hits;
+        result.misses += stats.misses;
+        result.evictions += stats.evictions;
+        result.records += stats.records;
+    }
+    return result;
+}
+
+std::shared_ptr<MultiCache> MultiCache::getProcessShared(size_t capacity) {
+    static std::mutex mutex;
+    static std::map<size_t, std::weak_ptr<MultiCache>> sharedCaches;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto& sharedCache = sharedCaches[capacity];
+    auto cache = sharedCache.lock();
+    if (!cache) {
+        cache = std::make_shared<MultiCache>(capacity, true);
+        sharedCache = cache;
+    }
+    // the number of distinct capacities is small, so the expired records are just dropped on the way
+    for (auto it = sharedCaches.begin(); it != sharedCaches.end();) {
+        it = it->second.expired() ? sharedCaches.erase(it) : std::next(it);
+    }
+    return cache;
+}
+
 }  // namespace ov::intel_cpu
@@ -7,17 +7,38 @@
 #include <atomic>
 #include <cstddef>
 #include <memory>
+#include <mutex>
+#include <oneapi/dnnl/dnnl.hpp>
+#include <shared_mutex>
 #include <type_traits>
 #include <unordered_map>
+#include <utility>
 
 #include "cache_entry.h"
+#include "sharded_lru_cache.h"
 
 namespace ov::intel_cpu {
 
+/**
+ * @brief Defines whether the cached values of the type may be executed by several threads at the same time, i.e. the
+ * value keeps no state modified during the execution. The oneDNN primitives are such values, while the executors of the
+ * plugin nodes normally own working buffers or a oneDNN stream. Only the shareable values are looked up in the
+ * process-wide cache (see cpu_runtime_cache_shared).
+ */
+template <typename ValueType>
+struct IsShareableCacheValue : std::is_base_of<dnnl::primitive, ValueType> {};
+
 /**
  * @brief Class that represent a preemptive cache for different key/value pair types.
  *
- * @attention This implementation IS NOT THREAD SAFE!
+ * @attention This implementation IS NOT THREAD SAFE unless it is created in the thread safe mode!
+ * In the thread safe mode the records are stored in the lock-striped ShardedLruCache. Such a cache is meant to be the
+ * shared backend of the per stream caches: a per stream cache looks up the shareable values (see IsShareableCacheValue)
+ * in the backend and keeps all the other ones to itself, so no value with a mutable state is ever used by two streams.
+ * Note that the same value may be built concurrently by several threads on a simultaneous miss in the backend, in this
+ * case the value built last is kept.
+ * A cache may also be created without caching the values with the mutable state at all: the nodes executed concurrently
+ * inside one stream (see cpu_parallel_branches) must not get the same executor for the equal keys.
  */
 
 class MultiCache {
@@ -32,7 +53,19 @@ public:
      * @param capacity here means maximum records limit FOR EACH entry specified by a pair of Key/Value types.
      * @note zero capacity means empty cache so no records are stored and no entries are created
      */
-    explicit MultiCache(size_t capacity) : _capacity(capacity) {}
+    explicit MultiCache(size_t capacity, bool threadSafe = false)
+        : _capacity(capacity),
+          _storageMutex(threadSafe ? std::make_shared<std::shared_mutex>() : nullptr) {}
+
+    /**
+     * @param capacity is the records limit of the values kept by this cache
+     * @param sharedCache is the thread safe cache the shareable values are looked up in, may be nullptr
+     * @param cacheStatefulValues is false if the values which are not shareable are always built anew
+     */
+    MultiCache(size_t capacity, std::shared_ptr<MultiCache> sharedCache, bool cacheStatefulValues = true)
+        : _capacity(capacity),
+          _sharedCache(std::move(sharedCache)),
+          _cacheStatefulValues(cacheStatefulValues) {}
 
     /**
      * @brief Searches a value of ValueType in the cache using the provided key or creates a new ValueType instance (if
@@ -47,19 +80,59 @@ public:
               typename BuilderType,
               typename ValueType = std::invoke_result_t<BuilderType&, const KeyType&>>
     typename CacheEntry<KeyType, ValueType>::ResultType getOrCreate(const KeyType& key, BuilderType builder) {
-        auto entry = getEntry<KeyType, ValueType>();
+        if constexpr (IsShareableCacheValue<ValueType>::value) {
+            if (_sharedCache) {
+                return _sharedCache->getOrCreate(key, std::move(builder));
+            }
+        } else {
+            if (!_cacheStatefulValues) {
+                return {builder(key), CacheEntryBase::LookUpStatus::Miss};
+            }
+        }
+        if (_storageMutex) {
+            using SyncEntryType = CacheEntry<KeyType, ValueType, ShardedLruCache<KeyType, ValueType>>;
+            auto entry = getEntry<SyncEntryType>();
+            return entry->getOrCreate(key, std::move(builder));
+        }
+        auto entry = getEntry<EntryTypeT<KeyType, ValueType>>();
         return entry->getOrCreate(key, std::move(builder));
     }
 
+    [[nodiscard]] bool isThreadSafe() const {
+        return _storageMutex != nullptr;
+    }
+
+    // nullptr if the cache does not share the shareable values with other caches
+    [[nodiscard]] const std::shared_ptr<MultiCache>& getSharedCache() const {
+        return _sharedCache;
+    }
+
+    /**
+     * @brief Returns the lookup statistics accumulated over all the key/value pair types, the lookups in the shared
+     * cache are not included
+     */
+    [[nodiscard]] CacheEntryBase::Statistics getStatistics() const;
+
+    /**
+     * @brief Returns the process-wide thread safe cache of the given capacity to be used as the shared backend of the
+     * per stream caches. The caches created with different capacities are independent, so a compiled model always gets
+     * the capacity it was configured with. The cache lives as long as any per stream cache refers to it.
+     */
+    static std::shared_ptr<MultiCache> getProcessShared(size_t capacity);
+
 private:
     template <typename T>
     size_t getTypeId();
-    template <typename KeyType, typename ValueType>
-    EntryPtr<KeyType, ValueType> getEntry();
+    template <typename EntryType>
+    std::shared_ptr<EntryType> getEntry();
 
     static std::atomic_size_t _typeIdCounter;
     size_t _capacity;
     std::unordered_map<size_t, EntryBasePtr> _storage;
+    // guards the storage in the thread safe mode, nullptr otherwise
+    std::shared_ptr<std::shared_mutex> _storageMutex;
+    std::shared_ptr<MultiCache> _sharedCache;
+    bool _cacheStatefulValues = true;
 };
 
 template <typename T>
@@ -68,10 +141,21 @@ size_t MultiCache::getTypeId() {
     return id;
 }
 
-template <typename KeyType, typename ValueType>
-MultiCache::EntryPtr<KeyType, ValueType> MultiCache::getEntry() {
-    using EntryType = EntryTypeT<KeyType, ValueType>;
+template <typename EntryType>
+std::shared_ptr<EntryType> MultiCache::getEntry() {
     size_t id = getTypeId<EntryType>();
+    if (_storageMutex) {
+        // fast path: the entry for the given types is normally created once and then only looked up
+        std::shared_lock<std::shared_mutex> lock(*_storageMutex);
+        auto itr = _storage.find(id);
+        if (itr != _storage.end()) {
+            return std::static_pointer_cast<EntryType>(itr->second);
+        }
+    }
+    std::unique_lock<std::shared_mutex> lock;
+    if (_storageMutex) {
+        lock = std::unique_lock<std::shared_mutex>(*_storageMutex);
+    }
     auto itr = _storage.find(id);
     if (itr == _storage.end()) {
         auto result = _storage.insert({id, std::make_shared<EntryType>(_capacity)});
@@ -0,0 +1,105 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <mutex>
+#include <utility>
+
+#include "lru_cache.h"
+
+/**
+ * @brief Thread safe LRU cache built on top of the LruCache.
+ * The records are distributed over a fixed number of independently locked shards by the key hash,
+ * so the concurrent lookups of different keys rarely contend for the same lock.
+ * The eviction policy is LRU within a shard, the capacity is split evenly among the shards (rounded up to a multiple of
+ * the shards number).
+ * @tparam Key is a key type that must define hash() const method with return type convertible to size_t and define
+ * comparison operator.
+ * @tparam Value is a type that must meet all the requirements to the std::unordered_map mapped type
+ */
+
+namespace ov::intel_cpu {
+
+template <typename Key, typename Value>
+class ShardedLruCache {
+public:
+    static constexpr size_t numShards = 16;
+
+    explicit ShardedLruCache(size_t capacity)
+        : _capacity(shardCapacity(capacity) * numShards),
+          _shards(makeShards(shardCapacity(capacity))) {}
+
+    /**
+     * @brief Puts the value associated with the key into the cache.
+     * @param key
+     * @param value
+     * @return number of records evicted to free space for the new one
+     */
+    size_t put(const Key& key, const Value& val) {
+        auto& shard = getShard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        return shard.cache.put(key, val);
+    }
+
+    /**
+     * @brief Searches a value associated with the key.
+     * @param key
+     * @return Value associated with the key or default constructed instance of the Value type.
+     */
+    Value get(const Key& key) {
+        auto& shard = getShard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        return shard.cache.get(key);
+    }
+
+    [[nodiscard]] size_t getCapacity() const noexcept {
+        return _capacity;
+    }
+
+    /**
+     * @brief Returns the number of records stored in all the shards
+     */
+    [[nodiscard]] size_t size() const {
+        size_t result = 0;
+        for (auto& shard : _shards) {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            result += shard.cache.size();
+        }
+        return result;
+    }
+
+private:
+    struct Shard {
+        explicit Shard(size_t capacity) : cache(capacity) {}
+        mutable std::mutex mutex;
+        LruCache<Key, Value> cache;
+    };
+
+    using Shards = std::array<Shard, numShards>;
+
+    static constexpr size_t shardCapacity(size_t capacity) {
+        return (capacity + numShards - 1) / numShards;
+    }
+
+    template <size_t... I>
+    static Shards makeShards(size_t capacity, std::index_sequence<I...> /*unused*/) {
+        return {{((void)I, Shard(capacity))...}};
+    }
+
+    static Shards makeShards(size_t capacity) {
+        return makeShards(capacity, std::make_index_sequence<numShards>{});
+    }
+
+    Shard& getShard(const Key& key) {
+        return _shards[key.hash() % numShards];
+    }
+
+    size_t _capacity;
+    Shards _shards;
+};
+
+}  // namespace ov::intel_cpu
@@ -5,24 +5,37 @@
 #include "compiled_model.h"
 
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <cstring>
 #include <exception>
+#include <future>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <ostream>
+#include <string>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
 #include "async_infer_request.h"
+#include "cache/cache_entry.h"
+#include "cache/multi_cache.h"
 #include "config.h"
+#include "cpu_memory.h"
 #include "graph.h"
 #include "graph_context.h"
 #include "infer_request.h"
 #include "internal_properties.hpp"
+#include "kv_cache_memory.hpp"
 #include "low_precision/low_precision.hpp"
+#include "memory_control.hpp"
 #include "openvino/core/any.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/core/model.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/result.hpp"
 #include "openvino/runtime/iasync_infer_request.hpp"
 #include "openvino/runtime/icompiled_model.hpp"
 #include "openvino/runtime/intel_cpu/properties.hpp"
@@ -30,12 +43,17 @@
 #include "openvino/runtime/isync_infer_request.hpp"
 #include "openvino/runtime/properties.hpp"
 #include "openvino/runtime/threading/cpu_message.hpp"
+#include "openvino/runtime/threading/cpu_streams_executor.hpp"
 #include "openvino/runtime/threading/cpu_streams_info.hpp"
 #include "openvino/runtime/threading/istreams_executor.hpp"
 #include "openvino/runtime/threading/itask_executor.hpp"
+#include "packed_weights.hpp"
+#include "pipeline_infer_request.h"
+#include "pipeline_stages.hpp"
 #include "sub_memory_manager.hpp"
 #include "utils/debug_capabilities.h"
 #include "utils/general_utils.h"
+#include "utils/hw_perf_counters.h"
 #include "utils/memory_stats_dump.hpp"
 #include "utils/serialize.hpp"
 
@@ -59,6 +77,11 @@ struct ImmediateSerialExecutor : public ov::threading::ITaskExecutor {
 };
 
 CompiledModel::~CompiledModel() {
+    if (m_optimized_tier) {
+        // the background compilation runs the code of the plugin, so it must not outlive the compiled model
+        m_optimized_tier->cancelled = true;
+        m_optimized_tier->compiled.wait();
+    }
     if (m_has_sub_compiled_models) {
         m_sub_compiled_models.clear();
         m_sub_memory_manager->_memorys_table.clear();
@@ -83,6 +106,9 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
       m_loaded_from_cache(loaded_from_cache),
       m_sub_memory_manager(std::move(sub_memory_manager)) {
     m_mutex = std::make_shared<std::mutex>();
+    if (m_cfg.kvCacheMemoryBudget > 0) {
+        m_kv_cache_memory = std::make_shared<KVCacheMemory>(m_cfg.kvCacheMemoryBudget, m_cfg.kvCacheSpillDir);
+    }
     const auto& core = m_plugin->get_core();
     OPENVINO_ASSERT(core, "Unable to get API version. Core is unavailable");
 
@@ -116,11 +142,16 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
 
     m_optimized_single_stream = all_of(1, executor_config.get_streams(), executor_config.get_threads());
 
-    int streams = std::max(1, executor_config.get_streams());
+    m_pipelined = m_cfg.numSubStreams > 0 && m_cfg.modelDistributionPolicy.count(
+                                                 ov::hint::ModelDistributionPolicy::PIPELINE_PARALLEL) != 0;
+    // the stages own the weights, so the whole model is not compiled in the pipeline mode
+    int streams = m_pipelined ? 0 : std::max(1, executor_config.get_streams());
     std::vector<Task> tasks;
     tasks.resize(streams);
     m_graphs.resize(streams);
-    if (executor_config.get_streams() != 0) {
+    if (m_pipelined) {
+        // the graphs are created by the stages
+    } else if (executor_config.get_streams() != 0) {
         auto all_graphs_ready = [&] {
             return std::all_of(m_graphs.begin(), m_graphs.end(), [&](Graph& graph) {
                 return graph.IsReady();
@@ -144,11 +175,37 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
     } else {
         CompiledModel::get_graph();
     }
-    if (m_cfg.numSubStreams > 0) {
+    if (m_pipelined) {
+        m_pipeline_stages = splitIntoPipelineStages(model, m_cfg.numSubStreams);
+        auto stage_cfg = m_cfg;
+        stage_cfg.numSubStreams = 0;
+        stage_cfg.modelDistributionPolicy = {};
+        const auto streams_info_table = m_cfg.streamExecutorConfig.get_streams_info_table();
+        // every stage runs on its own sub-stream, so its graph and weights are allocated on the socket of the stream
+        for (size_t i = 0; i < m_pipeline_stages.models.size(); i++) {
+            std::vector<std::vector<int>> stage_streams_table;
+            stage_streams_table.push_back(streams_info_table[i + 1]);
+            stage_streams_table[0][NUMBER_OF_STREAMS] = 1;
+            stage_cfg.streamExecutorConfig = IStreamsExecutor::Config{"CPUStreamsExecutor",
+                                                                      1,
+                                                                      1,
+                                                                      ov::hint::SchedulingCoreType::ANY_CORE,
+                                                                      false,
+                                                                      true,
+                                                                      true,
+                                                                      std::move(stage_streams_table)};
+            m_sub_compiled_models.push_back(std::make_shared<CompiledModel>(m_pipeline_stages.models[i],
+                                                                            plugin,
+                                                                            stage_cfg,
+                                                                            loaded_from_cache));
+        }
+    } else if (m_cfg.numSubStreams > 0) {
         m_has_sub_compiled_models = true;
         auto sub_cfg = m_cfg;
         sub_cfg.numSubStreams = 0;
         sub_cfg.enableNodeSplit = true;
+        // the heads of the KV cache are split between the sub-streams as well
+        sub_cfg.kvCacheMemoryBudget = m_cfg.kvCacheMemoryBudget / m_cfg.numSubStreams;
         auto streams_info_table = m_cfg.streamExecutorConfig.get_streams_info_table();
         auto message = message_manager();
         m_sub_memory_manager = std::make_shared<SubMemoryManager>(m_cfg.numSubStreams);
@@ -172,21 +229,25 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
     }
 }
 
-CompiledModel::GraphGuard::Lock CompiledModel::get_graph() const {
+CompiledModel::GraphGuard::Lock CompiledModel::get_graph(bool optimized) const {
     int streamId = 0;
     int socketId = 0;
 
+    auto& graphs = optimized ? m_optimized_tier->graphs : m_graphs;
+    const auto& model = optimized ? m_optimized_tier->model : m_model;
+    const auto& cfg = optimized ? m_optimized_tier->cfg : m_cfg;
+
     size_t graph_idx = 0;
-    if (m_graphs.size() > 1) {
+    if (graphs.size() > 1) {
         auto streamsExecutor = std::dynamic_pointer_cast<IStreamsExecutor>(m_task_executor);
         if (nullptr != streamsExecutor) {
             streamId = streamsExecutor->get_stream_id();
             socketId = std::max(0, streamsExecutor->get_socket_id());
         }
-        graph_idx = streamId % m_graphs.size();
+        graph_idx = streamId % graphs.size();
     }
 
-    auto graphLock = GraphGuard::Lock(m_graphs[graph_idx]);
+    auto graphLock = GraphGuard::Lock(graphs[graph_idx]);
 
     if (!graphLock._graph.IsReady()) {
         std::exception_ptr exception;
@@ -196,16 +257,16 @@ CompiledModel::GraphGuard::Lock CompiledModel::get_graph() const {
                 GraphContext::Ptr ctx;
                 {
                     std::lock_guard<std::mutex> lock{*m_mutex};
-                    auto isQuantizedFlag = (m_cfg.lpTransformsMode == Config::On) &&
-                                           ov::pass::low_precision::LowPrecision::isFunctionQuantized(m_model);
-                    ctx = std::make_shared<GraphContext>(m_cfg,
+                    auto isQuantizedFlag = (cfg.lpTransformsMode == Config::On) &&
+                                           ov::pass::low_precision::LowPrecision::isFunctionQuantized(model);
+                    ctx = std::make_shared<GraphContext>(cfg,
                                                          m_socketWeights[socketId],
                                                          isQuantizedFlag,
                                                          streamsExecutor,
-                                                         m_sub_memory_manager);
+                                                         m_sub_memory_manager,
+                                                         m_kv_cache_memory);
                 }
 
-                const std::shared_ptr<const ov::Model> model = m_model;
                 graphLock._graph.Init(model, ctx);
                 graphLock._graph.Activate();
             } catch (...) {
@@ -224,12 +285,87 @@ CompiledModel::GraphGuard::Lock CompiledModel::get_graph() const {
     return graphLock;
 }
 
+void CompiledModel::compile_optimized_tier(OptimizedTierCompiler compiler, Config cfg) {
+    auto tier = std::make_shared<OptimizedTier>();
+    tier->cfg = std::move(cfg);
+    auto compiled = std::make_shared<std::promise<void>>();
+    tier->compiled = compiled->get_future().share();
+    m_optimized_tier = tier;
+
+    // a single thread stream, so the background compilation does not compete with the streams serving the requests
+    auto executor = m_plugin->get_executor_manager()->get_idle_cpu_streams_executor(
+        IStreamsExecutor::Config{"CPUTieredCompilationExecutor", 1, 1});
+    std::weak_ptr<const CompiledModel> weak_this = std::static_pointer_cast<const CompiledModel>(shared_from_this());
+    executor->run([compiler = std::move(compiler), tier, compiled, weak_this] {
+        // released after the promise is set, as the destructor of the compiled model waits for it
+        std::shared_ptr<const CompiledModel> compiled_model;
+        try {
+            if (!tier->cancelled) {
+                tier->model = compiler();
+                // the compiled model may be already destroyed, nothing to swap then
+                compiled_model = weak_this.lock();
+            }
+            if (compiled_model) {
+                compiled_model->init_optimized_graphs();
+                tier->ready = true;
+                if (compiled_model->m_quick_tier_requests == 0) {
+                    compiled_model->release_quick_tier();
+                }
+            }
+        } catch (...) {
+            // the requests are served by the quick tier further on
+            tier->exception = std::current_exception();
+        }
+        compiled->set_value();
+    });
+}
+
+void CompiledModel::init_optimized_graphs() const {
+    auto& graphs = m_optimized_tier->graphs;
+    graphs.resize(m_graphs.size());
+    // the graphs are created on the streams running them, in between the requests served by the quick tier
+    std::vector<Task> tasks(graphs.size(), [this] {
+        get_graph(true);
+    });
+    do {
+        m_task_executor->run_and_wait(tasks);
+    } while (!std::all_of(graphs.begin(), graphs.end(), [](Graph& graph) {
+        return graph.IsReady();
+    }));
+}
+
+void CompiledModel::release_quick_tier_request() const {
+    if (--m_quick_tier_requests == 0 && optimized_tier_ready()) {
+        release_quick_tier();
+    }
+}
+
+void CompiledModel::release_quick_tier() const {
+    // the weights cache refers to the weights weakly, so they are released together with the nodes of the graphs
+    std::lock_guard<std::mutex> lock{*m_mutex};
+    if (m_quick_tier_released) {
+        return;
+    }
+    m_graphs.clear();
+    m_quick_tier_released = true;
+}
+
 std::shared_ptr<ov::ISyncInferRequest> CompiledModel::create_sync_infer_request() const {
+    if (m_pipelined) {
+        return std::make_shared<PipelineSyncInferRequest>(
+            std::static_pointer_cast<const CompiledModel>(shared_from_this()));
+    }
     return std::make_shared<SyncInferRequest>(
         CompiledModelHolder(std::static_pointer_cast<const CompiledModel>(shared_from_this())));
 }
 
 std::shared_ptr<ov::IAsyncInferRequest> CompiledModel::create_infer_request() const {
+    if (m_pipelined) {
+        return std::make_shared<PipelineAsyncInferRequest>(
+            std::static_pointer_cast<PipelineSyncInferRequest>(create_sync_infer_request()),
+            get_task_executor(),
+            get_callback_executor());
+    }
     auto internal_request = create_sync_infer_request();
     auto async_infer_request =
         std::make_shared<AsyncInferRequest>(std::static_pointer_cast<SyncInferRequest>(internal_request),
@@ -249,18 +385,233 @@ std::shared_ptr<ov::IAsyncInferRequest> CompiledModel::create_infer_request() co
 }
 
 std::shared_ptr<const ov::Model> CompiledModel::get_runtime_model() const {
-    OPENVINO_ASSERT(!m_graphs.empty(), "No graph was found");
+    if (m_pipelined) {
+        // the stages are shown as the disconnected parts of one model
+        ov::ResultVector results;
+        ov::ParameterVector parameters;
+        for (const auto& stage : m_sub_compiled_models) {
+            const auto stage_model = stage->get_runtime_model();
+            results.insert(results.end(), stage_model->get_results().begin(), stage_model->get_results().end());
+            parameters.insert(parameters.end(),
+                              stage_model->get_parameters().begin(),
+                              stage_model->get_parameters().end());
+        }
+        return std::make_shared<ov::Model>(results, parameters, m_name);
+    }
+
+    OPENVINO_ASSERT(!graphs().empty(), "No graph was found");
 
     return get_graph()._graph.dump();
 }
 
 ov::Any CompiledModel::get_property(const std::string& name) const {
-    OPENVINO_ASSERT(!m_graphs.empty(), "No graph was found");
+    OPENVINO_ASSERT(!graphs().empty() || m_pipelined, "No graph was found");
 
     if (name == ov::loaded_from_cache) {
         return m_loaded_from_cache;
     }
 
+    if (name == ov::intel_cpu::cpu_optimized_tier_ready) {
+        return !m_optimized_tier || optimized_tier_ready();
+    }
+    if (name == ov::intel_cpu::cpu_quick_tier_released) {
+        std::lock_guard<std::mutex> lock{*m_mutex};
+        return decltype(ov::intel_cpu::cpu_quick_tier_released)::value_type(m_quick_tier_released);
+    }
+
+    if (name == ov::intel_cpu::cpu_runtime_cache_statistics) {
+        CacheEntryBase::Statistics stats;
+        std::unordered_set<const MultiCache*> visited;
+        for (auto& graph : graphs()) {
+            // the per stream cache is not thread safe, so wait until the stream is idle
+            GraphGuard::Lock lock(graph);
+            if (!graph.IsReady()) {
+                continue;
+            }
+            const auto& cache = graph.getGraphContext()->getParamsCache();
+            if (!cache) {
+                continue;
+            }
+            for (const auto* part : {cache.get(), cache->getSharedCache().get()}) {
+                if (!part || !visited.insert(part).second) {
+                    continue;
+                }
+                const auto cacheStats = part->getStatistics();
+                stats.hits += cacheStats.hits;
+                stats.misses += cacheStats.misses;
+                stats.evictions += cacheStats.evictions;
+                stats.records += cacheStats.records;
+            }
+        }
+        return decltype(ov::intel_cpu::cpu_runtime_cache_statistics)::value_type{
+            {"HITS", static_cast<uint64_t>(stats.hits)},
+            {"MISSES", static_cast<uint64_t>(stats.misses)},
+            {"EVICTIONS", static_cast<uint64_t>(stats.evictions)},
+            {"RECORDS", static_cast<uint64_t>(stats.records)}};
+    }
+
+    if (name == ov::intel_cpu::cpu_dynamic_shape_plans_statistics) {
+        DynamicShapePlan::Statistics stats;
+        for (auto& graph : graphs()) {
+            GraphGuard::Lock lock(graph);
+            if (!graph.IsReady()) {
+                continue;
+            }
+            const auto graphStats = graph.getShapePlansStatistics();
+            stats.hits += graphStats.hits;
+            stats.misses += graphStats.misses;
+            stats.evictions += graphStats.evictions;
+            stats.records += graphStats.records;
+        }
+        return decltype(ov::intel_cpu::cpu_dynamic_shape_plans_statistics)::value_type{
+            {"HITS", stats.hits},
+            {"MISSES", stats.misses},
+            {"EVICTIONS", stats.evictions},
+            {"RECORDS", stats.records}};
+    }
+
+    if (name == ov::intel_cpu::cpu_packed_weights_statistics) {
+        PackedWeights::Statistics stats;
+        for (auto& graph : graphs()) {
+            GraphGuard::Lock lock(graph);
+            if (!graph.IsReady()) {
+                continue;
+            }
+            if (const auto& packedWeights = graph.getGraphContext()->getPackedWeights()) {
+                const auto graphStats = packedWeights->getStatistics();
+                stats.inPlace += graphStats.inPlace;
+                stats.copied += graphStats.copied;
+                stats.repacked += graphStats.repacked;
+            }
+        }
+        return decltype(ov::intel_cpu::cpu_packed_weights_statistics)::value_type{
+            {"IN_PLACE", stats.inPlace},
+            {"COPIED", stats.copied},
+            {"REPACKED", stats.repacked}};
+    }
+
+    if (name == ov::intel_cpu::cpu_shared_activations_workspace_size) {
+        uint64_t size = 0;
+        for (auto& graph : graphs()) {
+            GraphGuard::Lock lock(graph);
+            if (!graph.IsReady()) {
+                continue;
+            }
+            if (const auto& sharedWorkspace = graph.getGraphContext()->getSharedWorkspace()) {
+                size = std::max<uint64_t>(size, sharedWorkspace->size());
+            }
+        }
+        return decltype(ov::intel_cpu::cpu_shared_activations_workspace_size)::value_type(size);
+    }
+
+    if (name == ov::intel_cpu::cpu_hw_perf_counters_statistics) {
+        // the events of a node are summed over the graphs of all the streams
+        struct NodeEvents {
+            HwEventValues sum{};
+            uint64_t count = 0;
+            uint64_t durationUs = 0;
+        };
+        std::map<std::string, NodeEvents> events;
+        HwPerfCounters::Ptr hwPerfCounters;
+        for (auto& graph : graphs()) {
+            GraphGuard::Lock lock(graph);
+            if (!graph.IsReady() || !graph.getGraphContext()->getHwPerfCounters()) {
+                continue;
+            }
+            hwPerfCounters = graph.getGraphContext()->getHwPerfCounters();
+            for (const auto& node : graph.GetNodes()) {
+                const auto& counter = node->PerfCounter();
+                if (counter.count() == 0) {
+                    continue;
+                }
+                auto& nodeEvents = events[node->getName()];
+                for (size_t i = 0; i < nodeEvents.sum.size(); i++) {
+                    nodeEvents.sum[i] += counter.hw_sum()[i];
+                }
+                nodeEvents.count += counter.count();
+                nodeEvents.durationUs += counter.avg() * counter.count();
+            }
+        }
+        ov::AnyMap statistics;
+        for (const auto& [nodeName, nodeEvents] : events) {
+            HwEventValues avg{};
+            for (size_t i = 0; i < avg.size(); i++) {
+                avg[i] = nodeEvents.sum[i] / nodeEvents.count;
+            }
+            statistics[nodeName] =
+                hwPerfCounters->toAnyMap(avg, static_cast<double>(nodeEvents.durationUs) / nodeEvents.count);
+        }
+        return decltype(ov::intel_cpu::cpu_hw_perf_counters_statistics)::value_type(statistics);
+    }
+
+    if (name == ov::intel_cpu::cpu_parallel_branches_inferences) {
+        uint64_t inferences = 0;
+        for (auto& graph : graphs()) {
+            GraphGuard::Lock lock(graph);
+            if (graph.IsReady()) {
+                inferences += graph.getParallelInferences();
+            }
+        }
+        return decltype(ov::intel_cpu::cpu_parallel_branches_inferences)::value_type(inferences);
+    }
+
+    if (name == ov::intel_cpu::cpu_streams_executor_statistics) {
+        ov::threading::CPUStreamsExecutor::Statistics stats;
+        if (auto executor = std::dynamic_pointer_cast<ov::threading::CPUStreamsExecutor>(m_task_executor)) {
+            stats = executor->get_statistics();
+        }
+        return decltype(ov::intel_cpu::cpu_streams_executor_statistics)::value_type{
+            {"TASKS", stats.tasks},
+            {"STEALS", stats.steals},
+            {"MISSED_DEADLINES", stats.missed_deadlines},
+            {"MAX_QUEUE_DEPTH", stats.max_queue_depth}};
+    }
+
+    if (name == ov::intel_cpu::cpu_kv_cache_statistics) {
+        KVCacheMemory::Statistics stats;
+        auto accumulate = [&stats](const KVCacheMemory::Ptr& kvCacheMemory) {
+            if (!kvCacheMemory) {
+                return;
+            }
+            const auto cacheStats = kvCacheMemory->getStatistics();
+            stats.residentBytes += cacheStats.residentBytes;
+            stats.spilledBytes += cacheStats.spilledBytes;
+            stats.spills += cacheStats.spills;
+            stats.refetches += cacheStats.refetches;
+        };
+        accumulate(m_kv_cache_memory);
+        for (const auto& sub_model : m_sub_compiled_models) {
+            accumulate(sub_model->m_kv_cache_memory);
+        }
+        return decltype(ov::intel_cpu::cpu_kv_cache_statistics)::value_type{
+            {"RESIDENT_BYTES", stats.residentBytes},
+            {"SPILLED_BYTES", stats.spilledBytes},
+            {"SPILLS", stats.spills},
+            {"REFETCHES", stats.refetches}};
+    }
+
+    if (m_pipelined) {
+        if (name == ov::model_name) {
+            return decltype(ov::model_name)::value_type(m_name);
+        }
+        if (name == ov::optimal_number_of_infer_requests) {
+            // one request per stage keeps all the stages busy
+            return static_cast<decltype(ov::optimal_number_of_infer_requests)::value_type>(
+                m_sub_compiled_models.size());
+        }
+        if (name == ov::inference_num_threads) {
+            int32_t num_threads = 0;
+            for (const auto& stage : m_sub_compiled_models) {
+                num_threads += stage->get_property(name).as<int32_t>();
+            }
+            return decltype(ov::inference_num_threads)::value_type(num_threads);
+        }
+        if (name == ov::hint::model_distribution_policy) {
+            return m_cfg.modelDistributionPolicy;
+        }
+        return m_sub_compiled_models.front()->get_property(name);
+    }
+
     Config engConfig = get_graph()._graph.getConfig();
     auto option = engConfig._config.find(name);
     if (option != engConfig._config.end()) {
@@ -404,12 +755,35 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
 }
 
 void CompiledModel::export_model(std::ostream& modelStream) const {
-    ModelSerializer serializer(modelStream, m_cfg.cacheEncrypt);
-    serializer << m_model;
+    if (m_pipelined) {
+        // the stages are cut again on the import
+        ModelSerializer serializer(modelStream, m_cfg.cacheEncrypt);
+        serializer << m_model;
+        return;
+    }
+
+    if (m_optimized_tier) {
+        // the exported model must not be the quick tier, as it would be imported instead of compiling the model
+        m_optimized_tier->compiled.wait();
+        if (m_optimized_tier->exception) {
+            std::rethrow_exception(m_optimized_tier->exception);
+        }
+    }
+
+    auto graphLock = get_graph();
+    std::vector<std::pair<size_t, MemoryCPtr>> packed_weights;
+    if (m_cfg.cachePackedWeights) {
+        if (const auto packed = graphLock._graph.getGraphContext()->getPackedWeights()) {
+            packed_weights = packed->getRecorded();
+        }
+    }
+
+    ModelSerializer serializer(modelStream, m_cfg.cacheEncrypt, std::move(packed_weights));
+    serializer << (m_optimized_tier ? m_optimized_tier->model : m_model);
 }
 
 void CompiledModel::release_memory() {
-    for (auto&& graph : m_graphs) {
+    auto release = [](GraphGuard& graph) {
         // try to lock mutex, since it may be already locked (e.g by an infer request)
         std::unique_lock<std::mutex> lock(graph._mutex, std::try_to_lock);
         OPENVINO_ASSERT(lock.owns_lock(),
@@ -417,6 +791,22 @@ void CompiledModel::release_memory() {
                         "infer requests are completed before releasing memory.");
         auto ctx = graph.getGraphContext();
         ctx->releaseMemory();
+    };
+    {
+        std::lock_guard<std::mutex> lock{*m_mutex};
+        for (auto&& graph : m_graphs) {
+            release(graph);
+        }
+    }
+    if (optimized_tier_ready()) {
+        for (auto&& graph : m_optimized_tier->graphs) {
+            release(graph);
+        }
+    }
+    if (m_pipelined) {
+        for (const auto& stage : m_sub_compiled_models) {
+            stage->release_memory();
+        }
     }
 }
 
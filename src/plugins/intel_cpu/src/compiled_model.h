@@ -6,6 +6,9 @@
 
 #include <atomic>
 #include <deque>
+#include <exception>
+#include <functional>
+#include <future>
 #include <memory>
 #include <mutex>
 #include <ostream>
@@ -15,6 +18,7 @@
 
 #include "config.h"
 #include "graph.h"
+#include "kv_cache_memory.hpp"
 #include "openvino/core/any.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/core/model.hpp"
@@ -23,6 +27,7 @@
 #include "openvino/runtime/iplugin.hpp"
 #include "openvino/runtime/isync_infer_request.hpp"
 #include "openvino/runtime/threading/itask_executor.hpp"
+#include "pipeline_stages.hpp"
 #include "sub_memory_manager.hpp"
 #include "weights_cache.hpp"
 
@@ -48,6 +53,12 @@ public:
 
     ~CompiledModel() override;
 
+    // Tiered compilation (see cpu_tiered_compilation): the model passed to the constructor is the quick tier, which
+    // serves the requests until the optimized tier returned by the compiler is ready. The compiler runs in the
+    // background, the graphs of the optimized tier are created on the streams afterwards.
+    using OptimizedTierCompiler = std::function<std::shared_ptr<ov::Model>()>;
+    void compile_optimized_tier(OptimizedTierCompiler compiler, Config cfg);
+
     std::shared_ptr<ov::IAsyncInferRequest> create_infer_request() const override;
 
     void export_model(std::ostream& model) const override;
@@ -70,6 +81,7 @@ public:
 private:
     std::shared_ptr<ov::ISyncInferRequest> create_sync_infer_request() const override;
     friend class CompiledModelHolder;
+    friend class PipelineSyncInferRequest;
 
     const std::shared_ptr<ov::Model> m_model;
     const std::shared_ptr<const ov::IPlugin> m_plugin;
@@ -88,11 +100,43 @@ private:
     mutable std::deque<GraphGuard> m_graphs;
     mutable SocketsWeights m_socketWeights;
 
+    struct OptimizedTier {
+        std::shared_ptr<ov::Model> model;
+        Config cfg;
+        std::deque<GraphGuard> graphs;
+        std::atomic_bool ready = {false};
+        // set by the destructor, so the queued compilation is skipped
+        std::atomic_bool cancelled = {false};
+        std::shared_future<void> compiled;
+        std::exception_ptr exception;
+    };
+    // nullptr if the tiered compilation is disabled
+    std::shared_ptr<OptimizedTier> m_optimized_tier = nullptr;
+    // the infer requests created with the quick tier, its graphs are released after the swap once there are none
+    mutable std::atomic_int m_quick_tier_requests = {0};
+    mutable bool m_quick_tier_released = false;
+
+    [[nodiscard]] bool optimized_tier_ready() const {
+        return m_optimized_tier && m_optimized_tier->ready;
+    }
+
+    // the graphs of the tier used by the new infer requests
+    std::deque<GraphGuard>& graphs() const {
+        return optimized_tier_ready() ? m_optimized_tier->graphs : m_graphs;
+    }
+
+    void init_optimized_graphs() const;
+    void release_quick_tier_request() const;
+    void release_quick_tier() const;
+
     /* WARNING: Use get_graph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
      *       even from main thread
      */
-    GraphGuard::Lock get_graph() const;
+    GraphGuard::Lock get_graph() const {
+        return get_graph(optimized_tier_ready());
+    }
+    GraphGuard::Lock get_graph(bool optimized) const;
 
     std::vector<std::shared_ptr<CompiledModel>> get_sub_compiled_models() const {
         return m_sub_compiled_models;
@@ -100,8 +144,14 @@ private:
 
     std::vector<std::shared_ptr<CompiledModel>> m_sub_compiled_models;
     std::shared_ptr<SubMemoryManager> m_sub_memory_manager = nullptr;
+    // nullptr if the KV cache has no memory budget (see cpu_kv_cache_memory_budget)
+    KVCacheMemory::Ptr m_kv_cache_memory = nullptr;
     bool m_has_sub_compiled_models = false;
     bool m_optimized_single_stream = false;
+    // ov::hint::ModelDistributionPolicy::PIPELINE_PARALLEL: the sub compiled models are the stages of the model,
+    // one per sub-stream, while the model itself is not compiled
+    PipelineStages m_pipeline_stages;
+    bool m_pipelined = false;
 };
 
 // This class provides safe access to the internal CompiledModel structures and helps to decouple SyncInferRequest and
@@ -110,16 +160,26 @@ class CompiledModelHolder {
 public:
     explicit CompiledModelHolder(std::shared_ptr<const CompiledModel> compiled_model)
         : m_compiled_model(std::move(compiled_model)) {
-        OPENVINO_ASSERT(!m_compiled_model->m_graphs.empty(),
+        OPENVINO_ASSERT(!m_compiled_model->graphs().empty(),
                         "No graph was found in the compiled model: ",
                         m_compiled_model->name());
-        m_graph = &(m_compiled_model->get_graph()._graph);
+        // the request keeps the tier it was created with, as it refers to the nodes of its graphs. The quick tier
+        // request is counted before the tier is chosen, so the swap cannot release the graphs in between
+        ++(m_compiled_model->m_quick_tier_requests);
+        m_optimized = m_compiled_model->optimized_tier_ready();
+        if (m_optimized) {
+            m_compiled_model->release_quick_tier_request();
+        }
+        m_graph = &(m_compiled_model->get_graph(m_optimized)._graph);
         m_id = (m_compiled_model->m_numRequests)++;
     }
 
     ~CompiledModelHolder() {
         if (m_compiled_model) {
             --(m_compiled_model->m_numRequests);
+            if (!m_optimized) {
+                m_compiled_model->release_quick_tier_request();
+            }
         }
     }
 
@@ -134,7 +194,7 @@ public:
     }
 
     CompiledModel::GraphGuard::Lock lock() {
-        auto lock = m_compiled_model->get_graph();
+        auto lock = m_compiled_model->get_graph(m_optimized);
         m_graph = &(lock._graph);
         OPENVINO_ASSERT(m_graph, "Graph ptr null check failed");
         return lock;
@@ -156,6 +216,7 @@ private:
     std::shared_ptr<const CompiledModel> m_compiled_model;
     const Graph* m_graph;
     int m_id;
+    bool m_optimized = false;
 };
 
 }  // namespace ov::intel_cpu
@@ -154,16 +154,24 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
                                val.as<std::string>(),
                                "for property key ",
                                ov::hint::model_distribution_policy.name(),
-                               ". CPU plugin only support {ov::hint::ModelDistributionPolicy::TENSOR_PARALLEL}");
+                               ". CPU plugin only support {ov::hint::ModelDistributionPolicy::TENSOR_PARALLEL} or "
+                               "{ov::hint::ModelDistributionPolicy::PIPELINE_PARALLEL}");
             };
 
             try {
-                for (const auto& row : val.as<std::set<ov::hint::ModelDistributionPolicy>>()) {
-                    if ((row != ov::hint::ModelDistributionPolicy::TENSOR_PARALLEL)) {
+                const auto policy = val.as<std::set<ov::hint::ModelDistributionPolicy>>();
+                for (const auto& row : policy) {
+                    if (none_of(row,
+                                ov::hint::ModelDistributionPolicy::TENSOR_PARALLEL,
+                                ov::hint::ModelDistributionPolicy::PIPELINE_PARALLEL)) {
                         error_info();
                     }
                 }
-                modelDistributionPolicy = val.as<std::set<ov::hint::ModelDistributionPolicy>>();
+                // both policies use the sub-streams, so they can not be combined
+                if (policy.size() > 1) {
+                    error_info();
+                }
+                modelDistributionPolicy = policy;
             } catch (ov::Exception&) {
                 error_info();
             }
@@ -211,6 +219,16 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
                                ov::enable_profiling.name(),
                                ". Expected only true/false");
             }
+        } else if (ov::intel_cpu::cpu_hw_perf_counters.name() == key) {
+            try {
+                collectHwPerfCounters = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_hw_perf_counters.name(),
+                               ". Expected only true/false");
+            }
         } else if (key == ov::internal::exclusive_async_requests.name()) {
             try {
                 exclusiveAsyncRequests = val.as<bool>();
@@ -274,6 +292,88 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
             // as zero that means disabling the cache
             rtCacheCapacity = std::max(val_i, 0);
             snippetsCacheCapacity = std::max(val_i, 0);
+        } else if (ov::intel_cpu::cpu_dynamic_shape_plans_capacity.name() == key) {
+            int val_i = -1;
+            try {
+                ov::Any value = val.as<std::string>();
+                val_i = value.as<int>();
+            } catch (const ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_dynamic_shape_plans_capacity.name(),
+                               ". Expected only integer numbers");
+            }
+            // any negative value disables the plans as zero does
+            shapePlansCapacity = std::max(val_i, 0);
+        } else if (ov::intel_cpu::cpu_runtime_cache_shared.name() == key) {
+            try {
+                rtCacheShared = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_runtime_cache_shared.name(),
+                               ". Expected only true/false");
+            }
+        } else if (ov::intel_cpu::cpu_shared_activations_group.name() == key) {
+            try {
+                sharedActivationsGroup = val.as<std::string>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value for property key ",
+                               ov::intel_cpu::cpu_shared_activations_group.name(),
+                               ". Expected only string values");
+            }
+        } else if (ov::intel_cpu::cpu_tiered_compilation.name() == key) {
+            try {
+                tieredCompilation = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_tiered_compilation.name(),
+                               ". Expected only true/false");
+            }
+        } else if (ov::intel_cpu::cpu_cache_packed_weights.name() == key) {
+            try {
+                cachePackedWeights = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_cache_packed_weights.name(),
+                               ". Expected only true/false");
+            }
+        } else if (ov::intel_cpu::cpu_work_stealing.name() == key) {
+            try {
+                workStealing = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_work_stealing.name(),
+                               ". Expected only true/false");
+            }
+        } else if (ov::intel_cpu::cpu_parallel_branches.name() == key) {
+            try {
+                parallelBranches = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_parallel_branches.name(),
+                               ". Expected only true/false");
+            }
+        } else if (ov::intel_cpu::cpu_kv_cache_memory_budget.name() == key) {
+            try {
+                kvCacheMemoryBudget = val.as<uint64_t>();
+            } catch (const ov::Exception&) {
+                OPENVINO_THROW("Wrong value for property key ",
+                               ov::intel_cpu::cpu_kv_cache_memory_budget.name(),
+                               ". Expected only unsigned integer numbers");
+            }
+        } else if (ov::intel_cpu::cpu_kv_cache_spill_dir.name() == key) {
+            kvCacheSpillDir = val.as<std::string>();
         } else if (ov::intel_cpu::denormals_optimization.name() == key) {
             try {
                 denormalsOptMode = val.as<bool>() ? DenormalsOptMode::DO_On : DenormalsOptMode::DO_Off;
@@ -21,6 +21,8 @@
 #include "utils/debug_caps_config.h"
 
 namespace ov::intel_cpu {
+struct PackedWeightsBlob;
+
 struct Config {
     Config();
 
@@ -50,6 +52,7 @@ struct Config {
     enum class ModelType : uint8_t { CNN, LLM, Unknown };
 
     bool collectPerfCounters = false;
+    bool collectHwPerfCounters = false;
     bool exclusiveAsyncRequests = false;
     SnippetsMode snippetsMode = SnippetsMode::Enable;
     std::string dumpToDot;
@@ -72,6 +75,17 @@ struct Config {
     size_t rtCacheCapacity = 5000UL;
 #endif
     size_t snippetsCacheCapacity = 5000UL;
+    size_t shapePlansCapacity = 0UL;
+    bool rtCacheShared = false;
+    std::string sharedActivationsGroup;
+    bool tieredCompilation = false;
+    // set for the quick tier of the tiered compilation only, not a property
+    bool quickTier = false;
+    bool cachePackedWeights = false;
+    bool workStealing = false;
+    bool parallelBranches = false;
+    uint64_t kvCacheMemoryBudget = 0;
+    std::string kvCacheSpillDir;
 #if defined(OPENVINO_ARCH_X86_64)
     ov::element::Type kvCachePrecision = ov::element::u8;
     ov::element::Type keyCachePrecision = ov::element::u8;
@@ -137,6 +151,8 @@ struct Config {
     ModelType modelType = ModelType::Unknown;
     std::function<std::string(const std::string&)> cacheEncrypt;
     std::function<std::string(const std::string&)> cacheDecrypt;
+    // weights in the kernels layout restored from the model cache blob
+    std::shared_ptr<const PackedWeightsBlob> packedWeights;
 
 #ifdef CPU_DEBUG_CAPS
     DebugCapsConfig debugCaps;
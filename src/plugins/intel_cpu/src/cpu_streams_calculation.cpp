@@ -765,6 +765,11 @@ std::vector<std::vector<int>> generate_stream_info(const int streams,
     }
     OPENVINO_ASSERT(!proc_type_table.empty() && proc_type_table[0][ALL_PROC] != 0,
                     "proc_type_table is empty. No valid CPU resources available!");
+    // the pipeline stages use the same layout as the tensor parallel sub-streams: one sub-stream per socket
+    auto distribution_policy = config.modelDistributionPolicy;
+    if (distribution_policy.erase(ov::hint::ModelDistributionPolicy::PIPELINE_PARALLEL) > 0) {
+        distribution_policy.insert(ov::hint::ModelDistributionPolicy::TENSOR_PARALLEL);
+    }
     auto streams_info_table = get_streams_info_table(config.streams,
                                                      config.streamsChanged,
                                                      config.threads,
@@ -772,11 +777,10 @@ std::vector<std::vector<int>> generate_stream_info(const int streams,
                                                      model_prefer_threads,
                                                      config.enableTensorParallel,
                                                      ov::util::to_string(config.hintPerfMode),
-                                                     config.modelDistributionPolicy,
+                                                     distribution_policy,
                                                      proc_type_table);
     OPENVINO_ASSERT(!streams_info_table.empty(), "streams_info_table is empty!");
-    if (config.modelDistributionPolicy.find(ov::hint::ModelDistributionPolicy::TENSOR_PARALLEL) !=
-        config.modelDistributionPolicy.end()) {
+    if (distribution_policy.find(ov::hint::ModelDistributionPolicy::TENSOR_PARALLEL) != distribution_policy.end()) {
         config.streamsRankTable =
             get_streams_rank_table(streams_info_table, config.streamsRankLevel, config.numSubStreams);
     }
@@ -795,7 +799,8 @@ std::vector<std::vector<int>> generate_stream_info(const int streams,
                                                            true,
                                                            std::move(streams_info_table),
                                                            {},
-                                                           false};
+                                                           false,
+                                                           config.workStealing};
     return proc_type_table;
 }
 
@@ -251,6 +251,7 @@ static const TypeToNameMap& get_type_to_name_tbl() {
         {"Interaction", Type::Interaction},
         {"Unique", Type::Unique},
         {"Ngram", Type::Ngram},
+        {"FusedPreprocess", Type::FusedPreprocess},
         {"ScaledDotProductAttention", Type::ScaledDotProductAttention},
         {"ScaledDotProductAttentionWithKVCache", Type::ScaledDotProductAttention},
         {"SDPAWithTransposeReshape", Type::ScaledDotProductAttention},
@@ -398,6 +399,7 @@ std::string NameFromType(const Type type) {
         CASE(SearchSorted);
         CASE(SegmentMax);
         CASE(LoRA);
+        CASE(FusedPreprocess);
         CASE(Unknown);
     }
 #undef CASE
@@ -0,0 +1,52 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "cpu_types.h"
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Output shapes of the dynamic nodes of a graph resolved for one signature of the graph input shapes.
+ * The first inference with the signature records the plan, the following ones replay the shapes instead of running
+ * the shape inference of the nodes. The plan is a shape inference memo only: the replayed shapes still redefine the
+ * memory of the nodes and prepareParams() still runs, the executors are looked up in the runtime parameters cache.
+ * The plans are used only if the shapes of the graph depend on the input shapes alone (no synchronization points).
+ * The nodes whose shape inference reads the input values are inferred on every replay anyway, if their shapes
+ * differ from the recorded ones the rest of the plan is recorded again.
+ */
+struct DynamicShapePlan {
+    using Ptr = std::shared_ptr<DynamicShapePlan>;
+
+    struct Signature {
+        std::vector<VectorDims> inputDims;
+
+        [[nodiscard]] size_t hash() const;
+        bool operator==(const Signature& rhs) const {
+            return inputDims == rhs.inputDims;
+        }
+    };
+
+    struct Statistics {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t evictions = 0;
+        uint64_t records = 0;
+    };
+
+    explicit DynamicShapePlan(size_t nodesCount) : outputDims(nodesCount) {}
+
+    // indexed as the executable nodes of the graph, empty if the shapes of the node were not inferred while recording
+    std::vector<std::vector<VectorDims>> outputDims;
+    // set once the recording inference has completed successfully
+    bool recorded = false;
+};
+
+}  // namespace ov::intel_cpu
@@ -88,6 +88,7 @@
 #include "snippets/op/subgraph.hpp"
 #include "snippets/op/vector_buffer.hpp"
 #include "transformations/cpu_opset/common/op/causal_mask_preprocess.hpp"
+#include "transformations/cpu_opset/common/op/fused_preprocess.hpp"
 #include "transformations/cpu_opset/common/op/leaky_relu.hpp"
 #include "transformations/cpu_opset/common/op/ngram.hpp"
 #include "transformations/cpu_opset/common/op/power_static.hpp"
@@ -173,6 +174,7 @@ OPENVINO_CREATE_EXTENSIONS(std::vector<ov::Extension::Ptr>({
     std::make_shared<ov::OpExtension<ov::intel_cpu::SwishNode>>(),
     std::make_shared<ov::OpExtension<ov::intel_cpu::SDPAWithTransposeReshape>>(),
     std::make_shared<ov::OpExtension<ov::intel_cpu::NgramNode>>(),
+    std::make_shared<ov::OpExtension<ov::intel_cpu::FusedPreprocessNode>>(),
     std::make_shared<ov::OpExtension<ov::intel_cpu::ReadValueWithSubgraph>>(),
     std::make_shared<ov::OpExtension<ov::op::internal::GatherCompressed>>(),
     std::make_shared<ov::OpExtension<ov::op::internal::NonMaxSuppressionIEInternal>>(),
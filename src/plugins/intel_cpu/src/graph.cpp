@@ -33,6 +33,8 @@
 #include <vector>
 
 #include "allocation_context.hpp"
+#include "cache/lru_cache.h"
+#include "common/primitive_hashing_utils.hpp"
 #include "cpu_memory.h"
 #include "cpu_types.h"
 #include "edge.h"
@@ -78,6 +80,7 @@
 
 #if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
 #    include <tbb/task.h>
+#    include <tbb/task_group.h>
 #endif
 
 #if defined(__x86_64__) && defined(__linux__)
@@ -550,6 +553,22 @@ void Graph::CreatePrimitivesAndExecConstants() const {
         return std::make_tuple(hasExternalInvalidEdges, hasLocalAllocatedEdges, outputs);
     };
 
+    if (const auto& packedWeights = m_context->getPackedWeights()) {
+        for (const auto& node : graphNodes) {
+            if (!node->isConstant()) {
+                continue;
+            }
+            for (size_t i = 0; i < node->getChildEdges().size(); ++i) {
+                const auto edge = node->getChildEdgeAt(i);
+                const auto memory = edge->getMemoryPtr();
+                if (memory && memory->getDesc().isDefined()) {
+                    packedWeights->registerSource(memory->getData(),
+                                                  node->getName() + ":" + std::to_string(edge->getInputNum()));
+                }
+            }
+        }
+    }
+
     for (const auto& node : graphNodes) {
         {
             OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, node->profiling.createPrimitive);
@@ -908,6 +927,14 @@ std::vector<size_t> Graph::CreateExecutionGraph() {
         status = Status::ReadyStatic;
     }
 
+    // the synchronization points are exactly the nodes whose output shapes depend on anything but the input shapes
+    m_shapePlans.reset();
+    m_shapePlansStats = {};
+    if (hasDynNodes && syncNodesInds.empty() && getConfig().shapePlansCapacity > 0) {
+        m_shapePlans = std::make_unique<LruCache<DynamicShapePlan::Signature, DynamicShapePlan::Ptr>>(
+            getConfig().shapePlansCapacity);
+    }
+
     return syncNodesInds;
 }
 
@@ -1356,18 +1383,53 @@ void Graph::InferStatic(SyncInferRequest* request, int numaId) {
     }
 }
 
+size_t DynamicShapePlan::Signature::hash() const {
+    size_t seed = 0;
+    for (const auto& dims : inputDims) {
+        seed = dnnl::impl::primitive_hashing::get_vector_hash(seed, dims);
+    }
+    return seed;
+}
+
 namespace {
 
+// records the inferred shapes into the plan being recorded or replays the shapes of the recorded one
+void updateNodeShapes(const NodePtr& node, DynamicShapePlan* shapePlan, size_t nodeIndx) {
+    if (!shapePlan) {
+        node->updateShapes();
+        return;
+    }
+    auto& resolvedShapes = shapePlan->outputDims[nodeIndx];
+    if (!shapePlan->recorded) {
+        resolvedShapes.clear();
+        node->updateShapes(&resolvedShapes);
+    } else if (node->shapeInferDependsOnValues()) {
+        // the input values are not a part of the signature, so the shapes are always inferred. If they differ from
+        // the recorded ones, the rest of the plan is recorded again
+        std::vector<VectorDims> inferredShapes;
+        node->updateShapes(&inferredShapes);
+        if (!inferredShapes.empty() && inferredShapes != resolvedShapes) {
+            resolvedShapes = std::move(inferredShapes);
+            shapePlan->recorded = false;
+        }
+    } else if (resolvedShapes.empty()) {
+        node->updateShapes();
+    } else {
+        node->replayShapes(resolvedShapes);
+    }
+}
+
 class UpdateNodesSeq {
 public:
-    explicit UpdateNodesSeq(std::vector<NodePtr>& executableGraphNodes)
-        : m_executableGraphNodes(executableGraphNodes) {}
+    explicit UpdateNodesSeq(std::vector<NodePtr>& executableGraphNodes, DynamicShapePlan* shapePlan = nullptr)
+        : m_executableGraphNodes(executableGraphNodes),
+          m_shapePlan(shapePlan) {}
 
     void operator()(size_t stopIndx) {
         for (; prepareCounter < stopIndx; ++prepareCounter) {
             const auto& node = m_executableGraphNodes[prepareCounter];
             if (node->isDynamicNode()) {
-                node->updateShapes();
+                updateNodeShapes(node, m_shapePlan, prepareCounter);
                 node->updateDynamicParams();
             }
         }
@@ -1376,6 +1438,7 @@ public:
 private:
     size_t prepareCounter = 0;
     std::vector<NodePtr>& m_executableGraphNodes;
+    DynamicShapePlan* m_shapePlan;
 };
 
 #if (OV_THREAD == OV_THREAD_SEQ)
@@ -1386,14 +1449,15 @@ using UpdateNodes = UpdateNodesSeq;
 
 class UpdateNodesBase {
 public:
-    explicit UpdateNodesBase(std::vector<NodePtr>& executableGraphNodes)
-        : m_executableGraphNodes(executableGraphNodes) {}
+    explicit UpdateNodesBase(std::vector<NodePtr>& executableGraphNodes, DynamicShapePlan* shapePlan = nullptr)
+        : m_executableGraphNodes(executableGraphNodes),
+          m_shapePlan(shapePlan) {}
     void updateShapes(size_t node_indx, size_t stop_indx) {
         try {
             for (size_t i = node_indx; i < stop_indx; i++) {
                 const auto& node = m_executableGraphNodes[i];
                 if (node->isDynamicNode()) {
-                    node->updateShapes();
+                    updateNodeShapes(node, m_shapePlan, i);
                 }
                 m_prepareCounter.store(i, std::memory_order_release);
             }
@@ -1426,6 +1490,7 @@ protected:
     std::atomic<size_t> m_prepareCounter{0};
     std::atomic<bool> m_completion{false};
     std::vector<NodePtr>& m_executableGraphNodes;
+    DynamicShapePlan* m_shapePlan;
 };
 
 // NOLINTBEGIN(misc-include-cleaner) tbb has multiple implicit includes, which are not supposed to be included directly
@@ -1590,26 +1655,36 @@ public:
 
 /* group all the profiling macros into a single one
  * to avoid cluttering a core logic */
-#define VERBOSE_PERF_DUMP_ITT_DEBUG_LOG(ittScope, node, config) \
-    VERBOSE(node, (config).debugCaps.verbose);                  \
-    PERF(node, (config).collectPerfCounters);                   \
-    DUMP(node, (config).debugCaps, infer_count);                \
-    OV_ITT_SCOPED_TASK(ittScope, (node)->profiling.execute);    \
+#define VERBOSE_PERF_DUMP_ITT_DEBUG_LOG(ittScope, node, config, hwCounters) \
+    VERBOSE(node, (config).debugCaps.verbose);                              \
+    PERF_HW(node, (config).collectPerfCounters, hwCounters);                \
+    DUMP(node, (config).debugCaps, infer_count);                            \
+    OV_ITT_SCOPED_TASK(ittScope, (node)->profiling.execute);                \
     DEBUG_LOG(*(node));
 
-inline void Graph::ExecuteNode(const NodePtr& node, SyncInferRequest* request, int numaId) const {
+inline void Graph::ExecuteNode(const NodePtr& node,
+                               const dnnl::stream& stream,
+                               SyncInferRequest* request,
+                               int numaId) const {
     if (request) {
         request->throw_if_canceled();
     }
 
-    node->execute(m_stream, numaId);
+    node->execute(stream, numaId);
 }
 
 inline void Graph::ExecuteNodeWithCatch(const NodePtr& node, SyncInferRequest* request, int numaId) const {
-    VERBOSE_PERF_DUMP_ITT_DEBUG_LOG(itt::domains::intel_cpu, node, getConfig());
+    ExecuteNodeWithCatch(node, m_stream, request, numaId);
+}
+
+inline void Graph::ExecuteNodeWithCatch(const NodePtr& node,
+                                        const dnnl::stream& stream,
+                                        SyncInferRequest* request,
+                                        int numaId) const {
+    VERBOSE_PERF_DUMP_ITT_DEBUG_LOG(itt::domains::intel_cpu, node, getConfig(), m_context->getHwPerfCounters().get());
 
     try {
-        ExecuteNode(node, request, numaId);
+        ExecuteNode(node, stream, request, numaId);
     } catch (const ov::Cancelled&) {
         throw;
     } catch (const std::exception& exp) {
@@ -1647,16 +1722,28 @@ void Graph::Infer(SyncInferRequest* request) {
     const int numaId = GetNumaNodeId(m_context);
 
     m_context->allocateMemory();
+    if (const auto& hwPerfCounters = m_context->getHwPerfCounters()) {
+        // the worker threads are created on demand
+        hwPerfCounters->attachNewThreads();
+    }
 
+    const auto shapePlan = IsDynamic() ? GetShapePlan() : nullptr;
     switch (status) {
     case Status::ReadyDynamic:
-        InferDynamic(request, numaId, UpdateNodes(m_executableGraphNodes));
+        InferDynamic(request, numaId, UpdateNodes(m_executableGraphNodes, shapePlan.get()));
         break;
     case Status::ReadyDynamicSeq:
-        InferDynamic(request, numaId, UpdateNodesSeq(m_executableGraphNodes));
+        InferDynamic(request, numaId, UpdateNodesSeq(m_executableGraphNodes, shapePlan.get()));
         break;
     case Status::ReadyStatic:
-        InferStatic(request, numaId);
+        if (getConfig().parallelBranches && !m_parallelPlanCreated) {
+            CreateParallelPlan();
+        }
+        if (m_parallelPlan) {
+            InferStaticParallel(request, numaId);
+        } else {
+            InferStatic(request, numaId);
+        }
         break;
     default:
         OPENVINO_ASSERT(IsReady(),
@@ -1664,11 +1751,219 @@ void Graph::Infer(SyncInferRequest* request) {
                         static_cast<int>(status));
     }
 
+    if (shapePlan) {
+        shapePlan->recorded = true;
+    }
+
     if (infer_count != -1) {
         infer_count++;
     }
 }
 
+DynamicShapePlan::Ptr Graph::GetShapePlan() {
+    if (!m_shapePlans) {
+        return nullptr;
+    }
+
+    DynamicShapePlan::Signature signature;
+    signature.inputDims.reserve(inputNodes.size());
+    for (const auto& node : inputNodes) {
+        if (node && !node->getChildEdges().empty()) {
+            signature.inputDims.push_back(node->getChildEdgeAt(0)->getMemory().getStaticDims());
+        } else {
+            signature.inputDims.emplace_back();
+        }
+    }
+
+    // a plan left incomplete by a failed inference is recorded again
+    if (auto shapePlan = m_shapePlans->get(signature); shapePlan && shapePlan->recorded) {
+        m_shapePlansStats.hits++;
+        return shapePlan;
+    }
+    m_shapePlansStats.misses++;
+    auto shapePlan = std::make_shared<DynamicShapePlan>(m_executableGraphNodes.size());
+    m_shapePlansStats.evictions += m_shapePlans->put(signature, shapePlan);
+    return shapePlan;
+}
+
+DynamicShapePlan::Statistics Graph::getShapePlansStatistics() const {
+    auto stats = m_shapePlansStats;
+    stats.records = m_shapePlans ? m_shapePlans->size() : 0;
+    return stats;
+}
+
+void Graph::CreateParallelPlan() {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::CreateParallelPlan");
+    m_parallelPlanCreated = true;
+
+#if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
+    const size_t numNodes = m_executableGraphNodes.size();
+    std::vector<std::vector<size_t>> predecessors(numNodes);
+
+    auto addDependency = [&predecessors](size_t from, size_t to) {
+        auto& nodePredecessors = predecessors[to];
+        if (from != to && std::find(nodePredecessors.begin(), nodePredecessors.end(), from) == nodePredecessors.end()) {
+            nodePredecessors.push_back(from);
+        }
+    };
+
+    // The edges alone do not define a safe order: AllocateWithReuse places the edges with non-overlapping lifetimes
+    // (in terms of the sequential execution order) into the same memory, and the in-place edges share the memory
+    // of their neighbours. So the dependencies are built from the memory ranges the nodes actually read and write:
+    // read after write, write after read and write after write. This covers the data edges as well.
+    struct MemoryAccess {
+        const uint8_t* begin;
+        const uint8_t* end;
+        size_t node;
+        bool write;
+    };
+    std::vector<MemoryAccess> accesses;
+
+    auto registerAccess = [&](const EdgePtr& edge, size_t nodeIdx, bool write) {
+        const auto memory = edge ? edge->getMemoryPtr() : nullptr;
+        if (!memory || !memory->getData() || memory->getSize() == 0) {
+            return;
+        }
+        const auto* begin = static_cast<const uint8_t*>(memory->getData());
+        const auto* end = begin + memory->getSize();
+        for (const auto& access : accesses) {
+            if (access.begin < end && begin < access.end && (write || access.write)) {
+                addDependency(access.node, nodeIdx);
+            }
+        }
+        if (write) {
+            // the accesses covered by the write are ordered through it
+            accesses.erase(std::remove_if(accesses.begin(),
+                                          accesses.end(),
+                                          [&](const MemoryAccess& access) {
+                                              return access.begin >= begin && access.end <= end;
+                                          }),
+                           accesses.end());
+        }
+        accesses.push_back({begin, end, nodeIdx, write});
+    };
+
+    // the nodes which can not be executed concurrently split the graph into the sequentially executed parts
+    size_t barrier = numNodes;
+    std::vector<size_t> sinceBarrier;
+    for (size_t i = 0; i < numNodes; i++) {
+        const auto& node = m_executableGraphNodes[i];
+        if (!node->canBeExecutedConcurrently()) {
+            for (const auto j : sinceBarrier) {
+                addDependency(j, i);
+            }
+            if (sinceBarrier.empty() && barrier != numNodes) {
+                addDependency(barrier, i);
+            }
+            sinceBarrier.clear();
+            accesses.clear();
+            barrier = i;
+            continue;
+        }
+
+        if (barrier != numNodes) {
+            addDependency(barrier, i);
+        }
+        sinceBarrier.push_back(i);
+
+        for (const auto& edge : node->getParentEdges()) {
+            registerAccess(edge.lock(), i, false);
+        }
+        for (const auto& edge : node->getChildEdges()) {
+            registerAccess(edge.lock(), i, true);
+        }
+    }
+
+    // the parallel execution only pays off if there are nodes at the same depth of the dependency graph
+    std::vector<size_t> depth(numNodes, 0);
+    std::vector<size_t> nodesPerDepth(numNodes, 0);
+    bool hasIndependentBranches = false;
+    for (size_t i = 0; i < numNodes; i++) {
+        for (const auto predecessor : predecessors[i]) {
+            depth[i] = std::max(depth[i], depth[predecessor] + 1);
+        }
+        hasIndependentBranches = hasIndependentBranches || ++nodesPerDepth[depth[i]] > 1;
+    }
+
+    if (!hasIndependentBranches) {
+        DEBUG_LOG("Graph ", GetName(), " has no independent branches, the nodes are executed sequentially");
+        return;
+    }
+
+    auto plan = std::make_unique<ParallelPlan>();
+    plan->successors.resize(numNodes);
+    plan->numPredecessors.resize(numNodes);
+    for (size_t i = 0; i < numNodes; i++) {
+        plan->numPredecessors[i] = predecessors[i].size();
+        if (predecessors[i].empty()) {
+            plan->roots.push_back(i);
+        }
+        for (const auto predecessor : predecessors[i]) {
+            plan->successors[predecessor].push_back(i);
+        }
+    }
+    plan->pending = std::make_unique<std::atomic<size_t>[]>(numNodes);
+    const auto numThreads = static_cast<size_t>(std::max(1, parallel_get_max_threads()));
+    for (size_t i = 0; i < numThreads; i++) {
+        plan->streams.emplace_back(getEngine());
+    }
+
+    m_parallelPlan = std::move(plan);
+#endif
+}
+
+#if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
+void Graph::InferStaticParallel(SyncInferRequest* request, int numaId) {
+    auto& plan = *m_parallelPlan;
+    for (size_t i = 0; i < plan.numPredecessors.size(); i++) {
+        plan.pending[i].store(plan.numPredecessors[i], std::memory_order_relaxed);
+    }
+
+    // The ready nodes are spawned into the task arena of the stream, so the threads not busy with the kernel of
+    // one node pick up the other branches, while the kernels of the nodes split the rest of the threads.
+    tbb::task_group group;
+    std::function<void(size_t)> execute = [&](size_t nodeIdx) {
+        while (true) {
+            const auto threadIdx = static_cast<size_t>(std::max(0, parallel_get_thread_num()));
+            const auto& stream = plan.streams[threadIdx % plan.streams.size()];
+            ExecuteNodeWithCatch(m_executableGraphNodes[nodeIdx], stream, request, numaId);
+
+            // continue with one of the successors on the same thread and spawn the rest
+            size_t next = plan.numPredecessors.size();
+            for (const auto successor : plan.successors[nodeIdx]) {
+                if (plan.pending[successor].fetch_sub(1, std::memory_order_acq_rel) != 1) {
+                    continue;
+                }
+                if (next == plan.numPredecessors.size()) {
+                    next = successor;
+                } else {
+                    group.run([&execute, successor] {
+                        execute(successor);
+                    });
+                }
+            }
+            if (next == plan.numPredecessors.size()) {
+                return;
+            }
+            nodeIdx = next;
+        }
+    };
+
+    for (const auto root : plan.roots) {
+        group.run([&execute, root] {
+            execute(root);
+        });
+    }
+    // rethrows the first exception of the nodes, the rest of the nodes are cancelled
+    group.wait();
+    m_parallelInferences++;
+}
+#else
+void Graph::InferStaticParallel(SyncInferRequest* request, int numaId) {
+    InferStatic(request, numaId);
+}
+#endif
+
 void Graph::SortTopologically() {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::SortTopologically");
 
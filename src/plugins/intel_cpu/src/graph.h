@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -14,7 +15,9 @@
 #include <vector>
 
 #include "allocation_context.hpp"
+#include "cache/lru_cache.h"
 #include "config.h"
+#include "dynamic_shape_plan.h"
 #include "edge.h"
 #include "graph_context.h"
 #include "memory_desc/cpu_memory_desc.h"
@@ -157,6 +160,14 @@ public:
 
     void GetPerfData(std::vector<ov::ProfilingInfo>& perfMap) const;
 
+    // accumulated since the graph creation, empty if the dynamic shape plans are not used by the graph
+    DynamicShapePlan::Statistics getShapePlansStatistics() const;
+
+    // the number of inferences which executed the independent branches concurrently (see Config::parallelBranches)
+    uint64_t getParallelInferences() const {
+        return m_parallelInferences;
+    }
+
     void CreateEdge(const NodePtr& parent, const NodePtr& child, int parentPort = 0, int childPort = 0);
     void RemoveEdge(const EdgePtr& edge);
     void RemoveDroppedNodes();
@@ -295,6 +306,9 @@ protected:
         graphNodes.clear();
         graphEdges.clear();
         m_executableSyncNodesInds.clear();
+        m_parallelPlan.reset();
+        m_parallelPlanCreated = false;
+        m_shapePlans.reset();
     }
     Status status{Status::NotReady};
 
@@ -337,16 +351,28 @@ protected:
      */
     void ExecuteNodeWithCatch(const NodePtr& node, SyncInferRequest* request = nullptr, int numaId = -1) const;
 
+    void ExecuteNodeWithCatch(const NodePtr& node,
+                              const dnnl::stream& stream,
+                              SyncInferRequest* request,
+                              int numaId) const;
+
     /**
-     * Execute a given \p node within \p request using \p numaId
+     * Execute a given \p node on \p stream within \p request using \p numaId
      *
      * @params node     Node to execute
+     * @params stream   Stream to execute the node on, the nodes executed concurrently use different streams
      * @params request  Current inference request, which is checked for cancelation
      * @params numaId   Numa Id to be used for an execution
      */
-    void ExecuteNode(const NodePtr& node, SyncInferRequest* request = nullptr, int numaId = -1) const;
+    void ExecuteNode(const NodePtr& node,
+                     const dnnl::stream& stream,
+                     SyncInferRequest* request = nullptr,
+                     int numaId = -1) const;
 
     void InferStatic(SyncInferRequest* request, int numaId);
+    void InferStaticParallel(SyncInferRequest* request, int numaId);
+    void CreateParallelPlan();
+    DynamicShapePlan::Ptr GetShapePlan();
     template <typename UpdateStrategy>
     void InferDynamic(SyncInferRequest* request, int numaId, UpdateStrategy&& update);
 
@@ -373,6 +399,26 @@ private:
 
     GraphContext::CPtr m_context;
     dnnl::stream m_stream;
+
+    // dependencies between m_executableGraphNodes used to execute the independent branches concurrently
+    struct ParallelPlan {
+        std::vector<std::vector<size_t>> successors;
+        std::vector<size_t> numPredecessors;
+        std::vector<size_t> roots;
+        // the counters of not yet executed predecessors, reset on each inference
+        std::unique_ptr<std::atomic<size_t>[]> pending;
+        // one stream per thread of the arena
+        std::vector<dnnl::stream> streams;
+    };
+    // created on the first inference after the memory is allocated, empty if the graph has no independent branches
+    std::unique_ptr<ParallelPlan> m_parallelPlan;
+    bool m_parallelPlanCreated = false;
+    uint64_t m_parallelInferences = 0;
+
+    // the dynamic shape plans keyed by the input shapes signature (see Config::shapePlansCapacity),
+    // null if the plans are disabled or the shapes of the graph do not depend on the input shapes only
+    std::unique_ptr<LruCache<DynamicShapePlan::Signature, DynamicShapePlan::Ptr>> m_shapePlans;
+    DynamicShapePlan::Statistics m_shapePlansStats;
 };
 
 using GraphPtr = std::shared_ptr<Graph>;
@@ -11,32 +11,55 @@
 #include "cache/multi_cache.h"
 #include "config.h"
 #include "dnnl_scratch_pad.h"
+#include "kv_cache_memory.hpp"
 #include "memory_control.hpp"
 #include "nodes/memory.hpp"
 #include "openvino/runtime/system_conf.hpp"
 #include "openvino/runtime/threading/cpu_streams_executor.hpp"
 #include "openvino/runtime/threading/istreams_executor.hpp"
+#include "packed_weights.hpp"
 #include "sub_memory_manager.hpp"
 #include "weights_cache.hpp"
 
 namespace ov::intel_cpu {
 
+// the sub-streams of a tensor parallel model infer concurrently exchanging the data, so they can't be serialized
+static SharedWorkspace::Ptr getSharedWorkspace(const Config& config,
+                                               const ov::threading::IStreamsExecutor::Ptr& streamExecutor,
+                                               const std::shared_ptr<SubMemoryManager>& subMemoryManager) {
+    if (config.sharedActivationsGroup.empty() || subMemoryManager) {
+        return nullptr;
+    }
+    // the context is created on the stream, which is going to run the graph
+    return SharedWorkspace::get(config.sharedActivationsGroup, streamExecutor ? streamExecutor->get_stream_id() : 0);
+}
+
 GraphContext::GraphContext(Config config,
                            WeightsSharing::Ptr w_cache,
                            bool isGraphQuantized,
                            ov::threading::IStreamsExecutor::Ptr streamExecutor,
-                           std::shared_ptr<SubMemoryManager> sub_memory_manager)
+                           std::shared_ptr<SubMemoryManager> sub_memory_manager,
+                           KVCacheMemory::Ptr kv_cache_memory)
     : m_config(std::move(config)),
       m_weightsCache(std::move(w_cache)),
-      m_rtParamsCache(std::make_shared<MultiCache>(m_config.rtCacheCapacity)),
-      m_snippetsParamsCache(std::make_shared<MultiCache>(m_config.snippetsCacheCapacity)),
+      // the nodes executed concurrently must not share the executors, so these are not cached in the parallel mode
+      m_rtParamsCache(std::make_shared<MultiCache>(
+          m_config.rtCacheCapacity,
+          m_config.rtCacheShared ? MultiCache::getProcessShared(m_config.rtCacheCapacity) : nullptr,
+          !m_config.parallelBranches)),
+      m_snippetsParamsCache(
+          std::make_shared<MultiCache>(m_config.snippetsCacheCapacity, nullptr, !m_config.parallelBranches)),
       m_isGraphQuantizedFlag(isGraphQuantized),
       m_streamExecutor(std::move(streamExecutor)),
       m_subMemoryManager(std::move(sub_memory_manager)),
+      m_kvCacheMemory(std::move(kv_cache_memory)),
 
       m_memoryStatesRegister(std::make_shared<node::MemoryStatesRegister>()),
+      m_sharedWorkspace(getSharedWorkspace(m_config, m_streamExecutor, m_subMemoryManager)),
+      m_hwPerfCounters(m_config.collectPerfCounters && m_config.collectHwPerfCounters ? HwPerfCounters::get()
+                                                                                       : nullptr),
       m_auxiliaryNetworkMemoryControl(std::make_shared<NetworkMemoryControl>()),
-      m_memoryControl(m_auxiliaryNetworkMemoryControl->createMemoryControlUnit("main")) {
+      m_memoryControl(m_auxiliaryNetworkMemoryControl->createMemoryControlUnit("main", m_sharedWorkspace)) {
     if (m_streamExecutor) {
         m_cpuStreamExecutor = std::dynamic_pointer_cast<ov::threading::CPUStreamsExecutor>(m_streamExecutor);
         m_numaNodeId = m_cpuStreamExecutor ? std::max(0, m_cpuStreamExecutor->get_numa_node_id()) : 0;
@@ -45,6 +68,9 @@ GraphContext::GraphContext(Config config,
             m_numNumaNodes = nNumaNodes;
         }
     }
+    if (m_config.cachePackedWeights || m_config.packedWeights) {
+        m_packedWeights = std::make_shared<PackedWeights>(m_config.packedWeights, m_config.cachePackedWeights);
+    }
     // primitive/executors can be shared across sub-stream
     // but scratch pad cannot be shared.
     int numaNum = std::max(m_numaNodeId + 1, m_numNumaNodes);
@@ -11,10 +11,13 @@
 #include "cache/multi_cache.h"
 #include "config.h"
 #include "dnnl_scratch_pad.h"
+#include "kv_cache_memory.hpp"
 #include "memory_control.hpp"
 #include "openvino/runtime/threading/cpu_streams_executor.hpp"
 #include "openvino/runtime/threading/istreams_executor.hpp"
+#include "packed_weights.hpp"
 #include "sub_memory_manager.hpp"
+#include "utils/hw_perf_counters.h"
 #include "weights_cache.hpp"
 
 namespace ov::intel_cpu {
@@ -35,7 +38,8 @@ public:
                  WeightsSharing::Ptr w_cache,
                  bool isGraphQuantized,
                  ov::threading::IStreamsExecutor::Ptr streamExecutor = nullptr,
-                 std::shared_ptr<SubMemoryManager> sub_memory_manager = nullptr);
+                 std::shared_ptr<SubMemoryManager> sub_memory_manager = nullptr,
+                 KVCacheMemory::Ptr kv_cache_memory = nullptr);
 
     [[nodiscard]] const Config& getConfig() const {
         return m_config;
@@ -45,6 +49,11 @@ public:
         return m_weightsCache;
     }
 
+    // nullptr if the packed weights are neither recorded nor restored from the model cache blob
+    [[nodiscard]] PackedWeights::Ptr getPackedWeights() const {
+        return m_packedWeights;
+    }
+
     [[nodiscard]] MultiCachePtr getParamsCache() const {
         return m_rtParamsCache;
     }
@@ -53,6 +62,8 @@ public:
         return m_snippetsParamsCache;
     }
 
+    // the nodes executed concurrently (see Config::parallelBranches) use the private scratchpads instead, see
+    // Node::getScratchPad
     [[nodiscard]] DnnlScratchPadPtr getScratchPad() const {
         return m_rtScratchPads[m_numaNodeId];
     }
@@ -75,6 +86,11 @@ public:
         return m_subMemoryManager;
     }
 
+    // nullptr if the KV cache has no memory budget
+    [[nodiscard]] const KVCacheMemory::Ptr& getKVCacheMemory() const {
+        return m_kvCacheMemory;
+    }
+
     [[nodiscard]] int getNumNumaNodes() const {
         return m_numNumaNodes;
     }
@@ -87,6 +103,16 @@ public:
         return m_memoryControl;
     }
 
+    // not null only if the model belongs to a group of the shared activations (see cpu_shared_activations_group)
+    [[nodiscard]] const SharedWorkspace::Ptr& getSharedWorkspace() const {
+        return m_sharedWorkspace;
+    }
+
+    // not null only if the profiling counts the hardware events (see cpu_hw_perf_counters)
+    [[nodiscard]] const HwPerfCounters::Ptr& getHwPerfCounters() const {
+        return m_hwPerfCounters;
+    }
+
     [[nodiscard]] const std::shared_ptr<NetworkMemoryControl>& getAuxiliaryNetworkMemoryControl() const {
         return m_auxiliaryNetworkMemoryControl;
     }
@@ -108,6 +134,7 @@ private:
     Config m_config;
     // per NUMA node caches for sharing weights data
     WeightsSharing::Ptr m_weightsCache;
+    PackedWeights::Ptr m_packedWeights;
     // primitive cache
     MultiCachePtr m_rtParamsCache;
     MultiCachePtr m_snippetsParamsCache;
@@ -123,11 +150,16 @@ private:
     ov::threading::CPUStreamsExecutor::Ptr m_cpuStreamExecutor;
     // numa submemory manager
     std::shared_ptr<SubMemoryManager> m_subMemoryManager;
+    // the KV cache allocator shared by all the streams of the compiled model
+    KVCacheMemory::Ptr m_kvCacheMemory;
 
     int m_numNumaNodes = 1;
     int m_numaNodeId = 0;
 
     std::shared_ptr<node::MemoryStatesRegister> m_memoryStatesRegister;
+    // workspace of the static intermediate tensors shared with the other models of the same group
+    SharedWorkspace::Ptr m_sharedWorkspace;
+    HwPerfCounters::Ptr m_hwPerfCounters;
     // auxiliary object to allow creating additional memory control objects if the main one cannot be used
     // i.e. fallback graph for dynamic in-place
     std::shared_ptr<NetworkMemoryControl> m_auxiliaryNetworkMemoryControl;
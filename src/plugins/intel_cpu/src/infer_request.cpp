@@ -9,6 +9,7 @@
 #include <functional>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
 #include <string_view>
@@ -23,7 +24,9 @@
 #include "cpu_types.h"
 #include "dnnl_extension_utils.h"
 #include "edge.h"
+#include "graph_context.h"
 #include "itt.h"
+#include "memory_control.hpp"
 #include "memory_desc/cpu_blocked_memory_desc.h"
 #include "memory_desc/cpu_memory_desc.h"
 #include "memory_desc/cpu_memory_desc_utils.h"
@@ -135,6 +138,12 @@ void SyncInferRequest::infer() {
         graph.assignStates(m_memory_states);
     }
 
+    // the intermediate tensors of the models sharing the workspace overlap, so they infer one at a time
+    std::unique_lock<std::recursive_mutex> workspaceLock;
+    if (const auto& sharedWorkspace = graph.getGraphContext()->getSharedWorkspace()) {
+        workspaceLock = sharedWorkspace->lock();
+    }
+
     push_input_data(graph);
 
     graph.Infer(this);
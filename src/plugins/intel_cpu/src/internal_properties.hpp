@@ -20,6 +20,164 @@ namespace ov::intel_cpu {
  */
 static constexpr Property<int32_t, PropertyMutability::RW> cpu_runtime_cache_capacity{"CPU_RUNTIME_CACHE_CAPACITY"};
 
+/**
+ * @brief Defines whether the oneDNN primitives of the CPU runtime parameters cache are shared by all the streams and
+ * compiled models of the process. The node executors keep the state used during the execution, so they are still built
+ * and cached per stream. oneDNN caches the primitives by itself, so the sharing only saves the creation of the
+ * primitive descriptors on a miss in the per stream cache. The capacity (see cpu_runtime_cache_capacity) counts the
+ * records, not bytes. The compiled models with the same capacity share one thread safe cache, which lives as long as
+ * any compiled model using it exists.
+ */
+static constexpr Property<bool, PropertyMutability::RW> cpu_runtime_cache_shared{"CPU_RUNTIME_CACHE_SHARED"};
+
+/**
+ * @brief Returns the CPU runtime parameters cache statistics of the compiled model as a map with the "HITS", "MISSES",
+ * "EVICTIONS" and "RECORDS" keys. The statistics are accumulated over all the streams. If the cache is shared
+ * (see cpu_runtime_cache_shared) the statistics cover all the compiled models using it.
+ */
+static constexpr Property<ov::AnyMap, PropertyMutability::RO> cpu_runtime_cache_statistics{
+    "CPU_RUNTIME_CACHE_STATISTICS"};
+
+/**
+ * @brief Defines the name of the group of compiled models sharing the workspace of the static intermediate tensors.
+ * The models of the same group use one workspace per stream index sized to the largest of them instead of one
+ * workspace each, so the inferences of the models of the group running on the same stream index are serialized.
+ * Empty value (default) disables the sharing.
+ */
+static constexpr Property<std::string, PropertyMutability::RW> cpu_shared_activations_group{
+    "CPU_SHARED_ACTIVATIONS_GROUP"};
+
+/**
+ * @brief Returns the size in bytes of the largest workspace the compiled model shares with the other models of its
+ * group (see cpu_shared_activations_group), 0 if the model does not share its activations.
+ */
+static constexpr Property<uint64_t, PropertyMutability::RO> cpu_shared_activations_workspace_size{
+    "CPU_SHARED_ACTIVATIONS_WORKSPACE_SIZE"};
+
+/**
+ * @brief Defines how many input shapes signatures of a dynamic graph keep their resolved output shapes of the nodes per
+ * stream. A repeated signature skips only the shape inference of the graph: the memory is still redefined and the nodes
+ * still prepare their executors, which usually come from the runtime cache. 0 (default) disables the plans.
+ */
+static constexpr Property<int32_t, PropertyMutability::RW> cpu_dynamic_shape_plans_capacity{
+    "CPU_DYNAMIC_SHAPE_PLANS_CAPACITY"};
+
+/**
+ * @brief Returns the dynamic shape plans statistics of the compiled model as a map with the "HITS", "MISSES",
+ * "EVICTIONS" and "RECORDS" keys accumulated over all the streams (see cpu_dynamic_shape_plans_capacity).
+ * The plans are not used by the graphs whose shapes depend on the data or the states, all the keys are 0 then.
+ */
+static constexpr Property<ov::AnyMap, PropertyMutability::RO> cpu_dynamic_shape_plans_statistics{
+    "CPU_DYNAMIC_SHAPE_PLANS_STATISTICS"};
+
+/**
+ * @brief Enables the tiered compilation. The compiled model is created with the quick tier (no low precision
+ * transformations, no snippets tokenization, no common fusions and no symbolic optimizations) serving the requests,
+ * while the fully optimized tier is compiled in the background from the same model with the same streams. The infer requests created after the optimized tier is ready use it, the existing requests keep
+ * using the quick tier, which is released once they are all destroyed. The export of the model waits for the
+ * optimized tier.
+ */
+static constexpr Property<bool, PropertyMutability::RW> cpu_tiered_compilation{"CPU_TIERED_COMPILATION"};
+
+/**
+ * @brief Returns whether the new infer requests of the compiled model use the optimized tier (see
+ * cpu_tiered_compilation). Always true if the tiered compilation is disabled.
+ */
+static constexpr Property<bool, PropertyMutability::RO> cpu_optimized_tier_ready{"CPU_OPTIMIZED_TIER_READY"};
+
+/**
+ * @brief Returns whether the graphs and the weights of the quick tier are released (see cpu_tiered_compilation).
+ * Always false if the tiered compilation is disabled.
+ */
+static constexpr Property<bool, PropertyMutability::RO> cpu_quick_tier_released{"CPU_QUICK_TIER_RELEASED"};
+
+/**
+ * @brief Defines whether the profiling (see ov::enable_profiling) counts the hardware events around the execution of
+ * every node by Linux perf_event_open: the cycles, the instructions, the LLC misses and the cycles at the reduced
+ * AVX2/AVX-512/AMX frequency licenses if the core has such events. The values are reported by
+ * cpu_hw_perf_counters_statistics. The events of all the threads of the process are counted, so the values are
+ * accurate with one stream and no other inference running concurrently. The thread list of the process is scanned
+ * at the start of every inference, the counters of the new threads are opened only when the list has changed.
+ */
+static constexpr Property<bool, PropertyMutability::RW> cpu_hw_perf_counters{"CPU_HW_PERF_COUNTERS"};
+
+/**
+ * @brief Returns the hardware events counted by the profiling (see cpu_hw_perf_counters) per node name: the averages
+ * per execution of the events ("cycles", "instructions", ...) and the derived metrics ("ipc", "llc_mpki",
+ * "llc_miss_gbps") over all the streams. Empty if the events are not counted.
+ */
+static constexpr Property<ov::AnyMap, PropertyMutability::RO> cpu_hw_perf_counters_statistics{
+    "CPU_HW_PERF_COUNTERS_STATISTICS"};
+
+/**
+ * @brief Defines whether the exported model (the model cache blob) includes the weights already repacked into the
+ * layout of the selected kernels. The packed weights are page aligned inside the blob, so the model imported from
+ * an mmapped cache file uses them in place: no repacking on import and one physical copy shared by all the processes
+ * importing the same blob.
+ */
+static constexpr Property<bool, PropertyMutability::RW> cpu_cache_packed_weights{"CPU_CACHE_PACKED_WEIGHTS"};
+
+/**
+ * @brief Returns the statistics of the packed weights restored from the imported blob (see cpu_cache_packed_weights) as
+ * a map with the "IN_PLACE" (used without a copy), "COPIED" (not aligned for the kernels in the memory) and "REPACKED"
+ * (not found in the blob) keys accumulated over all the streams.
+ */
+static constexpr Property<ov::AnyMap, PropertyMutability::RO> cpu_packed_weights_statistics{
+    "CPU_PACKED_WEIGHTS_STATISTICS"};
+
+/**
+ * @brief Defines whether each stream of the compiled model has its own queue of the inference tasks. An idle stream
+ * steals the queued tasks of the busy streams bound to the same NUMA node, the tasks never migrate across the NUMA
+ * nodes.
+ */
+static constexpr Property<bool, PropertyMutability::RW> cpu_work_stealing{"CPU_WORK_STEALING"};
+
+/**
+ * @brief Defines whether the independent branches of a static graph are executed concurrently inside the threads of
+ * one stream. Targets the latency mode (few streams with many threads each), where a sequential execution of small
+ * nodes leaves most of the stream threads idle. The nodes get private scratchpads in this mode, so the memory footprint
+ * grows.
+ */
+static constexpr Property<bool, PropertyMutability::RW> cpu_parallel_branches{"CPU_PARALLEL_BRANCHES"};
+
+/**
+ * @brief Returns the number of inferences of the compiled model which executed the independent branches of the graph
+ * concurrently (see cpu_parallel_branches). Stays 0 if the graphs have no independent branches or the mode is not
+ * supported by the threading backend.
+ */
+static constexpr Property<uint64_t, PropertyMutability::RO> cpu_parallel_branches_inferences{
+    "CPU_PARALLEL_BRANCHES_INFERENCES"};
+
+/**
+ * @brief Returns the task scheduling statistics of the streams executor of the compiled model as a map with the
+ * "TASKS", "STEALS", "MISSED_DEADLINES" (see ov::hint::request_deadline) and "MAX_QUEUE_DEPTH" (one value per task
+ * queue) keys. A high number of steals or unbalanced queue depths suggest the number of streams (ov::num_streams) does
+ * not match the load.
+ */
+static constexpr Property<ov::AnyMap, PropertyMutability::RO> cpu_streams_executor_statistics{
+    "CPU_STREAMS_EXECUTOR_STATISTICS"};
+
+/**
+ * @brief Defines the budget in bytes for the resident KV cache of the stateful models (the states of the fused
+ * ScaledDotProductAttention), shared by all the streams and infer requests of the compiled model. The cache buffers
+ * allocated above the budget are backed by a temporary file (see cpu_kv_cache_spill_dir), so the operating system
+ * pages the old tokens out to the disk instead of running out of RAM. 0 (default) stands for no budget.
+ */
+static constexpr Property<uint64_t, PropertyMutability::RW> cpu_kv_cache_memory_budget{"CPU_KV_CACHE_MEMORY_BUDGET"};
+
+/**
+ * @brief Defines the directory of the temporary files backing the KV cache above cpu_kv_cache_memory_budget.
+ * The system temporary directory is used by default.
+ */
+static constexpr Property<std::string, PropertyMutability::RW> cpu_kv_cache_spill_dir{"CPU_KV_CACHE_SPILL_DIR"};
+
+/**
+ * @brief Returns the KV cache memory statistics of the compiled model as a map with the "RESIDENT_BYTES",
+ * "SPILLED_BYTES", "SPILLS" (the buffers allocated in the files) and "REFETCHES" (the prefetches ahead of the attention
+ * which found the pages of a spilled buffer written back to the file, so the pages are read from the disk again) keys.
+ */
+static constexpr Property<ov::AnyMap, PropertyMutability::RO> cpu_kv_cache_statistics{"CPU_KV_CACHE_STATISTICS"};
+
 /**
  * @brief Enum to define possible snippets mode hints.
  */
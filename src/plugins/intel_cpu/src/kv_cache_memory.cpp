@@ -0,0 +1,186 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "kv_cache_memory.hpp"
+
+#include <algorithm>
+#include <common/utils.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <oneapi/dnnl/dnnl_common.hpp>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "cpu_memory.h"
+#include "memory_desc/cpu_memory_desc.h"
+#include "openvino/core/except.hpp"
+#include "utils/debug_capabilities.h"
+
+#if defined(__linux__)
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <unistd.h>
+#endif
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief The fixed size buffer of the KV cache, either in RAM or mapped from an unlinked temporary file
+ */
+class KVCacheMemory::Block : public IMemoryBlock {
+public:
+    Block(std::shared_ptr<State> state, size_t size) : m_state(std::move(state)), m_size(size) {
+        bool overBudget = false;
+        {
+            // the budget is soft: the concurrent allocations may exceed it by the size of one buffer
+            std::lock_guard<std::mutex> lock(m_state->mutex);
+            overBudget = m_state->budget > 0 && m_state->statistics.residentBytes + size > m_state->budget;
+        }
+        if (overBudget) {
+            m_data = mapFile(size);
+            m_spilled = m_data != nullptr;
+        }
+        if (!m_data) {
+            constexpr int cacheLineSize = 64;
+            m_data = dnnl::impl::malloc(size, cacheLineSize);
+            OPENVINO_ASSERT(m_data, "Failed to allocate ", size, " bytes of memory");
+        }
+
+        std::lock_guard<std::mutex> lock(m_state->mutex);
+        auto& stats = m_state->statistics;
+        if (m_spilled) {
+            stats.spilledBytes += size;
+            stats.spills++;
+            m_state->spilled.emplace(static_cast<const uint8_t*>(m_data), size);
+        } else {
+            stats.residentBytes += size;
+        }
+    }
+
+    ~Block() override {
+        {
+            std::lock_guard<std::mutex> lock(m_state->mutex);
+            auto& stats = m_state->statistics;
+            if (m_spilled) {
+                stats.spilledBytes -= m_size;
+                m_state->spilled.erase(static_cast<const uint8_t*>(m_data));
+            } else {
+                stats.residentBytes -= m_size;
+            }
+        }
+#if defined(__linux__)
+        if (m_spilled) {
+            munmap(m_data, m_size);
+            return;
+        }
+#endif
+        dnnl::impl::free(m_data);
+    }
+
+    [[nodiscard]] void* getRawPtr() const noexcept override {
+        return m_data;
+    }
+
+    void setExtBuff([[maybe_unused]] void* ptr, [[maybe_unused]] size_t size) override {
+        OPENVINO_THROW("KV cache memory block doesn't accept external buffers");
+    }
+
+    bool resize(size_t size) override {
+        OPENVINO_ASSERT(size <= m_size, "KV cache memory block can't grow from ", m_size, " to ", size, " bytes");
+        return false;
+    }
+
+    [[nodiscard]] bool hasExtBuffer() const noexcept override {
+        return false;
+    }
+
+private:
+    void* mapFile(size_t size) const {
+#if defined(__linux__)
+        auto dir = m_state->spillDir.empty() ? std::filesystem::temp_directory_path().string() : m_state->spillDir;
+        std::string path = dir + "/ov_cpu_kv_cache_XXXXXX";
+        int fd = mkstemp(path.data());
+        if (fd < 0) {
+            DEBUG_LOG("Failed to create the KV cache spill file in ", dir);
+            return nullptr;
+        }
+        // the file is removed on the last unmap
+        unlink(path.c_str());
+        void* ptr = nullptr;
+        if (ftruncate(fd, static_cast<off_t>(size)) == 0) {
+            ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        }
+        close(fd);
+        if (ptr == MAP_FAILED || ptr == nullptr) {
+            DEBUG_LOG("Failed to map ", size, " bytes of the KV cache spill file in ", dir);
+            return nullptr;
+        }
+        return ptr;
+#else
+        return nullptr;
+#endif
+    }
+
+    std::shared_ptr<State> m_state;
+    size_t m_size;
+    bool m_spilled = false;
+    void* m_data = nullptr;
+};
+
+KVCacheMemory::KVCacheMemory(uint64_t budget, std::string spillDir) : m_state(std::make_shared<State>()) {
+    m_state->budget = budget;
+    m_state->spillDir = std::move(spillDir);
+}
+
+MemoryPtr KVCacheMemory::allocate(const MemoryDescPtr& desc, const dnnl::engine& eng) const {
+    OPENVINO_ASSERT(desc->hasDefinedMaxSize(), "KV cache memory requires the descriptor with defined max size");
+    auto block = std::make_shared<DnnlMemoryBlock>(std::make_unique<Block>(m_state, desc->getMaxMemSize()));
+    return std::make_shared<Memory>(eng, desc, block);
+}
+
+void KVCacheMemory::prefetch(const MemoryCPtr& mem) const {
+    if (!mem) {
+        return;
+    }
+    const auto* data = static_cast<const uint8_t*>(mem->getData());
+    {
+        std::lock_guard<std::mutex> lock(m_state->mutex);
+        auto it = m_state->spilled.upper_bound(data);
+        if (it == m_state->spilled.begin() || data >= std::prev(it)->first + std::prev(it)->second) {
+            return;
+        }
+    }
+#if defined(__linux__)
+    const auto pageSize = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+    auto begin = reinterpret_cast<uintptr_t>(data) & ~(pageSize - 1);
+    auto end = reinterpret_cast<uintptr_t>(data) + mem->getSize();
+    auto* range = reinterpret_cast<void*>(begin);  // NOLINT(performance-no-int-to-ptr)
+    // only the pages the operating system wrote back to the file are read again, the rest is still in the page cache
+    std::vector<unsigned char> residency((end - begin + pageSize - 1) / pageSize);
+    if (mincore(range, end - begin, residency.data()) == 0 &&
+        std::all_of(residency.begin(), residency.end(), [](unsigned char page) {
+            return (page & 1) != 0;
+        })) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_state->mutex);
+        m_state->statistics.refetches++;
+    }
+    // the read ahead runs in the kernel while the node prepares the current tokens
+    madvise(range, end - begin, MADV_WILLNEED);
+#endif
+}
+
+KVCacheMemory::Statistics KVCacheMemory::getStatistics() const {
+    std::lock_guard<std::mutex> lock(m_state->mutex);
+    return m_state->statistics;
+}
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,69 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <oneapi/dnnl/dnnl_common.hpp>
+#include <string>
+
+#include "cpu_memory.h"
+#include "memory_desc/cpu_memory_desc.h"
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Per compiled model allocator of the KV cache buffers of the stateful models with a budget of the resident
+ * memory (see cpu_kv_cache_memory_budget).
+ * The buffers fitting into the budget are allocated in RAM, the rest is backed by the unlinked temporary files, so the
+ * operating system keeps the recently written tokens in the page cache and writes the old ones back to the disk
+ * instead of running out of memory. The file backed buffers are prefetched ahead of the attention.
+ */
+class KVCacheMemory {
+public:
+    using Ptr = std::shared_ptr<KVCacheMemory>;
+
+    struct Statistics {
+        uint64_t residentBytes = 0;
+        uint64_t spilledBytes = 0;
+        uint64_t spills = 0;
+        uint64_t refetches = 0;
+    };
+
+    KVCacheMemory(uint64_t budget, std::string spillDir);
+
+    /**
+     * @brief Allocates the memory for the descriptor with defined max size, in RAM while the budget allows
+     */
+    [[nodiscard]] MemoryPtr allocate(const MemoryDescPtr& desc, const dnnl::engine& eng) const;
+
+    /**
+     * @brief Starts an asynchronous read of the spilled pages written back to the disk, does nothing for the memory
+     * resident in RAM or in the page cache
+     */
+    void prefetch(const MemoryCPtr& mem) const;
+
+    [[nodiscard]] Statistics getStatistics() const;
+
+private:
+    class Block;
+
+    // the accounting outlives the allocator, since the blocks may be released after the compiled model
+    struct State {
+        uint64_t budget = 0;
+        std::string spillDir;
+        mutable std::mutex mutex;
+        Statistics statistics;
+        // the file backed buffers: the begin address and the size
+        std::map<const uint8_t*, size_t> spilled;
+    };
+
+    std::shared_ptr<State> m_state;
+};
+
+}  // namespace ov::intel_cpu
@@ -8,7 +8,10 @@
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <iterator>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <numeric>
 #include <queue>
 #include <string>
@@ -100,6 +103,39 @@ private:
     MemoryBlockWithReuse* m_pInternalMem;
 };
 
+class SynchronizedMemoryBlock : public IMemoryBlockObserver {
+public:
+    explicit SynchronizedMemoryBlock(std::shared_ptr<std::recursive_mutex> mutex)
+        : m_mutex(std::move(mutex)),
+          m_pBlock(std::make_shared<MemoryBlockWithRelease>()) {}
+
+    [[nodiscard]] void* getRawPtr() const noexcept override {
+        return m_pBlock->getRawPtr();
+    }
+    void setExtBuff([[maybe_unused]] void* ptr, [[maybe_unused]] size_t size) override {
+        OPENVINO_THROW("Unexpected setExtBuff call to SynchronizedMemoryBlock");
+    }
+    bool resize(size_t size) override {
+        std::lock_guard<std::recursive_mutex> lock(*m_mutex);
+        return m_pBlock->resize(size);
+    }
+    [[nodiscard]] bool hasExtBuffer() const noexcept override {
+        return m_pBlock->hasExtBuffer();
+    }
+    void registerMemory(Memory* memPtr) override {
+        std::lock_guard<std::recursive_mutex> lock(*m_mutex);
+        m_pBlock->registerMemory(memPtr);
+    }
+    void unregisterMemory(Memory* memPtr) override {
+        std::lock_guard<std::recursive_mutex> lock(*m_mutex);
+        m_pBlock->unregisterMemory(memPtr);
+    }
+
+private:
+    std::shared_ptr<std::recursive_mutex> m_mutex;
+    std::shared_ptr<MemoryBlockWithRelease> m_pBlock;
+};
+
 #ifdef CPU_DEBUG_CAPS
 class IndividualMemoryBlockWithRelease : public IMemoryBlockObserver {
 public:
@@ -201,6 +237,9 @@ private:
 
 class MemoryManagerStatic : public IMemoryManager {
 public:
+    explicit MemoryManagerStatic(SharedWorkspace::Ptr sharedWorkspace = nullptr)
+        : m_sharedWorkspace(std::move(sharedWorkspace)) {}
+
     void insert(const MemoryRegion& reg, [[maybe_unused]] const std::vector<size_t>& syncInds) override {
         OPENVINO_ASSERT(reg.size >= 0, getClassName(), ": got undefined block size");
         m_boxes.emplace_back(MemorySolver::Box{reg.start, reg.finish, reg.size, reg.id});
@@ -226,21 +265,30 @@ private:
         ov::MemorySolver staticMemSolver(boxes_to_process);
         m_totalSize = static_cast<size_t>(staticMemSolver.solve()) * alignment;
 
-        m_workspace = std::make_shared<MemoryBlockWithRelease>();
+        MemoryBlockPtr workspace;
+        if (m_sharedWorkspace) {
+            workspace = m_sharedWorkspace->block();
+        } else {
+            m_workspace = std::make_shared<MemoryBlockWithRelease>();
+            workspace = m_workspace;
+        }
 
         for (const auto& box : boxes_to_process) {
             int64_t offset = staticMemSolver.get_offset(static_cast<int>(box.id));
-            auto memoryBlock = std::make_shared<StaticPartitionMemoryBlock>(m_workspace, offset * alignment);
+            auto memoryBlock = std::make_shared<StaticPartitionMemoryBlock>(workspace, offset * alignment);
             m_blocks[box.id] = std::move(memoryBlock);
         }
     }
 
     void allocate() override {
-        if (m_workspace) {
+        if (m_sharedWorkspace) {
+            m_sharedWorkspace->reserve(m_totalSize);
+        } else if (m_workspace) {
             m_workspace->resize(m_totalSize);
         }
     }
     void release() override {
+        // the shared workspace is in use by the other models of the group
         if (m_workspace) {
             m_workspace->free();
         }
@@ -253,6 +301,7 @@ private:
     MemoryControl::MemorySolution m_blocks;
     std::vector<MemorySolver::Box> m_boxes;
     std::shared_ptr<MemoryBlockWithRelease> m_workspace;
+    SharedWorkspace::Ptr m_sharedWorkspace;
     size_t m_totalSize = 0;
     bool reset_flag = true;
     CPU_DEBUG_CAP_ENABLE(friend MemoryStatisticsRecord dumpStatisticsImpl(const MemoryManagerStatic& obj);)
@@ -517,12 +566,44 @@ MemoryControl::RegionHandlerPtr buildHandler(F&& f, Args&&... args) {
 
 }  // namespace
 
-MemoryControl::MemoryControl(std::string id) : m_id(std::move(id)) {
+SharedWorkspace::SharedWorkspace()
+    : m_mutex(std::make_shared<std::recursive_mutex>()),
+      m_block(std::make_shared<SynchronizedMemoryBlock>(m_mutex)) {}
+
+SharedWorkspace::Ptr SharedWorkspace::get(const std::string& group, int streamId) {
+    static std::mutex mutex;
+    static std::map<std::pair<std::string, int>, std::weak_ptr<SharedWorkspace>> workspaces;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto it = workspaces.begin(); it != workspaces.end();) {
+        it = it->second.expired() ? workspaces.erase(it) : std::next(it);
+    }
+
+    auto& entry = workspaces[{group, streamId}];
+    auto workspace = entry.lock();
+    if (!workspace) {
+        workspace = std::shared_ptr<SharedWorkspace>(new SharedWorkspace());
+        entry = workspace;
+    }
+    return workspace;
+}
+
+void SharedWorkspace::reserve(size_t size) {
+    auto lock = this->lock();
+    if (size > m_size) {
+        m_block->resize(size);
+        m_size = size;
+    }
+}
+
+MemoryControl::MemoryControl(std::string id, SharedWorkspace::Ptr sharedWorkspace) : m_id(std::move(id)) {
     // init handlers
-    m_handlers.emplace_back(buildHandler<MemoryManagerStatic>([](const MemoryRegion& reg) {
-        return reg.size >= 0 && MemoryRegion::RegionType::VARIABLE == reg.type &&
-               MemoryRegion::AllocType::POD == reg.alloc_type;
-    }));
+    m_handlers.emplace_back(buildHandler<MemoryManagerStatic>(
+        [](const MemoryRegion& reg) {
+            return reg.size >= 0 && MemoryRegion::RegionType::VARIABLE == reg.type &&
+                   MemoryRegion::AllocType::POD == reg.alloc_type;
+        },
+        std::move(sharedWorkspace)));
 
     // handler for static tensors
     m_handlers.emplace_back(buildHandler<MemoryManagerNonOverlappingSets>([](const MemoryRegion& reg) {
@@ -589,8 +670,10 @@ MemoryStatistics MemoryControl::dumpStatistics() const {
 }
 #endif  // CPU_DEBUG_CAPS
 
-MemoryControl::Ptr NetworkMemoryControl::createMemoryControlUnit(std::string id) {
-    m_controlUnits.emplace_back(std::shared_ptr<MemoryControl>(new MemoryControl(std::move(id))));
+MemoryControl::Ptr NetworkMemoryControl::createMemoryControlUnit(std::string id,
+                                                                 SharedWorkspace::Ptr sharedWorkspace) {
+    m_controlUnits.emplace_back(
+        std::shared_ptr<MemoryControl>(new MemoryControl(std::move(id), std::move(sharedWorkspace))));
     return m_controlUnits.back();
 }
 
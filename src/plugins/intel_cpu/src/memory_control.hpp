@@ -7,6 +7,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -42,6 +43,43 @@ struct MemoryStatisticsRecord {
 
 using MemoryStatistics = std::vector<MemoryStatisticsRecord>;
 
+/**
+ * @brief The workspace of the static intermediate tensors shared by the compiled models of the same group
+ * (see cpu_shared_activations_group) running on the same stream index. The workspace only grows to the largest size
+ * requested by the models and lives as long as any of them exists. The models must hold the lock while their
+ * tensors located in the workspace are in use.
+ */
+class SharedWorkspace {
+public:
+    using Ptr = std::shared_ptr<SharedWorkspace>;
+
+    static Ptr get(const std::string& group, int streamId);
+
+    // recursive as the workspace may be reallocated by the model holding the lock
+    [[nodiscard]] std::unique_lock<std::recursive_mutex> lock() const {
+        return std::unique_lock<std::recursive_mutex>(*m_mutex);
+    }
+
+    [[nodiscard]] const MemoryBlockPtr& block() const {
+        return m_block;
+    }
+
+    void reserve(size_t size);
+
+    [[nodiscard]] size_t size() const {
+        auto lock = this->lock();
+        return m_size;
+    }
+
+private:
+    SharedWorkspace();
+
+    // shared with the block, which serializes the registration of the memory objects of different models
+    std::shared_ptr<std::recursive_mutex> m_mutex;
+    MemoryBlockPtr m_block;
+    size_t m_size = 0;
+};
+
 class MemoryControl {
 public:
     class RegionHandler;
@@ -67,7 +105,7 @@ public:
     }
 
 private:
-    explicit MemoryControl(std::string id);
+    explicit MemoryControl(std::string id, SharedWorkspace::Ptr sharedWorkspace = nullptr);
     void insert(const MemoryRegion& region, const std::vector<size_t>& syncInds);
     [[nodiscard]] MemoryStatistics dumpStatistics() const;
 
@@ -81,7 +119,7 @@ private:
 class NetworkMemoryControl {
 public:
     NetworkMemoryControl() = default;
-    MemoryControl::Ptr createMemoryControlUnit(std::string id);
+    MemoryControl::Ptr createMemoryControlUnit(std::string id, SharedWorkspace::Ptr sharedWorkspace = nullptr);
 
     void allocateMemory();
     void releaseMemory();
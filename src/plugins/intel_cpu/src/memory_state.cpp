@@ -10,6 +10,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
 #include <utility>
@@ -235,35 +236,19 @@ VariableStateKVcache::VariableStateKVcache(const std::string& name,
     OPENVINO_ASSERT(shape.isDynamic(), "VariableStateKVcache is unexpectedly initalized with a static tensor");
 }
 
-ov::SoPtr<ov::ITensor> VariableStateKVcache::get_state() const {
-    if (!m_internal_mem || !m_hidden_state || is_reset_state()) {
-        auto new_desc = to_static(get_external_desc());
-        auto external_mem = std::make_shared<Memory>(get_engine(), new_desc);
-        return std::make_shared<Tensor>(external_mem);
-    }
-
-    auto actual_internal_desc = m_internal_mem->getDescWithType<BlockedMemoryDesc>();
-    auto&& dims = actual_internal_desc->getShape().getStaticDims();
-
-    auto actual_external_desc = get_external_desc()->cloneWithNewDims(dims);
-    auto external_mem = std::make_shared<Memory>(get_engine(), actual_external_desc);
-
-    // let's assume 4th rank KV tensors. This may be extended later
-    OPENVINO_ASSERT(actual_internal_desc->getShape().getRank() == 4);
-    OPENVINO_ASSERT(actual_external_desc->getShape().getRank() == 4);
-
-    auto&& actual_internal_order = actual_internal_desc->getOrder();
-    // sanity check
-    OPENVINO_ASSERT(actual_internal_order == m_dense_internal_desc->getOrder());
+namespace {
 
+// dequantizes the cache and gathers it along the beam table into the dense external layout
+void copy_to_dense(const KVCacheSharedData& cache, const MemoryPtr& external_mem) {
+    auto&& order = cache.internal_mem->getDescWithType<BlockedMemoryDesc>()->getOrder();
     PlainTensor output;
     PlainTensor pastkv;
     PlainTensor beam_table;
     output.reset(external_mem);
-    beam_table.reset(m_hidden_state);
-    pastkv.reset(m_internal_mem);
-    output = output.permute(actual_internal_order);
-    pastkv = pastkv.permute(actual_internal_order);
+    beam_table.reset(cache.hidden_state);
+    pastkv.reset(cache.internal_mem);
+    output = output.permute(order);
+    pastkv = pastkv.permute(order);
     // S should be always the last dimension
     OPENVINO_ASSERT(all_of(1U, pastkv.stride(3), output.stride(3)));
     auto L0 = pastkv.size(0);
@@ -273,10 +258,10 @@ ov::SoPtr<ov::ITensor> VariableStateKVcache::get_state() const {
     if (pastkv.get_precision() == element::u8) {
         auto nthr = parallel_get_max_threads();
         std::vector<PlainTensor> buffers(nthr);
-        if (m_quant_by_channel) {
+        if (cache.quant_by_channel) {
             parallel_for3d(L0, B, H, [&](size_t ithr, size_t m, size_t b, size_t h) {
                 auto b_kv = static_cast<size_t>(beam_table.at<int32_t>({b, m}));
-                size_t group_id = m / m_group_size;
+                size_t group_id = m / cache.group_size;
                 buffers[ithr].resize<float>({S});
                 attn_dequant_by_channel_u8(pastkv.ptr<uint8_t>(m, b_kv, h),
                                            buffers[ithr].ptr<float>(),
@@ -284,19 +269,19 @@ ov::SoPtr<ov::ITensor> VariableStateKVcache::get_state() const {
                                            S,
                                            pastkv.m_strides[2],
                                            S,
-                                           m_scale_zp.ptr<float>(group_id * 2, b_kv, h),
-                                           m_scale_zp.ptr<float>(group_id * 2 + 1, b_kv, h));
+                                           cache.scale_zp.ptr<float>(group_id * 2, b_kv, h),
+                                           cache.scale_zp.ptr<float>(group_id * 2 + 1, b_kv, h));
                 cpu_convert(buffers[ithr].ptr<float>(), output.ptr_v(m, b, h), element::f32, output.m_dt, S);
             });
         } else {
             parallel_for3d(L0, B, H, [&](size_t ithr, size_t m, size_t b, size_t h) {
                 auto b_kv = static_cast<size_t>(beam_table.at<int32_t>({b, m}));
                 buffers[ithr].resize<float>({S});
-                for (size_t group_id = 0; group_id < S / m_group_size; group_id++) {
-                    attn_dequant_u8(pastkv.ptr<uint8_t>(m, b_kv, h, group_id * m_group_size),
-                                    buffers[ithr].ptr<float>() + group_id * m_group_size,
-                                    m_group_size,
-                                    m_scale_zp.ptr<float>(m, b_kv, h, group_id * 2));
+                for (size_t group_id = 0; group_id < S / cache.group_size; group_id++) {
+                    attn_dequant_u8(pastkv.ptr<uint8_t>(m, b_kv, h, group_id * cache.group_size),
+                                    buffers[ithr].ptr<float>() + group_id * cache.group_size,
+                                    cache.group_size,
+                                    cache.scale_zp.ptr<float>(m, b_kv, h, group_id * 2));
                 }
                 cpu_convert(buffers[ithr].ptr<float>(), output.ptr_v(m, b, h), element::f32, output.m_dt, S);
             });
@@ -307,12 +292,121 @@ ov::SoPtr<ov::ITensor> VariableStateKVcache::get_state() const {
             cpu_convert(pastkv.ptr_v(m, b_kv, h), output.ptr_v(m, b, h), pastkv.m_dt, output.m_dt, S);
         });
     }
+}
+
+}  // namespace
+
+KVCacheSnapshot::KVCacheSnapshot(std::shared_ptr<const KVCacheSharedData> cache,
+                                 MemoryDescPtr external_desc,
+                                 const dnnl::engine& engine)
+    : m_cache(std::move(cache)),
+      m_external_desc(std::move(external_desc)),
+      m_engine(engine),
+      m_element_type(m_external_desc->getPrecision()),
+      m_shape(m_external_desc->getShape().getStaticDims()),
+      m_strides(m_shape.size()) {
+    size_t stride = m_element_type.size();
+    for (size_t i = m_shape.size(); i > 0; i--) {
+        m_strides[i - 1] = stride;
+        stride *= m_shape[i - 1];
+    }
+}
+
+void KVCacheSnapshot::set_shape(ov::Shape shape) {
+    OPENVINO_ASSERT(shape == m_shape, "KV cache snapshot can't be reshaped");
+}
 
-    return std::make_shared<Tensor>(external_mem);
+const ov::element::Type& KVCacheSnapshot::get_element_type() const {
+    return m_element_type;
+}
+
+const ov::Shape& KVCacheSnapshot::get_shape() const {
+    return m_shape;
+}
+
+const ov::Strides& KVCacheSnapshot::get_strides() const {
+    return m_strides;
+}
+
+void* KVCacheSnapshot::data() {
+    return dense_memory()->getData();
+}
+
+void* KVCacheSnapshot::data(const element::Type& type) {
+    return const_cast<void*>(std::as_const(*this).data(type));
+}
+
+const void* KVCacheSnapshot::data() const {
+    return dense_memory()->getData();
+}
+
+const void* KVCacheSnapshot::data(const element::Type& type) const {
+    OPENVINO_ASSERT(any_of(type, ov::element::dynamic, get_element_type()),
+                    "Tensor data with element type ",
+                    get_element_type(),
+                    ", is not representable as pointer to ",
+                    type);
+    return dense_memory()->getData();
+}
+
+MemoryPtr KVCacheSnapshot::dense_memory() const {
+    std::call_once(m_dense_flag, [this] {
+        m_dense = std::make_shared<Memory>(m_engine, m_external_desc);
+        copy_to_dense(*m_cache, m_dense);
+    });
+    return m_dense;
+}
+
+ov::SoPtr<ov::ITensor> VariableStateKVcache::get_state() const {
+    if (!m_internal_mem || !m_hidden_state || is_reset_state()) {
+        auto new_desc = to_static(get_external_desc());
+        auto external_mem = std::make_shared<Memory>(get_engine(), new_desc);
+        return std::make_shared<Tensor>(external_mem);
+    }
+
+    auto actual_internal_desc = m_internal_mem->getDescWithType<BlockedMemoryDesc>();
+    auto&& dims = actual_internal_desc->getShape().getStaticDims();
+
+    // let's assume 4th rank KV tensors. This may be extended later
+    OPENVINO_ASSERT(actual_internal_desc->getShape().getRank() == 4);
+    // sanity check
+    OPENVINO_ASSERT(actual_internal_desc->getOrder() == m_dense_internal_desc->getOrder());
+
+    // the snapshot shares the cache with the state, the first one writing to it makes a private copy
+    if (!m_shared || m_shared->internal_mem != m_internal_mem || m_shared->hidden_state != m_hidden_state) {
+        m_shared = std::make_shared<const KVCacheSharedData>(KVCacheSharedData{m_internal_mem,
+                                                                               m_hidden_state,
+                                                                               m_scale_zp,
+                                                                               m_internal_mem_max_size,
+                                                                               m_hidden_state_max_size,
+                                                                               m_quant_by_channel,
+                                                                               m_group_size});
+    }
+    return std::make_shared<KVCacheSnapshot>(m_shared, get_external_desc()->cloneWithNewDims(dims), get_engine());
 }
 
 void VariableStateKVcache::set_state_impl(const ov::SoPtr<ov::ITensor>& state) {
+    // a snapshot of a compatible cache (e.g. a computed prompt prefix) is shared without copies until the next write
+    if (auto snapshot = std::dynamic_pointer_cast<KVCacheSnapshot>(state._ptr)) {
+        const auto& cache = snapshot->get_cache();
+        auto cache_desc = cache->internal_mem->getDescWithType<BlockedMemoryDesc>();
+        if (cache_desc->getPrecision() == m_dense_internal_desc->getPrecision() &&
+            cache_desc->getOrder() == m_dense_internal_desc->getOrder() &&
+            cache->quant_by_channel == m_quant_by_channel && cache->group_size == m_group_size &&
+            snapshot->get_element_type() == get_external_desc()->getPrecision()) {
+            m_state = {};
+            m_shared = cache;
+            m_internal_mem = cache->internal_mem;
+            m_hidden_state = cache->hidden_state;
+            m_scale_zp = cache->scale_zp;
+            m_internal_mem_max_size = cache->internal_mem_max_size;
+            m_hidden_state_max_size = cache->hidden_state_max_size;
+            return;
+        }
+    }
+
     // 1. reset the memory object
+    m_shared.reset();
     m_state = state;  // simply to extend the lifetime
     auto state_desc = MemoryDescUtils::generateCpuBlockedMemoryDesc(m_state);
 
@@ -422,6 +516,7 @@ MemoryPtr VariableStateKVcache::internal_state_mem() const {
 
 void VariableStateKVcache::assign_internal_state(const MemoryPtr& mem) {
     m_internal_mem = mem;
+    release_shared();
 }
 
 MemoryPtr VariableStateKVcache::hidden_state_mem() const {
@@ -430,5 +525,12 @@ MemoryPtr VariableStateKVcache::hidden_state_mem() const {
 
 void VariableStateKVcache::assign_hidden_state(const MemoryPtr& mem) {
     m_hidden_state = mem;
+    release_shared();
+}
+
+void VariableStateKVcache::release_shared() {
+    if (m_shared && m_shared->internal_mem != m_internal_mem && m_shared->hidden_state != m_hidden_state) {
+        m_shared.reset();
+    }
 }
 }  // namespace ov::intel_cpu
@@ -7,12 +7,17 @@
 #include <array>
 #include <cstddef>
 #include <memory>
+#include <mutex>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
 
 #include "cpu_memory.h"
 #include "memory_desc/blocked_memory_desc.h"
 #include "memory_desc/cpu_memory_desc.h"
+#include "openvino/core/shape.hpp"
+#include "openvino/core/strides.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/runtime/itensor.hpp"
 #include "openvino/runtime/ivariable_state.hpp"
 #include "openvino/runtime/so_ptr.hpp"
 #include "openvino/runtime/tensor.hpp"
@@ -118,6 +123,62 @@ private:
     MemoryDescPtr m_internal_desc;  // mem desc required by the graph internal tensor
 };
 
+/**
+ * @brief The KV cache memory of a VariableStateKVcache shared copy-on-write between the states and their snapshots.
+ * The memory is immutable while it is referenced by more than one owner, so a state writing to a shared cache
+ * allocates the private buffers first (see VariableStateKVcache::internal_state_max_size()).
+ */
+struct KVCacheSharedData {
+    MemoryPtr internal_mem;  // kv cache
+    MemoryPtr hidden_state;  // beam access table
+    PlainTensor scale_zp;
+    size_t internal_mem_max_size = 0;
+    size_t hidden_state_max_size = 0;
+    bool quant_by_channel = false;
+    size_t group_size = 0;
+};
+
+/**
+ * @brief The tensor returned by VariableStateKVcache::get_state().
+ * Keeps a reference to the cache instead of a copy, the dense external layout is only produced on the data access.
+ * Setting the snapshot to a state of another infer request shares the cache with it, so a prompt prefix computed once
+ * may be reused by many requests without copies and recomputation.
+ */
+class KVCacheSnapshot : public ov::ITensor {
+public:
+    KVCacheSnapshot(std::shared_ptr<const KVCacheSharedData> cache,
+                    MemoryDescPtr external_desc,
+                    const dnnl::engine& engine);
+
+    void set_shape(ov::Shape shape) override;
+    const ov::element::Type& get_element_type() const override;
+    const ov::Shape& get_shape() const override;
+    const ov::Strides& get_strides() const override;
+
+    void* data() override;
+    void* data(const element::Type& type) override;
+    const void* data() const override;
+    const void* data(const element::Type& type) const override;
+
+    const std::shared_ptr<const KVCacheSharedData>& get_cache() const {
+        return m_cache;
+    }
+
+private:
+    MemoryPtr dense_memory() const;
+
+    std::shared_ptr<const KVCacheSharedData> m_cache;
+    MemoryDescPtr m_external_desc;
+    // the engine of the state, the dense memory is allocated on it
+    dnnl::engine m_engine;
+    ov::element::Type m_element_type;
+    ov::Shape m_shape;
+    ov::Strides m_strides;
+
+    mutable std::once_flag m_dense_flag;
+    mutable MemoryPtr m_dense;
+};
+
 class VariableStateKVcache : public VariableStateBase {
 public:
     VariableStateKVcache(const std::string& name,
@@ -140,16 +201,16 @@ public:
     MemoryPtr hidden_state_mem() const;
     void assign_hidden_state(const MemoryPtr& mem);
 
-    // size in elements count
+    // size in elements count, zero while the memory is shared with a snapshot, so the next write reallocates it
     size_t internal_state_max_size() const {
-        return m_internal_mem_max_size;
+        return is_shared(m_internal_mem) ? 0 : m_internal_mem_max_size;
     }
     void assign_internal_state_max_size(size_t max_size) {
         m_internal_mem_max_size = max_size;
     }
 
     size_t hidden_state_max_size() const {
-        return m_hidden_state_max_size;
+        return is_shared(m_hidden_state) ? 0 : m_hidden_state_max_size;
     }
     void assign_hidden_state_max_size(size_t max_size) {
         m_hidden_state_max_size = max_size;
@@ -168,6 +229,12 @@ private:
     void reset_impl() override;
     void commit_impl() override;
 
+    bool is_shared(const MemoryPtr& mem) const {
+        return m_shared && m_shared.use_count() > 1 && mem &&
+               (mem == m_shared->internal_mem || mem == m_shared->hidden_state);
+    }
+    void release_shared();
+
     MemoryPtr m_internal_mem;  // kv cache
     MemoryPtr m_hidden_state;  // beam access table
     size_t m_internal_mem_max_size = 0;
@@ -180,6 +247,9 @@ private:
     PlainTensor m_scale_zp;
     bool m_quant_by_channel = false;
     size_t m_group_size = 0;
+
+    // the cache memory shared with the snapshots returned by get_state() or adopted from a snapshot by set_state()
+    mutable std::shared_ptr<const KVCacheSharedData> m_shared;
 };
 
 using MemStatePtr = std::shared_ptr<IVariableState>;
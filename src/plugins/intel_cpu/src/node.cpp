@@ -15,6 +15,7 @@
 #include <limits>
 #include <memory>
 #include <oneapi/dnnl/dnnl.hpp>
+#include <optional>
 #include <sstream>
 #include <string>
 #include <unordered_map>
@@ -44,6 +45,7 @@
 #include "openvino/core/shape.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/util/pp.hpp"
+#include "packed_weights.hpp"
 #include "partitioned_mem_blk.h"
 #include "selective_build.h"
 #include "shape_inference/shape_inference_cpu.hpp"
@@ -754,7 +756,7 @@ static void fetchRawMemory(const MemoryPtr& mem) {
     }
 }
 
-void Node::updateShapes() {
+void Node::updateShapes(std::vector<VectorDims>* resolvedShapes) {
     OPENVINO_ASSERT(isDynamicNode(),
                     "Node::updateShapes() is called to a static shape node of type: ",
                     getTypeStr(),
@@ -765,6 +767,9 @@ void Node::updateShapes() {
             auto result = shapeInfer();
             if (ShapeInferStatus::success == result.status) {
                 redefineOutputMemory(result.dims);
+                if (resolvedShapes) {
+                    *resolvedShapes = std::move(result.dims);
+                }
             }
         } else {
             // guard check for internal dynamic nodes to avoid possible overestimation of the required memory size
@@ -793,6 +798,18 @@ void Node::updateShapes() {
     }
 }
 
+void Node::replayShapes(const std::vector<VectorDims>& resolvedShapes) {
+    if (!needShapeInfer()) {
+        updateShapes();
+        return;
+    }
+    try {
+        redefineOutputMemory(resolvedShapes);
+    } catch (const std::exception& exp) {
+        CPU_NODE_THROW(exp.what());
+    }
+}
+
 void Node::updateDynamicParams() {
     OPENVINO_ASSERT(isDynamicNode(),
                     "Node::updateDynamicParams() is called to a static shape node of type: ",
@@ -855,6 +872,10 @@ bool Node::outputShapeDataDependency() const {
     return false;
 }
 
+bool Node::shapeInferDependsOnValues() const {
+    return shapeInference && EMPTY_PORT_MASK != shapeInference->get_port_mask();
+}
+
 void Node::redefineOutputMemory(const std::vector<VectorDims>& newOutputShapes) {
     OPENVINO_ASSERT(newOutputShapes.size() == outputShapes.size(),
                     "Number shapes mismatch with real outputs number for node with name: ",
@@ -1190,12 +1211,27 @@ MemoryPtr Node::prepareWeightMemory(DnnlMemoryDescPtr dstWeightDesc, DnnlMemoryD
         return itr->second;
     }
 
+    const auto packedWeights = context->getPackedWeights();
+    const auto packedKey = packedWeights ? packedWeights->getKey(edgeMem->getData(), dstWeightDesc) : std::nullopt;
+    auto findOrCreate = [&]() {
+        if (packedKey) {
+            if (auto packed = packedWeights->find(*packedKey, dstWeightDesc, getEngine())) {
+                return packed;
+            }
+        }
+        return create();
+    };
+
     auto weightCache = context->getWeightsCache();
     if (weightCache != nullptr) {
         const auto string_hash = DnnlExtensionUtils::computeWeightsStringHash(edgeMem, dstWeightDesc);
-        ptr = static_cast<MemoryPtr>(*weightCache->findOrCreate(string_hash, create));
+        ptr = static_cast<MemoryPtr>(*weightCache->findOrCreate(string_hash, findOrCreate));
     } else {
-        ptr = create();
+        ptr = findOrCreate();
+    }
+
+    if (packedKey) {
+        packedWeights->record(*packedKey, ptr);
     }
 
     (*privateWeightCache)[format] = ptr;
@@ -1217,8 +1253,10 @@ void Node::toNumaNodeImpl(int numaNodeID) {
     }
 
     // create scratch pad from specified numa node
+    curNumaNode = numaNodeID;
+    privateScratchPad.reset();
     if (scratchpadMem) {
-        scratchpadMem = context->getScratchPad()->createScratchPadMem(scratchpadMem->getDescPtr());
+        scratchpadMem = getScratchPad()->createScratchPadMem(scratchpadMem->getDescPtr());
         primArgs[DNNL_ARG_SCRATCHPAD] = scratchpadMem->getPrimitive();
     }
 
@@ -1229,8 +1267,16 @@ void Node::toNumaNodeImpl(int numaNodeID) {
     if (auto it = primArgs.find(DNNL_ARG_BIAS); it != primArgs.end()) {
         mbind_move(it->second, numaNodeID);
     }
+}
 
-    curNumaNode = numaNodeID;
+DnnlScratchPadPtr Node::getScratchPad() {
+    if (!context->getConfig().parallelBranches) {
+        return context->getScratchPad();
+    }
+    if (!privateScratchPad) {
+        privateScratchPad = std::make_shared<DnnlScratchPad>(getEngine(), curNumaNode);
+    }
+    return privateScratchPad;
 }
 
 bool Node::isInPlace() const {
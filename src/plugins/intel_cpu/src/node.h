@@ -338,6 +338,11 @@ public:
     virtual bool isExecutable() const {
         return !hasEmptyInputTensors();
     }
+    // false for the nodes accessing the memory not described by their edges (states, inner graphs),
+    // such nodes are never executed concurrently with other nodes (see Config::parallelBranches)
+    virtual bool canBeExecutedConcurrently() const {
+        return true;
+    }
 
     enum class ConstantType : uint8_t {
         Const,          // Node is placed in a constant subgraph
@@ -523,12 +528,24 @@ public:
     // but this requires changes in all the nodes. Since moving to a numa node right before an execute
     // is a temprorary solution, do it this way for now.
     void executeStatic(const dnnl::stream& strm, int numaId = -1);
-    void updateShapes();
+    /**
+     * @brief Infers and redefines the output shapes if the input shapes have changed.
+     * @param resolvedShapes if not null, receives the inferred output shapes. Stays empty if the shape inference was
+     * not needed or skipped, i.e. the output shapes are defined by the execution
+     */
+    void updateShapes(std::vector<VectorDims>* resolvedShapes = nullptr);
+    /**
+     * @brief Redefines the output shapes with the ones resolved by updateShapes() for the same input shapes
+     * earlier, so the shape inference is not performed again
+     */
+    void replayShapes(const std::vector<VectorDims>& resolvedShapes);
     void updateDynamicParams();
     void executeDynamic(const dnnl::stream& strm, int numaId = -1);
     virtual void redefineOutputMemory(const std::vector<VectorDims>& newOutputShapes);
     void redefineOutputMemory(size_t port, const VectorDims& new_output_shape) const;
     bool outputShapeDataDependency() const;
+    // the shape inference reads the values of some inputs, not only their shapes
+    bool shapeInferDependsOnValues() const;
 
     virtual void initSupportedPrimitiveDescriptors();
 
@@ -868,9 +885,13 @@ protected:
                                        NameFromType(getType()));
     }
 
+    // the scratchpad of the stream or the private one of the node if the nodes may be executed concurrently (see
+    // Config::parallelBranches)
+    DnnlScratchPadPtr getScratchPad();
+
     MemoryPtr getScratchPadMem(const MemoryDescPtr& desc) {
         if (!scratchpadMem || !scratchpadMem->getDesc().isCompatible(*desc)) {
-            scratchpadMem = context->getScratchPad()->createScratchPadMem(desc);
+            scratchpadMem = getScratchPad()->createScratchPadMem(desc);
         }
         return scratchpadMem;
     }
@@ -921,6 +942,7 @@ private:
     PerfCounters profiling;
 
     MemoryPtr scratchpadMem;
+    DnnlScratchPadPtr privateScratchPad;
 
     // Hold output scales
     std::vector<float> DQScales;
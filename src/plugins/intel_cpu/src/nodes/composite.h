@@ -45,6 +45,10 @@ public:
         return true;
     }
 
+    bool canBeExecutedConcurrently() const override {
+        return false;
+    }
+
     void getSupportedDescriptors() override {};
     void selectOptimalPrimitiveDescriptor() override;
     void createPrimitive() override;
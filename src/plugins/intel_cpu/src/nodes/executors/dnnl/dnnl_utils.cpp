@@ -10,6 +10,7 @@
 #include <memory>
 #include <oneapi/dnnl/dnnl.hpp>
 #include <oneapi/dnnl/dnnl_common.hpp>
+#include <optional>
 #include <string>
 #include <unordered_map>
 
@@ -22,6 +23,7 @@
 #include "nodes/reorder.h"
 #include "openvino/core/except.hpp"
 #include "openvino/core/type/element_type.hpp"
+#include "packed_weights.hpp"
 #include "weights_cache.hpp"
 
 namespace ov::intel_cpu::utils {
@@ -41,7 +43,8 @@ MemoryPtr prepareWeightsMemory(const DnnlMemoryDescPtr& srcWeightDesc,
                                 context->getRuntimeCache(),
                                 context->getWeightsCache(),
                                 privateWeightCache,
-                                needShiftSignedToUnsigned);
+                                needShiftSignedToUnsigned,
+                                context->getPackedWeights());
 }
 
 MemoryPtr prepareWeightsMemory(const DnnlMemoryDescPtr& srcWeightDesc,
@@ -51,7 +54,8 @@ MemoryPtr prepareWeightsMemory(const DnnlMemoryDescPtr& srcWeightDesc,
                                const MultiCachePtr& rtCache,
                                const WeightsSharing::Ptr& globalWeightCache,
                                const std::shared_ptr<std::unordered_map<std::string, MemoryPtr>>& privateWeightCache,
-                               bool needShiftSignedToUnsigned) {
+                               bool needShiftSignedToUnsigned,
+                               const PackedWeights::Ptr& packedWeights) {
     const auto format = dstWeightDesc->serializeFormat();
     if (privateWeightCache) {
         auto itr = privateWeightCache->find(format);
@@ -100,13 +104,27 @@ MemoryPtr prepareWeightsMemory(const DnnlMemoryDescPtr& srcWeightDesc,
         return _ptr;
     };
 
+    const auto packedKey = packedWeights ? packedWeights->getKey(weightsMem->getData(), dstWeightDesc) : std::nullopt;
+    auto findOrCreate = [&]() {
+        if (packedKey) {
+            if (auto packed = packedWeights->find(*packedKey, dstWeightDesc, eng)) {
+                return packed;
+            }
+        }
+        return create();
+    };
+
     MemoryPtr ptr;
     if (globalWeightCache && dnnl::memory::format_kind::blocked == dstWeightDesc->getDnnlDesc().get_format_kind()) {
         ptr = MemoryPtr(
             *globalWeightCache->findOrCreate(DnnlExtensionUtils::computeWeightsStringHash(weightsMem, dstWeightDesc),
-                                             create));
+                                             findOrCreate));
     } else {
-        ptr = create();
+        ptr = findOrCreate();
+    }
+
+    if (packedKey) {
+        packedWeights->record(*packedKey, ptr);
     }
 
     if (privateWeightCache) {
@@ -15,6 +15,7 @@
 #include "cpu_memory.h"
 #include "memory_desc/dnnl_memory_desc.h"
 #include "nodes/executors/executor.hpp"
+#include "packed_weights.hpp"
 #include "weights_cache.hpp"
 
 namespace ov::intel_cpu::utils {
@@ -31,5 +32,6 @@ MemoryPtr prepareWeightsMemory(const DnnlMemoryDescPtr& srcWeightDesc,
                                const MultiCachePtr& rtCache,
                                const WeightsSharing::Ptr& globalWeightCache,
                                const std::shared_ptr<std::unordered_map<std::string, MemoryPtr>>& privateWeightCache,
-                               bool needShiftSignedToUnsigned = false);
+                               bool needShiftSignedToUnsigned = false,
+                               const PackedWeights::Ptr& packedWeights = nullptr);
 }  // namespace ov::intel_cpu::utils
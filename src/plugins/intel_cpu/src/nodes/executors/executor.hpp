@@ -22,6 +22,7 @@
 #include "onednn/iml_type_mapper.h"
 #include "openvino/core/except.hpp"
 #include "openvino/core/visibility.hpp"
+#include "packed_weights.hpp"
 #include "weights_cache.hpp"
 
 namespace ov::intel_cpu {
@@ -58,10 +59,12 @@ public:
         : runtimeCache(graphContext->getParamsCache()),
           scratchPads(graphContext->getScratchPads()),
           weightsCache(graphContext->getWeightsCache()),
+          packedWeights(graphContext->getPackedWeights()),
           engine(graphContext->getEngine()),
           implPriorities(std::move(implPriorities)),
           privateWeighCache(std::move(privateWeighCache)),
-          numNumaNodes(graphContext->getNumNumaNodes()) {
+          numNumaNodes(graphContext->getNumNumaNodes()),
+          privateScratchPads(graphContext->getConfig().parallelBranches) {
         auto cpuStreamsExecutor = graphContext->getCPUStreamExecutor();
         curNumaNodeId = std::max(0, cpuStreamsExecutor ? cpuStreamsExecutor->get_numa_node_id() : curNumaNodeId);
     }
@@ -73,6 +76,13 @@ public:
     }
 
     [[nodiscard]] DnnlScratchPadPtr getScratchPad() const {
+        // the context belongs to one node, so its executors get the private scratchpad of the node in the parallel mode
+        if (privateScratchPads) {
+            if (!privateScratchPad) {
+                privateScratchPad = std::make_shared<DnnlScratchPad>(engine, curNumaNodeId);
+            }
+            return privateScratchPad;
+        }
         return scratchPads[curNumaNodeId];
     }
 
@@ -92,18 +102,25 @@ public:
         return weightsCache;
     }
 
+    [[nodiscard]] PackedWeights::Ptr getPackedWeights() const {
+        return packedWeights;
+    }
+
 private:
     // weak_ptr is required to avoid cycle dependencies with MultiCache
     // since ExecutorContext is stored in Executor itself
     MultiCacheWeakPtr runtimeCache;
     std::vector<DnnlScratchPadPtr> scratchPads;
     WeightsSharing::Ptr weightsCache;
+    PackedWeights::Ptr packedWeights;
     const dnnl::engine& engine;
     std::vector<impl_desc_type> implPriorities;
     // @todo remove after global cache is used exclusevly
     std::shared_ptr<std::unordered_map<std::string, MemoryPtr>> privateWeighCache;
     int numNumaNodes;
     int curNumaNodeId = -1;
+    bool privateScratchPads = false;
+    mutable DnnlScratchPadPtr privateScratchPad;
 };
 
 class ExecutorFactoryLegacy {
@@ -0,0 +1,204 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fused_preprocess.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <oneapi/dnnl/dnnl_common.hpp>
+#include <string>
+#include <vector>
+
+#include "cpu_types.h"
+#include "graph_context.h"
+#include "memory_desc/cpu_memory_desc.h"
+#include "node.h"
+#include "onednn/iml_type_mapper.h"
+#include "openvino/core/except.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/parallel.hpp"
+#include "openvino/core/type.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "shape_inference/shape_inference_cpu.hpp"
+#include "transformations/cpu_opset/common/op/fused_preprocess.hpp"
+
+namespace ov::intel_cpu::node {
+
+bool FusedPreprocess::isSupportedOperation(const std::shared_ptr<const ov::Node>& op,
+                                           std::string& errorMessage) noexcept {
+    try {
+        if (!ov::as_type_ptr<const FusedPreprocessNode>(op)) {
+            errorMessage = "Only FusedPreprocess from CPU internal opset is supported";
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+
+    return true;
+}
+
+FusedPreprocess::FusedPreprocess(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& context)
+    : Node(op, context, NgraphShapeInferFactory(op)) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        OPENVINO_THROW_NOT_IMPLEMENTED(errorMessage);
+    }
+
+    const auto& config = ov::as_type_ptr<const FusedPreprocessNode>(op)->get_config();
+    bgr = config.bgr;
+    planar = config.planar;
+    twoPlanes = op->get_input_size() == 2;
+    if (config.resize_mode == "linear") {
+        resizeMode = ResizeMode::Linear;
+    } else if (config.resize_mode == "nearest") {
+        resizeMode = ResizeMode::Nearest;
+    }
+    std::copy(config.scale.begin(), config.scale.end(), scale.begin());
+    std::copy(config.shift.begin(), config.shift.end(), shift.begin());
+}
+
+void FusedPreprocess::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty()) {
+        return;
+    }
+
+    std::vector<PortConfigurator> inPortConfigs(getOriginalInputsNumber(), {LayoutType::ncsp, ov::element::u8});
+    addSupportedPrimDesc(inPortConfigs, {{LayoutType::ncsp, ov::element::f32}}, ref_any);
+}
+
+FusedPreprocess::AxisTable FusedPreprocess::buildAxisTable(size_t inSize, size_t outSize) const {
+    AxisTable table;
+    table.idx0.resize(outSize);
+    table.idx1.resize(outSize);
+    table.weights.resize(outSize, 0.F);
+
+    const auto maxIdx = static_cast<float>(inSize - 1);
+    const float ratio = static_cast<float>(inSize) / static_cast<float>(outSize);
+    for (size_t i = 0; i < outSize; i++) {
+        // half_pixel coordinate transformation
+        const float coord = (static_cast<float>(i) + 0.5F) * ratio - 0.5F;
+        switch (resizeMode) {
+        case ResizeMode::None:
+            table.idx0[i] = i;
+            table.idx1[i] = i;
+            break;
+        case ResizeMode::Linear: {
+            const float clamped = std::min(std::max(coord, 0.F), maxIdx);
+            const auto idx = static_cast<size_t>(clamped);
+            table.idx0[i] = idx;
+            table.idx1[i] = std::min(idx + 1, inSize - 1);
+            table.weights[i] = clamped - static_cast<float>(idx);
+            break;
+        }
+        case ResizeMode::Nearest: {
+            // round_prefer_floor nearest mode
+            const float floored = std::floor(coord);
+            const float nearest = coord - floored == 0.5F ? floored : std::round(coord);
+            const auto idx = static_cast<size_t>(std::min(std::max(nearest, 0.F), maxIdx));
+            table.idx0[i] = idx;
+            table.idx1[i] = idx;
+            break;
+        }
+        }
+    }
+    return table;
+}
+
+void FusedPreprocess::prepareParams() {
+    const auto& srcDims = getSrcMemoryAtPort(0)->getStaticDims();
+    const auto& dstDims = getDstMemoryAtPort(0)->getStaticDims();
+
+    batch = srcDims[0];
+    srcH = twoPlanes ? srcDims[1] : srcDims[1] * 2 / 3;
+    srcW = srcDims[2];
+    dstH = planar ? dstDims[2] : dstDims[1];
+    dstW = planar ? dstDims[3] : dstDims[2];
+    if (srcH % 2 != 0 || srcW % 2 != 0) {
+        CPU_NODE_THROW("expects even image height and width, got ", srcH, "x", srcW);
+    }
+
+    rowTable = buildAxisTable(srcH, dstH);
+    colTable = buildAxisTable(srcW, dstW);
+    rowBuffers.resize(static_cast<size_t>(parallel_get_max_threads()) * 2 * srcW * 3);
+}
+
+void FusedPreprocess::convertRow(const uint8_t* y, const uint8_t* uv, size_t h, float* dst) const {
+    // the same color conversion formula as in ColorConvert, rounded to u8 as NV12toRGB/NV12toBGR do for u8 images
+    auto clip = [](float a) {
+        return std::min(std::max(std::round(a), 0.F), 255.F);
+    };
+    const uint8_t* yRow = y + h * srcW;
+    const uint8_t* uvRow = uv + (h / 2) * srcW;
+    const size_t rIdx = bgr ? 2 : 0;
+    const size_t bIdx = bgr ? 0 : 2;
+    for (size_t w = 0; w < srcW; w++) {
+        const float c = static_cast<float>(yRow[w]) - 16.F;
+        const float d = static_cast<float>(uvRow[(w / 2) * 2]) - 128.F;
+        const float e = static_cast<float>(uvRow[(w / 2) * 2 + 1]) - 128.F;
+        dst[w * 3 + rIdx] = clip(1.164F * c + 1.596F * e);
+        dst[w * 3 + 1] = clip(1.164F * c - 0.391F * d - 0.813F * e);
+        dst[w * 3 + bIdx] = clip(1.164F * c + 2.018F * d);
+    }
+}
+
+void FusedPreprocess::execute([[maybe_unused]] const dnnl::stream& strm) {
+    const auto* srcY = getSrcDataAtPortAs<const uint8_t>(0);
+    const auto* srcUV = twoPlanes ? getSrcDataAtPortAs<const uint8_t>(1) : nullptr;
+    auto* dstData = getDstDataAtPortAs<float>(0);
+
+    const size_t planeSize = srcH * srcW;
+    const size_t imageSize = twoPlanes ? planeSize : planeSize * 3 / 2;
+    const size_t dstPlaneSize = dstH * dstW;
+
+    /* Every output row is produced in one go:
+       1. Color convert the (one or two) source rows the output row depends on into a per-thread f32 buffer.
+       2. Interpolate the buffered rows, apply the per-channel scale and shift and store the result in the output
+          layout.
+    */
+    parallel_for2d(batch, dstH, [&](size_t n, size_t oh) {
+        const uint8_t* y = srcY + n * imageSize;
+        const uint8_t* uv = twoPlanes ? srcUV + n * planeSize / 2 : y + planeSize;
+
+        float* row0 = &rowBuffers[static_cast<size_t>(parallel_get_thread_num()) * 2 * srcW * 3];
+        float* row1 = row0 + srcW * 3;
+        const float wy = rowTable.weights[oh];
+        convertRow(y, uv, rowTable.idx0[oh], row0);
+        if (wy != 0.F) {
+            convertRow(y, uv, rowTable.idx1[oh], row1);
+        } else {
+            row1 = row0;
+        }
+
+        float* dst = planar ? dstData + n * 3 * dstPlaneSize + oh * dstW : dstData + (n * dstH + oh) * dstW * 3;
+        for (size_t ow = 0; ow < dstW; ow++) {
+            const size_t x0 = colTable.idx0[ow] * 3;
+            const size_t x1 = colTable.idx1[ow] * 3;
+            const float wx = colTable.weights[ow];
+            for (size_t c = 0; c < 3; c++) {
+                const float top = row0[x0 + c] + wx * (row0[x1 + c] - row0[x0 + c]);
+                const float bottom = row1[x0 + c] + wx * (row1[x1 + c] - row1[x0 + c]);
+                const float value = (top + wy * (bottom - top)) * scale[c] + shift[c];
+                if (planar) {
+                    dst[c * dstPlaneSize + ow] = value;
+                } else {
+                    dst[ow * 3 + c] = value;
+                }
+            }
+        }
+    });
+}
+
+void FusedPreprocess::executeDynamicImpl(const dnnl::stream& strm) {
+    execute(strm);
+}
+
+bool FusedPreprocess::created() const {
+    return getType() == Type::FusedPreprocess;
+}
+
+}  // namespace ov::intel_cpu::node
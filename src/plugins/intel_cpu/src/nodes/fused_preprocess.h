@@ -0,0 +1,69 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <node.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <oneapi/dnnl/dnnl_common.hpp>
+#include <string>
+#include <vector>
+
+#include "graph_context.h"
+#include "openvino/core/node.hpp"
+
+namespace ov::intel_cpu::node {
+
+class FusedPreprocess : public Node {
+public:
+    FusedPreprocess(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& context);
+
+    void getSupportedDescriptors() override {};
+    void initSupportedPrimitiveDescriptors() override;
+    void execute(const dnnl::stream& strm) override;
+    bool created() const override;
+
+    static bool isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept;
+
+protected:
+    void executeDynamicImpl(const dnnl::stream& strm) override;
+    void prepareParams() override;
+
+private:
+    enum class ResizeMode : uint8_t { None, Linear, Nearest };
+
+    // source index pair and the weight of the second one for every output row or column
+    struct AxisTable {
+        std::vector<size_t> idx0;
+        std::vector<size_t> idx1;
+        std::vector<float> weights;
+    };
+
+    AxisTable buildAxisTable(size_t inSize, size_t outSize) const;
+    void convertRow(const uint8_t* y, const uint8_t* uv, size_t h, float* dst) const;
+
+    bool bgr = false;
+    bool planar = false;
+    bool twoPlanes = false;
+    ResizeMode resizeMode = ResizeMode::None;
+    std::array<float, 3> scale = {1.F, 1.F, 1.F};
+    std::array<float, 3> shift = {0.F, 0.F, 0.F};
+
+    size_t batch = 0;
+    size_t srcH = 0;
+    size_t srcW = 0;
+    size_t dstH = 0;
+    size_t dstW = 0;
+
+    AxisTable rowTable;
+    AxisTable colTable;
+    // two converted source rows per thread
+    std::vector<float> rowBuffers;
+};
+
+}  // namespace ov::intel_cpu::node
@@ -39,6 +39,9 @@ public:
     bool isExecutable() const override {
         return true;
     }
+    bool canBeExecutedConcurrently() const override {
+        return false;
+    }
 
 protected:
     void executeDynamicImpl(const dnnl::stream& strm) override;
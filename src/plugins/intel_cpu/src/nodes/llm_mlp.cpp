@@ -614,9 +614,9 @@ void LLMMLP::createPrimitive() {
     auto rtPrecision = getInputPrecisions()[0];
 #ifdef OPENVINO_ARCH_X86_64
     if (rtPrecision == ov::element::bf16) {
-        m_executor = std::make_shared<Executor<ov::bfloat16>>(this, m_mlp_config, context->getScratchPad());
+        m_executor = std::make_shared<Executor<ov::bfloat16>>(this, m_mlp_config, getScratchPad());
     } else if (rtPrecision == ov::element::f16) {
-        m_executor = std::make_shared<Executor<ov::float16>>(this, m_mlp_config, context->getScratchPad());
+        m_executor = std::make_shared<Executor<ov::float16>>(this, m_mlp_config, getScratchPad());
     }
 #endif
     if (!m_executor) {
@@ -30,6 +30,10 @@ public:
         return getType() == Type::LoRA;
     }
 
+    bool canBeExecutedConcurrently() const override {
+        return false;
+    }
+
     void getSupportedDescriptors() override {};
     void selectOptimalPrimitiveDescriptor() override;
     int registerToAllocationContext(int offset, AllocationContext& context) override;
@@ -81,6 +81,9 @@ public:
 
     bool isExecutable() const override final;
     bool neverExecute() const override final;
+    bool canBeExecutedConcurrently() const override final {
+        return false;
+    }
 
     void registerInputNode(MemoryInputBase* node);
     void deregisterSibling(MemoryInputBase* node);
@@ -164,6 +167,9 @@ public:
     }
     bool neverExecute() const override final;
     bool isExecutable() const override final;
+    bool canBeExecutedConcurrently() const override final {
+        return false;
+    }
 
     void registerOutputNode(MemoryOutputBase* node);
     void deregisterSibling(MemoryOutputBase* node);
@@ -39,6 +39,11 @@ public:
         return !isInputTensorAtPortEmpty(0) && !isInputTensorAtPortEmpty(1) && !isInputTensorAtPortEmpty(2);
     }
 
+    // writes to the kv cache inputs
+    bool canBeExecutedConcurrently() const override {
+        return false;
+    }
+
     bool needPrepareParams() const override {
         return false;
     }
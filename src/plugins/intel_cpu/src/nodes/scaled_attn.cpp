@@ -19,6 +19,7 @@
 #include "cpu_memory.h"
 #include "dnnl_extension_utils.h"
 #include "graph_context.h"
+#include "kv_cache_memory.hpp"
 #include "memory_desc/cpu_memory_desc.h"
 #include "memory_desc/cpu_memory_desc_utils.h"
 #include "memory_desc/dnnl_blocked_memory_desc.h"
@@ -1352,6 +1353,11 @@ void ScaledDotProductAttention::execute(const dnnl::stream& strm) {
     PlainTensor v_scale_zp;
     if (m_config.config.fuse_concat) {
         CPU_NODE_ASSERT(m_k_state && m_v_state, "has null input states");
+        if (const auto& kvCacheMemory = context->getKVCacheMemory()) {
+            // the past tokens spilled to the disk are read while the current ones are concatenated
+            kvCacheMemory->prefetch(m_k_state->internal_state_mem());
+            kvCacheMemory->prefetch(m_v_state->internal_state_mem());
+        }
         // initialization will be also completed in this func
         gatherConcatPastkv(inputs[1], inputs[2], getSrcMemoryAtPort(orginSDPInputNumber));
 
@@ -1443,6 +1449,13 @@ std::vector<T> permute_axes(const std::vector<T>& shape, const std::vector<size_
     return results;
 }
 
+MemoryPtr ScaledDotProductAttention::newKVCacheMemory(const MemoryDescPtr& desc) const {
+    if (const auto& kvCacheMemory = context->getKVCacheMemory()) {
+        return kvCacheMemory->allocate(desc, getEngine());
+    }
+    return std::make_shared<Memory>(getEngine(), desc);
+}
+
 void ScaledDotProductAttention::resetBeamTablePastkv(const MemoryPtr& mem_cur_k,
                                                      const MemoryPtr& mem_cur_v,
                                                      const MemoryPtr& mem_beam_idx) {
@@ -1506,13 +1519,13 @@ void ScaledDotProductAttention::resetBeamTablePastkv(const MemoryPtr& mem_cur_k,
                                                                  Shape(shape),
                                                                  permute_axes(shape, real_order),
                                                                  real_order);
-        auto new_internal_mem_k = std::make_shared<Memory>(getEngine(), mem_desc_k);
+        auto new_internal_mem_k = newKVCacheMemory(mem_desc_k);
         shape = reverse({B, H, (L0 + L1) * 2, SV});
         auto mem_desc_v = std::make_shared<CpuBlockedMemoryDesc>(kvcache_precision,
                                                                  Shape(shape),
                                                                  permute_axes(shape, real_order),
                                                                  real_order);
-        auto new_internal_mem_v = std::make_shared<Memory>(getEngine(), mem_desc_v);
+        auto new_internal_mem_v = newKVCacheMemory(mem_desc_v);
 
         PlainTensor new_pastk;
         PlainTensor new_pastv;
@@ -1739,7 +1752,9 @@ void ScaledDotProductAttention::updateBeamTable(const MemoryPtr& mem_beam_idx, s
     CPU_NODE_ASSERT(B * (L0 + L1) > 0, "B or (L0+L1) is zero, B: ", B, ", L0: ", L0, ", L1: ", L1);
     // resize buffer
     bool need_redefine = true;
-    if (B * (L0 + L1) > m_k_state->hidden_state_max_size()) {
+    // the max size of a state is zero while its memory is shared with a snapshot, so both states are checked to copy
+    // the shared memory before the write
+    if (B * (L0 + L1) > std::min(m_k_state->hidden_state_max_size(), m_v_state->hidden_state_max_size())) {
         auto mem_desc = std::make_shared<CpuBlockedMemoryDesc>(ov::element::i32, Shape{B, (L0 + L1) * 2});
 
         auto new_hidden_state_k = std::make_shared<Memory>(getEngine(), mem_desc);
@@ -1892,7 +1907,10 @@ void ScaledDotProductAttention::updatePastkv(const MemoryPtr& mem_cur_k, const M
     // resize buffer
     ov::element::Type kvcache_precision = m_k_state->internal_desc()->getPrecision();
     bool need_redefine = true;
-    if (B * H * (L0 + L1) * S > m_k_state->internal_state_max_size()) {
+    // the max size of a state is zero while its memory is shared with a snapshot, so both states are checked to copy
+    // the shared memory before the write
+    if (B * H * (L0 + L1) * S > m_k_state->internal_state_max_size() ||
+        B * H * (L0 + L1) * SV > m_v_state->internal_state_max_size()) {
         // new_shape is the shape used by the original model which maybe different from BHLS, reverse here is to permute
         // BHLS to original model shape. BHLS is the stated input shape of SDPA, however internally we use LBHS for
         // KV-cache storage. real_order is used to permute the original shape to LBHS
@@ -1901,7 +1919,7 @@ void ScaledDotProductAttention::updatePastkv(const MemoryPtr& mem_cur_k, const M
             auto real_shape = permute_axes(new_shape, real_order);
             auto mem_desc =
                 std::make_shared<CpuBlockedMemoryDesc>(kvcache_precision, Shape(new_shape), real_shape, real_order);
-            return std::make_shared<Memory>(getEngine(), mem_desc);
+            return newKVCacheMemory(mem_desc);
         };
 
         auto new_internal_mem_k = new_memory(S);
@@ -40,6 +40,10 @@ public:
     bool isExecutable() const override {
         return !isInputTensorAtPortEmpty(0) && !isInputTensorAtPortEmpty(1) && !isInputTensorAtPortEmpty(2);
     }
+    // updates the kv cache state
+    bool canBeExecutedConcurrently() const override {
+        return false;
+    }
     bool needPrepareParams() const override {
         return false;
     }
@@ -76,6 +80,8 @@ private:
     void gatherConcatPastkv(const MemoryPtr& mem_cur_k, const MemoryPtr& mem_cur_v, const MemoryPtr& mem_beam_idx);
     void updateBeamTable(const MemoryPtr& mem_beam_idx, size_t L1);
     void updatePastkv(const MemoryPtr& mem_cur_k, const MemoryPtr& mem_cur_v);
+    // allocates the KV cache buffer within the memory budget of the compiled model if any
+    MemoryPtr newKVCacheMemory(const MemoryDescPtr& desc) const;
     ov::element::Type getRuntimePrecision() const override;
     void resetBeamTablePastkv(const MemoryPtr& mem_cur_k, const MemoryPtr& mem_cur_v, const MemoryPtr& mem_beam_idx);
 
@@ -128,6 +128,9 @@ public:
     bool isExecutable() const override {
         return true;
     }
+    bool canBeExecutedConcurrently() const override {
+        return false;
+    }
     // @todo limit to particular in / out ports
     static bool usesInOutMemoryMultipleTimes() {
         return true;
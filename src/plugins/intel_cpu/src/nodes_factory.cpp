@@ -37,6 +37,7 @@
 #include "nodes/extract_image_patches.h"
 #include "nodes/eye.h"
 #include "nodes/fullyconnected.h"
+#include "nodes/fused_preprocess.h"
 #include "nodes/gather.h"
 #include "nodes/gather_elements.h"
 #include "nodes/gather_nd.h"
@@ -237,6 +238,7 @@ Node::NodesFactory::NodesFactory() : Factory("NodesFactory") {
     INTEL_CPU_NODE(SearchSorted, Type::SearchSorted);
     INTEL_CPU_NODE(SegmentMax, Type::SegmentMax);
     INTEL_CPU_NODE(LoRA, Type::LoRA);
+    INTEL_CPU_NODE(FusedPreprocess, Type::FusedPreprocess);
 #if defined(OPENVINO_ARCH_X86_64)
     INTEL_CPU_NODE(FakeQuantize, Type::FakeQuantize);
     INTEL_CPU_NODE(GridSample, Type::GridSample);
@@ -0,0 +1,93 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "packed_weights.hpp"
+
+#include <common/primitive_hashing_utils.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "cpu_memory.h"
+#include "memory_desc/dnnl_memory_desc.h"
+
+namespace ov::intel_cpu {
+
+void PackedWeights::registerSource(const void* data, const std::string& name) {
+    if (data == nullptr) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    // in-place consumers share the memory with the producer, the first (producer) name is kept
+    if (!m_sources.emplace(data, name).second) {
+        return;
+    }
+    // the same name of different constants (e.g. in the different subgraph bodies) can't identify the weights
+    if (!m_names.emplace(name, data).second) {
+        m_ambiguousNames.insert(name);
+    }
+}
+
+std::optional<size_t> PackedWeights::getKey(const void* srcData, const DnnlMemoryDescPtr& dstDesc) const {
+    std::string name;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_sources.find(srcData);
+        if (it == m_sources.end() || m_ambiguousNames.count(it->second)) {
+            return std::nullopt;
+        }
+        name = it->second;
+    }
+    const auto descHash = dnnl::impl::primitive_hashing::get_md_hash(*dstDesc->getDnnlDesc().get());
+    return std::hash<std::string>{}(name + "_" + std::to_string(descHash));
+}
+
+MemoryPtr PackedWeights::find(size_t key, const DnnlMemoryDescPtr& dstDesc, const dnnl::engine& eng) const {
+    if (!m_blob) {
+        return nullptr;
+    }
+    auto it = m_blob->entries.find(key);
+    if (it == m_blob->entries.end() || it->second.size != dstDesc->getCurrentMemSize()) {
+        m_repacked++;
+        return nullptr;
+    }
+    const auto& entry = it->second;
+    // the blob read into memory (not mmapped) does not guarantee the alignment expected by the kernels
+    constexpr size_t kernelsAlignment = 64;
+    if (reinterpret_cast<uintptr_t>(entry.data) % kernelsAlignment == 0) {
+        m_inPlace++;
+        return std::make_shared<Memory>(eng, dstDesc, entry.data, false);
+    }
+    m_copied++;
+    auto memory = std::make_shared<Memory>(eng, dstDesc);
+    std::memcpy(memory->getData(), entry.data, entry.size);
+    return memory;
+}
+
+void PackedWeights::record(size_t key, const MemoryCPtr& memory) {
+    if (!m_recordEnabled) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_recorded.emplace(key, memory);
+}
+
+std::vector<std::pair<size_t, MemoryCPtr>> PackedWeights::getRecorded() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return {m_recorded.begin(), m_recorded.end()};
+}
+
+PackedWeights::Statistics PackedWeights::getStatistics() const {
+    return {m_inPlace.load(), m_copied.load(), m_repacked.load()};
+}
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,102 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "cpu_memory.h"
+#include "memory_desc/dnnl_memory_desc.h"
+#include "openvino/runtime/aligned_buffer.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Weights repacked into the kernels layout, restored from the model cache blob.
+ * The data is referenced in place, so an mmapped blob shares one physical copy of the packed weights
+ * between all the processes importing it.
+ */
+struct PackedWeightsBlob {
+    using CPtr = std::shared_ptr<const PackedWeightsBlob>;
+
+    // the packed weights area and every packed tensor inside it start at the page boundary of the blob file
+    static constexpr size_t alignment = 4096;
+
+    struct Entry {
+        const uint8_t* data = nullptr;
+        size_t size = 0;
+    };
+
+    // keeps the blob data alive
+    std::shared_ptr<ov::AlignedBuffer> buffer;
+    std::unordered_map<size_t, Entry> entries;
+};
+
+/**
+ * @brief Per graph registry of the packed weights.
+ * The packed weights are identified by the constant node producing the source weights and by the packed memory
+ * descriptor, so the identity is stable across the processes in contrast to the weights cache keys.
+ * Records the packed weights to be stored in the model cache blob and supplies the ones restored from it.
+ */
+class PackedWeights {
+public:
+    using Ptr = std::shared_ptr<PackedWeights>;
+
+    struct Statistics {
+        // the packed weights restored from the blob: used in place, copied because of the alignment, not found
+        uint64_t inPlace = 0;
+        uint64_t copied = 0;
+        uint64_t repacked = 0;
+    };
+
+    PackedWeights(PackedWeightsBlob::CPtr blob, bool recordEnabled)
+        : m_blob(std::move(blob)),
+          m_recordEnabled(recordEnabled) {}
+
+    /**
+     * @brief Registers the constant output memory which may be a source of the packed weights
+     * @param data pointer to the constant data
+     * @param name identifier of the constant output, unique within the graph
+     */
+    void registerSource(const void* data, const std::string& name);
+
+    /**
+     * @brief Returns the key of the packed weights or nullopt if the source data is not a registered constant
+     */
+    [[nodiscard]] std::optional<size_t> getKey(const void* srcData, const DnnlMemoryDescPtr& dstDesc) const;
+
+    /**
+     * @brief Returns the memory referencing the packed weights restored from the blob or nullptr if there are none
+     */
+    [[nodiscard]] MemoryPtr find(size_t key, const DnnlMemoryDescPtr& dstDesc, const dnnl::engine& eng) const;
+
+    void record(size_t key, const MemoryCPtr& memory);
+
+    [[nodiscard]] std::vector<std::pair<size_t, MemoryCPtr>> getRecorded() const;
+
+    [[nodiscard]] Statistics getStatistics() const;
+
+private:
+    PackedWeightsBlob::CPtr m_blob;
+    bool m_recordEnabled;
+    mutable std::mutex m_mutex;
+    std::unordered_map<const void*, std::string> m_sources;
+    std::unordered_map<std::string, const void*> m_names;
+    std::unordered_set<std::string> m_ambiguousNames;
+    std::unordered_map<size_t, MemoryCPtr> m_recorded;
+    mutable std::atomic<uint64_t> m_inPlace{0};
+    mutable std::atomic<uint64_t> m_copied{0};
+    mutable std::atomic<uint64_t> m_repacked{0};
+};
+
+}  // namespace ov::intel_cpu
@@ -5,9 +5,12 @@
 #pragma once
 
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <ratio>
 
+#include "utils/hw_perf_counters.h"
+
 namespace ov::intel_cpu {
 
 class PerfCount {
@@ -17,6 +20,12 @@ class PerfCount {
     std::chrono::high_resolution_clock::time_point _start;
     std::chrono::high_resolution_clock::time_point _finish;
 
+    // not null if the hardware events are counted as well
+    const HwPerfCounters* hw_counters = nullptr;
+    HwEventValues hw_total{};
+    HwEventValues hw_start{};
+    HwEventValues hw_last{};
+
 public:
     PerfCount() = default;
 
@@ -31,8 +40,24 @@ public:
         return num;
     }
 
+    [[nodiscard]] const HwPerfCounters* hw() const {
+        return hw_counters;
+    }
+    // the hardware events of the last iteration
+    [[nodiscard]] const HwEventValues& hw_last_itr() const {
+        return hw_last;
+    }
+    // the hardware events of all the iterations
+    [[nodiscard]] const HwEventValues& hw_sum() const {
+        return hw_total;
+    }
+
 private:
-    void start_itr() {
+    void start_itr(const HwPerfCounters* hw) {
+        hw_counters = hw;
+        if (hw_counters) {
+            hw_start = hw_counters->read();
+        }
         _start = std::chrono::high_resolution_clock::now();
     }
 
@@ -40,6 +65,14 @@ private:
         _finish = std::chrono::high_resolution_clock::now();
         total_duration += std::chrono::duration_cast<std::chrono::microseconds>(_finish - _start).count();
         num++;
+        if (hw_counters) {
+            const auto hw_finish = hw_counters->read();
+            for (size_t i = 0; i < hw_last.size(); i++) {
+                // the multiplexed events are extrapolated, so the difference may be negative
+                hw_last[i] = hw_finish[i] > hw_start[i] ? hw_finish[i] - hw_start[i] : 0;
+                hw_total[i] += hw_last[i];
+            }
+        }
     }
 
     friend class PerfHelper;
@@ -49,8 +82,8 @@ class PerfHelper {
     PerfCount& counter;
 
 public:
-    explicit PerfHelper(PerfCount& count) : counter(count) {
-        counter.start_itr();
+    explicit PerfHelper(PerfCount& count, const HwPerfCounters* hw = nullptr) : counter(count) {
+        counter.start_itr(hw);
     }
 
     ~PerfHelper() {
@@ -62,3 +95,5 @@ public:
 
 #define GET_PERF(_node)    std::unique_ptr<PerfHelper>(new PerfHelper((_node)->PerfCounter()))
 #define PERF(_node, _need) auto pc = (_need) ? GET_PERF(_node) : nullptr;
+#define PERF_HW(_node, _need, _hw) \
+    auto pc = (_need) ? std::unique_ptr<PerfHelper>(new PerfHelper((_node)->PerfCounter(), (_hw))) : nullptr;
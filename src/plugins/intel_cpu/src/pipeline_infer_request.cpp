@@ -0,0 +1,199 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "pipeline_infer_request.h"
+
+#include <cstddef>
+#include <exception>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "compiled_model.h"
+#include "openvino/core/except.hpp"
+#include "openvino/runtime/iasync_infer_request.hpp"
+#include "openvino/runtime/isync_infer_request.hpp"
+#include "openvino/runtime/itensor.hpp"
+#include "openvino/runtime/make_tensor.hpp"
+#include "openvino/runtime/threading/itask_executor.hpp"
+#include "pipeline_stages.hpp"
+
+namespace ov::intel_cpu {
+
+PipelineSyncInferRequest::PipelineSyncInferRequest(const std::shared_ptr<const CompiledModel>& compiled_model)
+    : ov::ISyncInferRequest(compiled_model) {
+    const auto& stages = compiled_model->m_pipeline_stages;
+    for (const auto& stage_model : compiled_model->m_sub_compiled_models) {
+        m_stage_requests.push_back(stage_model->create_infer_request());
+    }
+
+    m_input_to_stage_inputs.resize(compiled_model->inputs().size());
+    std::map<ov::Output<const ov::Node>, ov::SoPtr<ov::ITensor>> activations;
+    for (size_t stage = 0; stage < stages.inputs.size(); stage++) {
+        const auto& stage_inputs = m_stage_requests[stage]->get_compiled_model()->inputs();
+        for (size_t i = 0; i < stages.inputs[stage].size(); i++) {
+            const auto& source = stages.inputs[stage][i];
+            if (source.stage < 0) {
+                m_input_to_stage_inputs[source.index].emplace_back(stage, i);
+                continue;
+            }
+            // the activations are passed to the later stage without copies through a tensor owned by the request
+            const auto& source_request = m_stage_requests[source.stage];
+            const auto& source_port = source_request->get_compiled_model()->outputs()[source.index];
+            auto& tensor = activations[source_port];
+            if (!tensor) {
+                tensor = {ov::make_tensor(source_port.get_element_type(), source_port.get_shape()), nullptr};
+                source_request->set_tensor(source_port, tensor);
+            }
+            m_stage_requests[stage]->set_tensor(stage_inputs[i], tensor);
+        }
+    }
+    // an input consumed by several stages is held by one tensor, so the data set through get_tensor reaches all of them
+    for (const auto& stage_inputs : m_input_to_stage_inputs) {
+        if (stage_inputs.size() < 2) {
+            continue;
+        }
+        const auto& [first_stage, first_index] = stage_inputs.front();
+        const auto& first_port = m_stage_requests[first_stage]->get_compiled_model()->inputs()[first_index];
+        const ov::SoPtr<ov::ITensor> tensor = {ov::make_tensor(first_port.get_element_type(), first_port.get_shape()),
+                                               nullptr};
+        for (const auto& [stage, index] : stage_inputs) {
+            m_stage_requests[stage]->set_tensor(m_stage_requests[stage]->get_compiled_model()->inputs()[index], tensor);
+        }
+    }
+    for (const auto& output : stages.outputs) {
+        m_output_to_stage_output.emplace_back(output.stage, output.index);
+    }
+}
+
+std::vector<std::pair<size_t, ov::Output<const ov::Node>>> PipelineSyncInferRequest::get_stage_ports(
+    const ov::Output<const ov::Node>& port) const {
+    auto found_port = find_port(port);
+    OPENVINO_ASSERT(found_port.found(), "Cannot find infer request for port ", port);
+    std::vector<std::pair<size_t, ov::Output<const ov::Node>>> stage_ports;
+    if (found_port.is_input()) {
+        for (const auto& [stage, index] : m_input_to_stage_inputs[found_port.idx]) {
+            stage_ports.emplace_back(stage, m_stage_requests[stage]->get_compiled_model()->inputs()[index]);
+        }
+    } else {
+        const auto& [stage, index] = m_output_to_stage_output[found_port.idx];
+        stage_ports.emplace_back(stage, m_stage_requests[stage]->get_compiled_model()->outputs()[index]);
+    }
+    return stage_ports;
+}
+
+ov::SoPtr<ov::ITensor> PipelineSyncInferRequest::get_tensor(const ov::Output<const ov::Node>& port) const {
+    const auto stage_ports = get_stage_ports(port);
+    const auto& [stage, stage_port] = stage_ports.front();
+    return m_stage_requests[stage]->get_tensor(stage_port);
+}
+
+void PipelineSyncInferRequest::set_tensor(const ov::Output<const ov::Node>& port,
+                                          const ov::SoPtr<ov::ITensor>& tensor) {
+    for (const auto& [stage, stage_port] : get_stage_ports(port)) {
+        m_stage_requests[stage]->set_tensor(stage_port, tensor);
+    }
+}
+
+std::vector<ov::SoPtr<ov::ITensor>> PipelineSyncInferRequest::get_tensors(
+    const ov::Output<const ov::Node>& port) const {
+    const auto stage_ports = get_stage_ports(port);
+    const auto& [stage, stage_port] = stage_ports.front();
+    return m_stage_requests[stage]->get_tensors(stage_port);
+}
+
+void PipelineSyncInferRequest::set_tensors(const ov::Output<const ov::Node>& port,
+                                           const std::vector<ov::SoPtr<ov::ITensor>>& tensors) {
+    for (const auto& [stage, stage_port] : get_stage_ports(port)) {
+        m_stage_requests[stage]->set_tensors(stage_port, tensors);
+    }
+}
+
+void PipelineSyncInferRequest::check_tensors() const {
+    // the tensors are owned and checked by the stage requests
+}
+
+std::vector<ov::SoPtr<ov::IVariableState>> PipelineSyncInferRequest::query_state() const {
+    std::vector<ov::SoPtr<ov::IVariableState>> states;
+    for (const auto& request : m_stage_requests) {
+        for (auto&& state : request->query_state()) {
+            states.emplace_back(state);
+        }
+    }
+    return states;
+}
+
+void PipelineSyncInferRequest::infer() {
+    for (const auto& request : m_stage_requests) {
+        request->infer();
+    }
+}
+
+std::vector<ov::ProfilingInfo> PipelineSyncInferRequest::get_profiling_info() const {
+    std::vector<ov::ProfilingInfo> info;
+    for (size_t i = 0; i < m_stage_requests.size(); ++i) {
+        auto stage_info = m_stage_requests[i]->get_profiling_info();
+        for (auto&& record : stage_info) {
+            record.node_name = "stage" + std::to_string(i) + ": " + record.node_name;
+        }
+        info.insert(info.end(), stage_info.begin(), stage_info.end());
+    }
+    return info;
+}
+
+namespace {
+
+// starts the stage request on its own streams executor and continues the pipeline from its callback
+struct StageExecutor : public ov::threading::ITaskExecutor {
+    explicit StageExecutor(std::shared_ptr<ov::IAsyncInferRequest> request) : m_request(std::move(request)) {
+        m_request->set_callback([this](std::exception_ptr exception) {
+            m_exception = std::move(exception);
+            auto task = std::move(m_task);
+            task();
+        });
+    }
+
+    void run(ov::threading::Task task) override {
+        m_task = std::move(task);
+        m_request->start_async();
+    }
+
+    std::shared_ptr<ov::IAsyncInferRequest> m_request;
+    std::exception_ptr m_exception;
+    ov::threading::Task m_task;
+};
+
+}  // namespace
+
+PipelineAsyncInferRequest::PipelineAsyncInferRequest(
+    const std::shared_ptr<PipelineSyncInferRequest>& request,
+    const std::shared_ptr<ov::threading::ITaskExecutor>& task_executor,
+    const std::shared_ptr<ov::threading::ITaskExecutor>& callback_executor)
+    : ov::IAsyncInferRequest(request, task_executor, callback_executor),
+      m_request(request) {
+    m_pipeline.clear();
+    for (const auto& stage_request : m_request->get_stage_requests()) {
+        auto stage_executor = std::make_shared<StageExecutor>(stage_request);
+        m_pipeline.emplace_back(stage_executor, [stage_executor] {
+            if (stage_executor->m_exception) {
+                std::rethrow_exception(stage_executor->m_exception);
+            }
+        });
+    }
+}
+
+PipelineAsyncInferRequest::~PipelineAsyncInferRequest() {
+    ov::IAsyncInferRequest::stop_and_wait();
+}
+
+void PipelineAsyncInferRequest::cancel() {
+    ov::IAsyncInferRequest::cancel();
+    for (const auto& stage_request : m_request->get_stage_requests()) {
+        stage_request->cancel();
+    }
+}
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,84 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "openvino/runtime/iasync_infer_request.hpp"
+#include "openvino/runtime/isync_infer_request.hpp"
+#include "openvino/runtime/itensor.hpp"
+#include "openvino/runtime/ivariable_state.hpp"
+#include "openvino/runtime/profiling_info.hpp"
+#include "openvino/runtime/so_ptr.hpp"
+#include "openvino/runtime/threading/itask_executor.hpp"
+
+namespace ov::intel_cpu {
+
+class CompiledModel;
+
+/**
+ * @brief Infer request of a compiled model cut into the pipeline stages
+ * (see ov::hint::ModelDistributionPolicy::PIPELINE_PARALLEL).
+ * Keeps one request per stage, the stage outputs are bound to the inputs of the later stages without copies.
+ */
+class PipelineSyncInferRequest : public ov::ISyncInferRequest {
+public:
+    explicit PipelineSyncInferRequest(const std::shared_ptr<const CompiledModel>& compiled_model);
+
+    void infer() override;
+
+    std::vector<ov::SoPtr<ov::IVariableState>> query_state() const override;
+
+    std::vector<ov::ProfilingInfo> get_profiling_info() const override;
+
+    ov::SoPtr<ov::ITensor> get_tensor(const ov::Output<const ov::Node>& port) const override;
+
+    void set_tensor(const ov::Output<const ov::Node>& port, const ov::SoPtr<ov::ITensor>& tensor) override;
+
+    std::vector<ov::SoPtr<ov::ITensor>> get_tensors(const ov::Output<const ov::Node>& port) const override;
+
+    void set_tensors(const ov::Output<const ov::Node>& port,
+                     const std::vector<ov::SoPtr<ov::ITensor>>& tensors) override;
+
+    void check_tensors() const override;
+
+    const std::vector<std::shared_ptr<ov::IAsyncInferRequest>>& get_stage_requests() const {
+        return m_stage_requests;
+    }
+
+private:
+    // the stage requests and their ports bound to the given port of the compiled model
+    std::vector<std::pair<size_t, ov::Output<const ov::Node>>> get_stage_ports(
+        const ov::Output<const ov::Node>& port) const;
+
+    std::vector<std::shared_ptr<ov::IAsyncInferRequest>> m_stage_requests;
+    // every model input may be consumed by several stages
+    std::vector<std::vector<std::pair<size_t, size_t>>> m_input_to_stage_inputs;
+    std::vector<std::pair<size_t, size_t>> m_output_to_stage_output;
+};
+
+/**
+ * @brief Runs every stage of the request on the streams executor of the stage.
+ * A request moves to the next stage as soon as the current one is done, so the consecutive requests occupy the
+ * different stages at the same time. The activations passed between the stages are held by the request itself,
+ * so the queue in front of every stage is bounded by the number of the requests in flight.
+ */
+class PipelineAsyncInferRequest : public ov::IAsyncInferRequest {
+public:
+    PipelineAsyncInferRequest(const std::shared_ptr<PipelineSyncInferRequest>& request,
+                              const std::shared_ptr<ov::threading::ITaskExecutor>& task_executor,
+                              const std::shared_ptr<ov::threading::ITaskExecutor>& callback_executor);
+    ~PipelineAsyncInferRequest() override;
+
+    void cancel() override;
+
+private:
+    std::shared_ptr<PipelineSyncInferRequest> m_request;
+};
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,249 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "pipeline_stages.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+#include "openvino/core/model.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/node_output.hpp"
+#include "openvino/core/type.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/result.hpp"
+
+namespace ov::intel_cpu {
+
+bool canBePipelined(const ov::Model& model) {
+    return !model.is_dynamic() && model.get_sinks().empty() && model.get_variables().empty();
+}
+
+PipelineStages splitIntoPipelineStages(const std::shared_ptr<const ov::Model>& model, size_t numStages) {
+    OPENVINO_ASSERT(canBePipelined(*model), "Model ", model->get_friendly_name(), " can not be pipelined");
+    numStages = std::max<size_t>(numStages, 1);
+
+    // the stages are cut from a copy, since the edges crossing the stages are replaced with the parameters
+    const auto clone = model->clone();
+    const auto orderedOps = clone->get_ordered_ops();
+
+    // the ops computed from the constants only, they are placed into the stages consuming them
+    std::unordered_set<const ov::Node*> constantPath;
+    for (const auto& op : orderedOps) {
+        if (ov::is_type<ov::op::v0::Constant>(op) ||
+            (op->get_input_size() > 0 && !ov::is_type<ov::op::v0::Result>(op) &&
+             std::all_of(op->input_values().begin(), op->input_values().end(), [&](const ov::Output<ov::Node>& input) {
+                 return constantPath.count(input.get_node()) > 0;
+             }))) {
+            constantPath.insert(op.get());
+        }
+    }
+
+    auto isComputational = [&](const std::shared_ptr<ov::Node>& op) {
+        return !constantPath.count(op.get()) && !ov::is_type<ov::op::v0::Parameter>(op) &&
+               !ov::is_type<ov::op::v0::Result>(op);
+    };
+
+    // the weights of the constant path are attributed to the first op consuming them
+    std::unordered_set<const ov::Node*> countedConstants;
+    auto collectWeights = [&](const std::shared_ptr<ov::Node>& op) {
+        size_t size = 0;
+        std::vector<ov::Node*> toVisit;
+        for (const auto& input : op->input_values()) {
+            toVisit.push_back(input.get_node());
+        }
+        while (!toVisit.empty()) {
+            auto* node = toVisit.back();
+            toVisit.pop_back();
+            if (!constantPath.count(node) || !countedConstants.insert(node).second) {
+                continue;
+            }
+            if (const auto* constant = ov::as_type<ov::op::v0::Constant>(node)) {
+                size += constant->get_byte_size();
+            }
+            for (const auto& input : node->input_values()) {
+                toVisit.push_back(input.get_node());
+            }
+        }
+        return size;
+    };
+
+    std::vector<std::pair<ov::Node*, size_t>> weights;
+    size_t totalWeights = 0;
+    for (const auto& op : orderedOps) {
+        if (isComputational(op)) {
+            weights.emplace_back(op.get(), collectWeights(op));
+            totalWeights += weights.back().second;
+        }
+    }
+    // fall back to the number of ops for the models without weights
+    if (totalWeights == 0) {
+        for (auto& weight : weights) {
+            weight.second = 1;
+        }
+        totalWeights = weights.size();
+    }
+
+    // the topological order makes the stage of a consumer not less than the stage of its producers
+    std::unordered_map<const ov::Node*, size_t> stageOf;
+    size_t accumulated = 0;
+    for (const auto& [op, size] : weights) {
+        const auto middle = accumulated + size / 2;
+        stageOf[op] = std::min(numStages - 1, middle * numStages / totalWeights);
+        accumulated += size;
+    }
+    for (const auto& result : clone->get_results()) {
+        const auto* producer = result->get_input_node_ptr(0);
+        stageOf[result.get()] = stageOf.count(producer) ? stageOf[producer] : numStages - 1;
+    }
+    // the parameters and the constant path go to the first stage consuming them
+    for (auto it = orderedOps.rbegin(); it != orderedOps.rend(); ++it) {
+        const auto& op = *it;
+        if (stageOf.count(op.get())) {
+            continue;
+        }
+        size_t stage = numStages;
+        for (const auto& output : op->outputs()) {
+            for (const auto& target : output.get_target_inputs()) {
+                const auto consumer = stageOf.find(target.get_node());
+                if (consumer != stageOf.end()) {
+                    stage = std::min(stage, consumer->second);
+                }
+            }
+        }
+        stageOf[op.get()] = stage == numStages ? 0 : stage;
+    }
+    for (const auto& parameter : clone->get_parameters()) {
+        if (!stageOf.count(parameter.get())) {
+            stageOf[parameter.get()] = 0;
+        }
+    }
+
+    std::vector<ov::ParameterVector> stageParameters(numStages);
+    std::vector<ov::ResultVector> stageResults(numStages);
+    std::vector<std::vector<PipelineStages::Port>> stageInputs(numStages);
+    std::vector<PipelineStages::Port> outputs;
+
+    std::unordered_map<const ov::Node*, size_t> parameterIndex;
+    for (const auto& parameter : clone->get_parameters()) {
+        const auto index = parameterIndex.size();
+        parameterIndex[parameter.get()] = index;
+        const auto stage = stageOf[parameter.get()];
+        stageParameters[stage].push_back(parameter);
+        stageInputs[stage].push_back({-1, index});
+    }
+    for (const auto& result : clone->get_results()) {
+        const auto stage = stageOf[result.get()];
+        outputs.push_back({static_cast<int>(stage), stageResults[stage].size()});
+        stageResults[stage].push_back(result);
+    }
+
+    // the cross stage outputs, shared by all the later stages consuming them
+    std::map<ov::Output<ov::Node>, size_t> stageOutputs;
+    std::map<std::pair<ov::Output<ov::Node>, size_t>, ov::Output<ov::Node>> stageCopies;
+
+    auto getStageOutput = [&](const ov::Output<ov::Node>& source, size_t stage) {
+        auto it = stageOutputs.find(source);
+        if (it == stageOutputs.end()) {
+            auto result = std::make_shared<ov::op::v0::Result>(source);
+            result->set_friendly_name(source.get_node()->get_friendly_name() + "/pipeline_output_" +
+                                      std::to_string(source.get_index()));
+            it = stageOutputs.emplace(source, stageResults[stage].size()).first;
+            stageResults[stage].push_back(result);
+        }
+        return it->second;
+    };
+
+    auto getStageCopy = [&](const ov::Output<ov::Node>& source, size_t stage) {
+        auto it = stageCopies.find({source, stage});
+        if (it != stageCopies.end()) {
+            return it->second;
+        }
+        ov::Output<ov::Node> copy;
+        const auto producer = source.get_node_shared_ptr();
+        const auto producerStage = stageOf[producer.get()];
+        if (ov::is_type<ov::op::v0::Constant>(producer)) {
+            // the constant data is shared, it is repacked into the stage local memory on the compilation
+            copy = producer->clone_with_new_inputs({})->output(source.get_index());
+        } else {
+            auto parameter =
+                std::make_shared<ov::op::v0::Parameter>(source.get_element_type(), source.get_partial_shape());
+            parameter->set_friendly_name(producer->get_friendly_name() + "/pipeline_input_" +
+                                         std::to_string(source.get_index()));
+            if (ov::is_type<ov::op::v0::Parameter>(producer)) {
+                stageInputs[stage].push_back({-1, parameterIndex[producer.get()]});
+            } else {
+                stageInputs[stage].push_back(
+                    {static_cast<int>(producerStage), getStageOutput(source, producerStage)});
+            }
+            stageParameters[stage].push_back(parameter);
+            copy = parameter->output(0);
+        }
+        stageCopies.emplace(std::make_pair(source, stage), copy);
+        return copy;
+    };
+
+    for (const auto& op : orderedOps) {
+        const auto stage = stageOf[op.get()];
+        for (auto& input : op->inputs()) {
+            const auto source = input.get_source_output();
+            if (stageOf[source.get_node()] != stage) {
+                input.replace_source_output(getStageCopy(source, stage));
+            }
+        }
+    }
+
+    // drop the empty stages, a stage without outputs may only keep the unused inputs of the model
+    const auto firstStage = static_cast<size_t>(
+        std::find_if(stageResults.begin(), stageResults.end(), [](const ov::ResultVector& results) {
+            return !results.empty();
+        }) - stageResults.begin());
+    OPENVINO_ASSERT(firstStage < numStages, "Model ", model->get_friendly_name(), " has no outputs");
+    for (size_t stage = 0; stage < numStages; stage++) {
+        if (stageResults[stage].empty() && stage != firstStage) {
+            for (size_t i = 0; i < stageParameters[stage].size(); i++) {
+                stageParameters[firstStage].push_back(stageParameters[stage][i]);
+                stageInputs[firstStage].push_back(stageInputs[stage][i]);
+            }
+        }
+    }
+
+    PipelineStages stages;
+    std::vector<int> stageIndex(numStages, -1);
+    for (size_t stage = 0; stage < numStages; stage++) {
+        if (stageResults[stage].empty()) {
+            continue;
+        }
+        stageIndex[stage] = static_cast<int>(stages.models.size());
+        stages.models.push_back(std::make_shared<ov::Model>(stageResults[stage],
+                                                            stageParameters[stage],
+                                                            model->get_friendly_name() + "_stage" +
+                                                                std::to_string(stages.models.size())));
+        stages.inputs.push_back(std::move(stageInputs[stage]));
+    }
+    for (auto& inputs : stages.inputs) {
+        for (auto& input : inputs) {
+            if (input.stage >= 0) {
+                input.stage = stageIndex[input.stage];
+            }
+        }
+    }
+    for (auto& output : outputs) {
+        output.stage = stageIndex[output.stage];
+    }
+    stages.outputs = std::move(outputs);
+
+    return stages;
+}
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,47 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "openvino/core/model.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief A model cut into the consecutive stages of a pipeline (see ov::hint::ModelDistributionPolicy::PIPELINE_PARALLEL).
+ * The data flows from a stage to the later ones only, so the stages of one request are executed in order,
+ * while the consecutive requests occupy the different stages at the same time.
+ */
+struct PipelineStages {
+    // a stage input source or a model output location
+    struct Port {
+        int stage = -1;    // -1 stands for the inputs of the original model
+        size_t index = 0;  // the input index of the original model or the output index of the stage
+    };
+
+    std::vector<std::shared_ptr<ov::Model>> models;
+    // the source of every input of every stage
+    std::vector<std::vector<Port>> inputs;
+    // the stage output of every output of the original model
+    std::vector<Port> outputs;
+};
+
+/**
+ * @brief Checks whether the model can be cut into the pipeline stages:
+ * the shapes must be static and the model must not keep states between the inferences
+ */
+bool canBePipelined(const ov::Model& model);
+
+/**
+ * @brief Cuts the model into up to \p numStages stages with roughly equal size of the weights.
+ * The weights shared by the stages are duplicated, so each stage keeps its own copy on its NUMA node.
+ * The empty stages are dropped, so less stages may be returned.
+ */
+PipelineStages splitIntoPipelineStages(const std::shared_ptr<const ov::Model>& model, size_t numStages);
+
+}  // namespace ov::intel_cpu
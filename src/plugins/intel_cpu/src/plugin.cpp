@@ -11,6 +11,7 @@
 #include <set>
 #include <string>
 #include <tuple>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -43,6 +44,7 @@
 #include "openvino/runtime/threading/cpu_message.hpp"
 #include "openvino/runtime/threading/executor_manager.hpp"
 #include "openvino/runtime/threading/istreams_executor.hpp"
+#include "pipeline_stages.hpp"
 #include "sigstack_manager.h"
 #include "transformations/transformation_pipeline.h"
 #include "transformations/utils/utils.hpp"
@@ -150,6 +152,11 @@ void Plugin::calculate_streams(Config& conf, const std::shared_ptr<ov::Model>& m
             conf.modelPreferThreads = cache_model_prefer;
         }
     }
+    // the pipeline stages are cut from the static models without states only
+    if (conf.modelDistributionPolicy.count(ov::hint::ModelDistributionPolicy::PIPELINE_PARALLEL) != 0 &&
+        !canBePipelined(*model)) {
+        conf.modelDistributionPolicy.erase(ov::hint::ModelDistributionPolicy::PIPELINE_PARALLEL);
+    }
     get_performance_streams(conf, model);
     // save model_prefer_threads to model rt_info when loading network
     if (!imported) {
@@ -209,6 +216,19 @@ std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<
     conf.applyRtInfo(cloned_model);
     conf.readProperties(config, modelType);
 
+    // the quick tier skips the most expensive transformations, the model distributed between the sub-streams is not
+    // tiered as its sub compiled models are created from the same model
+    const bool tiered = conf.tieredCompilation && conf.modelDistributionPolicy.empty();
+    const auto lpTransformsMode = conf.lpTransformsMode;
+    const auto snippetsMode = conf.snippetsMode;
+    // both tiers are compiled from the same model, the optimized one gets the streams calculated for the quick one
+    const auto optimized_model = tiered ? cloned_model->clone() : nullptr;
+    if (tiered) {
+        conf.lpTransformsMode = Config::LPTransformsMode::Off;
+        conf.snippetsMode = Config::SnippetsMode::Disable;
+        conf.quickTier = true;
+    }
+
     Transformations transformations(cloned_model, conf);
 
     transformations.UpToLpt();
@@ -256,7 +276,36 @@ std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<
             denormals_as_zero(false);
         }
     }
-    return std::make_shared<CompiledModel>(cloned_model, shared_from_this(), conf, false);
+    auto compiled_model = std::make_shared<CompiledModel>(cloned_model, shared_from_this(), conf, false);
+    if (tiered) {
+        auto optimized_conf = conf;
+        optimized_conf.lpTransformsMode = lpTransformsMode;
+        optimized_conf.snippetsMode = snippetsMode;
+        optimized_conf.quickTier = false;
+        // the exported optimized tier restores the same streams on import
+        optimized_model->set_rt_info(cloned_model->get_rt_info<ov::AnyMap>("intel_cpu_hints_config"),
+                                     "intel_cpu_hints_config");
+        std::vector<std::unordered_set<std::string>> output_names;
+        for (const auto& output : cloned_model->outputs()) {
+            output_names.push_back(output.get_tensor().get_names());
+        }
+        compiled_model->compile_optimized_tier(
+            [optimized_model, optimized_conf, output_names] {
+                Transformations transformations(optimized_model, optimized_conf);
+                transformations.UpToLpt();
+                transformations.PostLpt();
+                transformations.Snippets();
+                transformations.CpuSpecificOpSet();
+                OPENVINO_ASSERT(optimized_model->outputs().size() == output_names.size(),
+                                "Output ports count mismatch between the quick and the optimized tiers");
+                for (size_t idx = 0; idx < optimized_model->outputs().size(); idx++) {
+                    optimized_model->output(idx).get_tensor().set_names(output_names[idx]);
+                }
+                return optimized_model;
+            },
+            optimized_conf);
+    }
+    return compiled_model;
 }
 
 void Plugin::set_property(const ov::AnyMap& config) {
@@ -622,6 +671,7 @@ std::shared_ptr<ov::ICompiledModel> Plugin::deserialize_model(ModelDeserializer&
         _config.erase(it);
     }
     conf.readProperties(_config, modelType);
+    conf.packedWeights = deserializer.get_packed_weights();
 
     // import config props from caching model
     calculate_streams(conf, model, true);
@@ -0,0 +1,95 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fused_preprocess.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+#include "openvino/core/attribute_visitor.hpp"
+#include "openvino/core/dimension.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/node_vector.hpp"
+#include "openvino/core/partial_shape.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/op/op.hpp"
+#include "transformations/itt.hpp"
+
+ov::intel_cpu::FusedPreprocessNode::FusedPreprocessNode(const OutputVector& args, Config cfg)
+    : Op(args),
+      m_config(std::move(cfg)) {
+    constructor_validate_and_infer_types();
+}
+
+std::shared_ptr<ov::Node> ov::intel_cpu::FusedPreprocessNode::clone_with_new_inputs(
+    const ov::OutputVector& new_args) const {
+    INTERNAL_OP_SCOPE(FusedPreprocessNode_clone_with_new_inputs);
+    check_new_args_count(this, new_args);
+    return std::make_shared<ov::intel_cpu::FusedPreprocessNode>(new_args, m_config);
+}
+
+bool ov::intel_cpu::FusedPreprocessNode::visit_attributes(ov::AttributeVisitor& visitor) {
+    INTERNAL_OP_SCOPE(FusedPreprocessNode_visit_attributes);
+    visitor.start_structure("config");
+    visitor.on_attribute("bgr", m_config.bgr);
+    visitor.on_attribute("resize_mode", m_config.resize_mode);
+    visitor.on_attribute("out_h", m_config.out_h);
+    visitor.on_attribute("out_w", m_config.out_w);
+    visitor.on_attribute("scale", m_config.scale);
+    visitor.on_attribute("shift", m_config.shift);
+    visitor.on_attribute("planar", m_config.planar);
+    visitor.finish_structure();
+    return true;
+}
+
+void ov::intel_cpu::FusedPreprocessNode::validate_and_infer_types() {
+    INTERNAL_OP_SCOPE(FusedPreprocessNode_validate_and_infer_types);
+    const auto inputs_count = get_input_size();
+    NODE_VALIDATION_CHECK(this, inputs_count == 1 || inputs_count == 2, "Expected 1 or 2 inputs, got ", inputs_count);
+    NODE_VALIDATION_CHECK(this,
+                          m_config.resize_mode == "none" || m_config.resize_mode == "linear" ||
+                              m_config.resize_mode == "nearest",
+                          "Unsupported resize mode: ",
+                          m_config.resize_mode);
+    NODE_VALIDATION_CHECK(this,
+                          m_config.scale.size() == 3 && m_config.shift.size() == 3,
+                          "Scale and shift must contain a value per channel");
+    for (size_t i = 0; i < inputs_count; i++) {
+        NODE_VALIDATION_CHECK(this,
+                              get_input_element_type(i) == ov::element::u8,
+                              "Input ",
+                              i,
+                              " must be u8 whereas current element type is ",
+                              get_input_element_type(i));
+        NODE_VALIDATION_CHECK(this,
+                              get_input_partial_shape(i).rank().compatible(4),
+                              "Input ",
+                              i,
+                              " must have 4D shape whereas current shape is ",
+                              get_input_partial_shape(i));
+    }
+
+    const auto& y_shape = get_input_partial_shape(0);
+    auto batch = Dimension::dynamic();
+    auto height = Dimension::dynamic();
+    auto width = Dimension::dynamic();
+    if (y_shape.rank().is_static()) {
+        batch = y_shape[0];
+        width = y_shape[2];
+        height = y_shape[1];
+        if (inputs_count == 1 && height.is_static()) {
+            height = height.get_length() * 2 / 3;
+        }
+    }
+    if (m_config.resize_mode != "none") {
+        NODE_VALIDATION_CHECK(this, m_config.out_h > 0 && m_config.out_w > 0, "Output size must be set for resize");
+        height = static_cast<int64_t>(m_config.out_h);
+        width = static_cast<int64_t>(m_config.out_w);
+    }
+
+    const auto out_shape = m_config.planar ? ov::PartialShape{batch, 3, height, width}
+                                           : ov::PartialShape{batch, height, width, 3};
+    set_output_type(0, ov::element::f32, out_shape);
+}
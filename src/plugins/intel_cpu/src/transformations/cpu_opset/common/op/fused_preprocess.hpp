@@ -0,0 +1,63 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "openvino/core/attribute_visitor.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/node_vector.hpp"
+#include "openvino/op/op.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * The operation performs the whole image preprocessing chain produced by PrePostProcessor in a single pass:
+ * NV12 -> RGB/BGR color conversion, optional spatial resize, per-channel affine normalization and optional
+ * NHWC -> NCHW layout conversion. Inputs:
+ *     1. Y plane of type u8 and shape [N, H, W, 1] or the whole NV12 image of shape [N, H * 3 / 2, W, 1]. Required
+ *     2. UV plane of type u8 and shape [N, H / 2, W / 2, 2]. Optional
+ * Outputs:
+ *     1. Image of type f32 and shape [N, 3, out_h, out_w] (planar) or [N, out_h, out_w, 3]. The channel c of the
+ * output is computed as x * scale[c] + shift[c], where x is the (resized) color converted value.
+ */
+class FusedPreprocessNode : public ov::op::Op {
+public:
+    OPENVINO_OP("FusedPreprocess", "cpu_plugin_opset");
+
+    FusedPreprocessNode() = default;
+
+    struct Config {
+        bool bgr = false;
+        // "none", "linear" (half_pixel) or "nearest" (half_pixel, round_prefer_floor)
+        std::string resize_mode = "none";
+        // the output spatial size, used only if resize_mode is not "none"
+        size_t out_h = 0;
+        size_t out_w = 0;
+        std::vector<float> scale = {1.F, 1.F, 1.F};
+        std::vector<float> shift = {0.F, 0.F, 0.F};
+        bool planar = false;
+    };
+
+    FusedPreprocessNode(const OutputVector& args, Config cfg);
+
+    bool visit_attributes(ov::AttributeVisitor& visitor) override;
+
+    void validate_and_infer_types() override;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override;
+
+    const Config& get_config() const {
+        return m_config;
+    }
+
+private:
+    Config m_config;
+};
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,216 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "preprocess_fusion.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "openvino/cc/pass/itt.hpp"
+#include "openvino/core/graph_util.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/node_output.hpp"
+#include "openvino/core/node_vector.hpp"
+#include "openvino/core/rt_info.hpp"
+#include "openvino/core/type.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/divide.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/nv12_to_bgr.hpp"
+#include "openvino/op/nv12_to_rgb.hpp"
+#include "openvino/op/subtract.hpp"
+#include "openvino/op/transpose.hpp"
+#include "openvino/op/util/attr_types.hpp"
+#include "openvino/op/util/interpolate_base.hpp"
+#include "openvino/pass/matcher_pass.hpp"
+#include "openvino/pass/pattern/matcher.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+#include "transformations/cpu_opset/common/op/fused_preprocess.hpp"
+
+namespace {
+
+using Config = ov::intel_cpu::FusedPreprocessNode::Config;
+
+std::shared_ptr<ov::Node> get_single_consumer(const ov::Output<ov::Node>& output) {
+    const auto target_inputs = output.get_target_inputs();
+    if (target_inputs.size() != 1) {
+        return nullptr;
+    }
+    return target_inputs.begin()->get_node()->shared_from_this();
+}
+
+// Reads the values of a constant broadcasted along the channel axis of a 4D tensor only
+bool get_per_channel_values(const ov::Output<ov::Node>& input, size_t channel_axis, std::vector<float>& values) {
+    const auto constant = ov::as_type_ptr<ov::op::v0::Constant>(input.get_node_shared_ptr());
+    if (!constant) {
+        return false;
+    }
+    const auto& shape = constant->get_shape();
+    if (shape.size() > 4) {
+        return false;
+    }
+    for (size_t i = 0; i < shape.size(); i++) {
+        const auto axis = 4 - shape.size() + i;
+        if (shape[i] != 1 && (axis != channel_axis || shape[i] != 3)) {
+            return false;
+        }
+    }
+    values = constant->cast_vector<float>();
+    if (values.size() == 1) {
+        values.resize(3, values[0]);
+    }
+    return true;
+}
+
+bool fuse_arithmetic(const std::shared_ptr<ov::Node>& node, const std::shared_ptr<ov::Node>& prev, Config& cfg) {
+    const bool is_add = ov::is_type<ov::op::v1::Add>(node);
+    const bool is_multiply = ov::is_type<ov::op::v1::Multiply>(node);
+    const bool is_subtract = ov::is_type<ov::op::v1::Subtract>(node);
+    const bool is_divide = ov::is_type<ov::op::v1::Divide>(node);
+    if (!is_add && !is_multiply && !is_subtract && !is_divide) {
+        return false;
+    }
+    if (node->get_autob() != ov::op::AutoBroadcastType::NUMPY ||
+        node->get_output_element_type(0) != ov::element::f32) {
+        return false;
+    }
+
+    // Subtract and Divide are not commutative, the constant must be the second input for them
+    size_t data_port = 0;
+    if (node->get_input_node_ptr(0) != prev.get()) {
+        if (!is_add && !is_multiply) {
+            return false;
+        }
+        data_port = 1;
+    }
+    std::vector<float> values;
+    const size_t channel_axis = cfg.planar ? 1 : 3;
+    if (!get_per_channel_values(node->input_value(1 - data_port), channel_axis, values) ||
+        (is_divide && std::find(values.begin(), values.end(), 0.F) != values.end())) {
+        return false;
+    }
+
+    for (size_t c = 0; c < 3; c++) {
+        if (is_add) {
+            cfg.shift[c] += values[c];
+        } else if (is_subtract) {
+            cfg.shift[c] -= values[c];
+        } else if (is_multiply) {
+            cfg.scale[c] *= values[c];
+            cfg.shift[c] *= values[c];
+        } else {
+            cfg.scale[c] /= values[c];
+            cfg.shift[c] /= values[c];
+        }
+    }
+    return true;
+}
+
+// Linear and nearest interpolation commute with the per-channel affine transformation, so the resize
+// can be fused regardless of its position in the chain
+bool fuse_interpolate(const std::shared_ptr<ov::Node>& node, const std::shared_ptr<ov::Node>& prev, Config& cfg) {
+    using InterpolateBase = ov::op::util::InterpolateBase;
+    const auto interpolate = ov::as_type_ptr<InterpolateBase>(node);
+    if (!interpolate || node->get_input_node_ptr(0) != prev.get() || cfg.resize_mode != "none") {
+        return false;
+    }
+    const auto& attrs = interpolate->get_attrs();
+    const bool is_linear = attrs.mode == InterpolateBase::InterpolateMode::LINEAR;
+    const bool is_nearest = attrs.mode == InterpolateBase::InterpolateMode::NEAREST;
+    if ((!is_linear && !is_nearest) || attrs.shape_calculation_mode != InterpolateBase::ShapeCalcMode::SIZES ||
+        attrs.coordinate_transformation_mode != InterpolateBase::CoordinateTransformMode::HALF_PIXEL ||
+        (is_nearest && attrs.nearest_mode != InterpolateBase::NearestMode::ROUND_PREFER_FLOOR) || attrs.antialias) {
+        return false;
+    }
+    auto is_zero = [](size_t pad) {
+        return pad == 0;
+    };
+    if (!std::all_of(attrs.pads_begin.begin(), attrs.pads_begin.end(), is_zero) ||
+        !std::all_of(attrs.pads_end.begin(), attrs.pads_end.end(), is_zero)) {
+        return false;
+    }
+
+    const auto& in_shape = node->get_input_partial_shape(0);
+    const auto& out_shape = node->get_output_partial_shape(0);
+    if (in_shape.rank() != 4 || out_shape.rank() != 4) {
+        return false;
+    }
+    const size_t h_axis = cfg.planar ? 2 : 1;
+    const size_t w_axis = h_axis + 1;
+    for (size_t i = 0; i < 4; i++) {
+        if (i != h_axis && i != w_axis && in_shape[i] != out_shape[i]) {
+            return false;
+        }
+    }
+    if (out_shape[h_axis].is_dynamic() || out_shape[w_axis].is_dynamic()) {
+        return false;
+    }
+
+    cfg.resize_mode = is_linear ? "linear" : "nearest";
+    cfg.out_h = out_shape[h_axis].get_length();
+    cfg.out_w = out_shape[w_axis].get_length();
+    return true;
+}
+
+bool fuse_transpose(const std::shared_ptr<ov::Node>& node, const std::shared_ptr<ov::Node>& prev, Config& cfg) {
+    const auto transpose = ov::as_type_ptr<ov::op::v1::Transpose>(node);
+    if (!transpose || node->get_input_node_ptr(0) != prev.get() || cfg.planar) {
+        return false;
+    }
+    const auto order = ov::as_type_ptr<ov::op::v0::Constant>(transpose->get_input_node_shared_ptr(1));
+    if (!order || order->cast_vector<int64_t>() != std::vector<int64_t>{0, 3, 1, 2}) {
+        return false;
+    }
+    cfg.planar = true;
+    return true;
+}
+
+}  // namespace
+
+ov::intel_cpu::PreprocessFusion::PreprocessFusion() {
+    MATCHER_SCOPE(PreprocessFusion);
+    auto nv12_m = ov::pass::pattern::wrap_type<ov::op::v8::NV12toRGB, ov::op::v8::NV12toBGR>();
+
+    ov::matcher_pass_callback callback = [=](ov::pass::pattern::Matcher& m) {
+        const auto nv12 = m.get_match_root();
+        if (nv12->get_input_element_type(0) != ov::element::u8 || transformation_callback(nv12)) {
+            return false;
+        }
+        // the color conversion results are rounded to u8 before the conversion to f32, the kernel does the same,
+        // but the rest of the chain must be computed in f32
+        const auto convert = ov::as_type_ptr<ov::op::v0::Convert>(get_single_consumer(nv12->output(0)));
+        if (!convert || convert->get_destination_type() != ov::element::f32) {
+            return false;
+        }
+
+        Config cfg;
+        cfg.bgr = ov::is_type<ov::op::v8::NV12toBGR>(nv12);
+        ov::NodeVector fused_nodes{nv12, convert};
+        std::shared_ptr<ov::Node> last = convert;
+        while (auto next = get_single_consumer(last->output(0))) {
+            if (next->get_output_size() != 1 ||
+                (!fuse_interpolate(next, last, cfg) && !fuse_transpose(next, last, cfg) &&
+                 !fuse_arithmetic(next, last, cfg))) {
+                break;
+            }
+            fused_nodes.push_back(next);
+            last = next;
+        }
+
+        const auto fused = std::make_shared<ov::intel_cpu::FusedPreprocessNode>(nv12->input_values(), cfg);
+        fused->set_friendly_name(last->get_friendly_name());
+        ov::copy_runtime_info(fused_nodes, fused);
+        ov::replace_node(last, fused);
+        return true;
+    };
+
+    auto m = std::make_shared<ov::pass::pattern::Matcher>(nv12_m, matcher_name);
+    this->register_matcher(m, callback);
+}
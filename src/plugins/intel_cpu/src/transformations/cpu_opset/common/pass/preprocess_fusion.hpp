@@ -0,0 +1,24 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/matcher_pass.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * Fuses the image preprocessing chain inserted by PrePostProcessor
+ *     NV12toRGB/NV12toBGR -> Convert(f32) -> [Interpolate] -> [per-channel Subtract/Add/Multiply/Divide]
+ *     -> [Transpose(0, 3, 1, 2)]
+ * into a single FusedPreprocessNode, so the image is read once and the intermediate tensors are not materialized.
+ * The optional operations may come in any order, the chain ends at the first operation that cannot be fused.
+ */
+class PreprocessFusion : public ov::pass::MatcherPass {
+public:
+    OPENVINO_MATCHER_PASS_RTTI("PreprocessFusion");
+    PreprocessFusion();
+};
+
+}  // namespace ov::intel_cpu
@@ -69,11 +69,13 @@
 #include "transformations/common_optimizations/mark_precision_sensitive_shapeof_subgraphs.hpp"
 #include "transformations/common_optimizations/mark_rope_input_to_keep_in_mixed_precision.hpp"
 #include "transformations/common_optimizations/matmul_const_transposes_extraction.hpp"
+#include "transformations/common_optimizations/moc_transformations.hpp"
 #include "transformations/common_optimizations/move_eltwise_up_data_movement.hpp"
 #include "transformations/common_optimizations/mul_fake_quantize_fusion.hpp"
 #include "transformations/common_optimizations/nop_elimination.hpp"
 #include "transformations/common_optimizations/reshape_prelu.hpp"
 #include "transformations/common_optimizations/sdpa_fusion.hpp"
+#include "transformations/common_optimizations/strides_optimization.hpp"
 #include "transformations/common_optimizations/transpose_sinking.hpp"
 #include "transformations/common_optimizations/weights_dequantize_to_fake_quantize.hpp"
 #include "transformations/common_optimizations/wrap_interpolate_into_transposes.hpp"
@@ -147,6 +149,7 @@
 #include "transformations/cpu_opset/common/pass/insert_convert_after_extension.hpp"
 #include "transformations/cpu_opset/common/pass/ngram_fusion.hpp"
 #include "transformations/cpu_opset/common/pass/permute_slice_n_interpolation.hpp"
+#include "transformations/cpu_opset/common/pass/preprocess_fusion.hpp"
 #include "transformations/cpu_opset/common/pass/stateful_sdpa_fusion.hpp"
 #include "transformations/cpu_opset/common/pass/swap_convert_transpose.hpp"
 #include "transformations/cpu_opset/convert_to_cpu_specific_opset.hpp"
@@ -645,6 +648,7 @@ void Transformations::PreLpt(const std::vector<ov::element::Type>& defaultPrecis
                              convert_input_output_precision);
 
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::EliminateConvert);
+    CPU_REGISTER_PASS_COMMON(manager, PreprocessFusion);
     CPU_REGISTER_PASS_COMMON(manager, SwapConvertTranspose);
     CPU_REGISTER_PASS_X64(manager, ConvertToInteraction);
     CPU_REGISTER_PASS_X64(manager, ConvertInteractionInt8);
@@ -852,6 +856,12 @@ void Transformations::PreLpt(const std::vector<ov::element::Type>& defaultPrecis
     CPU_DISABLE_PASS_X64(manager, ov::pass::ReduceL1Decomposition);
     CPU_DISABLE_PASS_X64(manager, ov::pass::ReduceL2Decomposition);
 
+    // The quick tier of the tiered compilation skips the model wide fusions, the nodes execute the unfused ops as well
+    if (config.quickTier) {
+        CPU_DISABLE_PASS_COMMON(manager, ov::pass::MOCTransformations);
+        CPU_DISABLE_PASS_COMMON(manager, ov::pass::StridesOptimization);
+    }
+
     CPU_ENABLE_PASS_COMMON(manager, ov::pass::NormalizeL2Decomposition);
     CPU_ENABLE_PASS_COMMON(manager, ov::pass::ConvertInterpolate1ToInterpolate4);
     CPU_ENABLE_PASS_COMMON(manager, ov::pass::ConvertGather1ToGather7);
@@ -886,7 +896,9 @@ void Transformations::PreLpt(const std::vector<ov::element::Type>& defaultPrecis
        and finally do CF for those constant paths that are not inputs to MatMul node */
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::EnableDecompressionConvertConstantFolding);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::KeepConstAndDecompression);
-    CPU_REGISTER_PASS_COMMON(manager, ov::pass::ConstantFolding);
+    // the decompression chains are folded by tiles, so the intermediate f32 copies of the weights are not allocated
+    constexpr size_t decompressionFoldingTileSize = 1 << 20;
+    CPU_REGISTER_PASS_COMMON(manager, ov::pass::TiledConstantFolding, decompressionFoldingTileSize);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::LoraSubgraphFusion);
 
     manager.run_passes(model);
@@ -1141,6 +1153,9 @@ void Transformations::PostLpt() {
     // Snippets.
     auto symbolic_pipeline = CPU_REGISTER_PASS_COMMON(postLPTPassManager, ov::pass::SymbolicOptimizations, false);
     symbolic_pipeline->get_manager()->register_pass<NgramFusion>();
+    if (config.quickTier) {
+        CPU_DISABLE_PASS_COMMON(postLPTPassManager, ov::pass::SymbolicOptimizations);
+    }
 
     postLPTPassManager.run_passes(model);
 }
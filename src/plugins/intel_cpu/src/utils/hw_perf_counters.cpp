@@ -0,0 +1,377 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "utils/hw_perf_counters.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "openvino/core/any.hpp"
+#include "openvino/core/except.hpp"
+
+#if defined(__linux__)
+#    include <linux/perf_event.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+
+#    include <cerrno>
+#    include <cstring>
+#endif
+
+#if defined(OPENVINO_ARCH_X86) || defined(OPENVINO_ARCH_X86_64)
+#    include <xbyak/xbyak_util.h>
+
+#    include <cpu/x64/cpu_isa_traits.hpp>
+#endif
+
+namespace ov::intel_cpu {
+
+namespace {
+constexpr size_t eventsCount = static_cast<size_t>(HwEvent::COUNT);
+constexpr size_t cacheLineSize = 64;
+
+constexpr std::array<const char*, eventsCount> eventNames = {"cycles",
+                                                              "instructions",
+                                                              "llc_load_misses",
+                                                              "llc_store_misses",
+                                                              "license1_cycles",
+                                                              "license2_cycles",
+                                                              "license3_cycles"};
+
+// the events of a group are scheduled on the core together, so a group must fit into the 4 general purpose counters
+// of a hyper-thread (the cycles and the instructions take the fixed counters). The groups are multiplexed if there
+// are not enough counters for all of them
+constexpr std::array<size_t, eventsCount> eventGroups = {0, 0, 0, 0, 1, 1, 1};
+
+#if defined(__linux__)
+constexpr size_t groupsCount = 2;
+
+int openEvent(uint32_t type, uint64_t config, int tid, int groupFd) {
+    perf_event_attr attr{};
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    // the user space only, which is allowed by the default perf_event_paranoid level
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    return static_cast<int>(syscall(SYS_perf_event_open, &attr, tid, -1, groupFd, PERF_FLAG_FD_CLOEXEC));
+}
+
+constexpr uint64_t llcEvent(uint64_t op) {
+    return PERF_COUNT_HW_CACHE_LL | (op << 8) | (static_cast<uint64_t>(PERF_COUNT_HW_CACHE_RESULT_MISS) << 16);
+}
+
+// the raw CORE_POWER events of the Intel server cores, the encoding is (umask << 8) | event select
+void setLicenseEvents(std::array<uint64_t, eventsCount>& configs, std::array<bool, eventsCount>& supported) {
+#    if defined(OPENVINO_ARCH_X86) || defined(OPENVINO_ARCH_X86_64)
+    const auto& cpu = dnnl::impl::cpu::x64::cpu();
+    if (!cpu.has(Xbyak::util::Cpu::tINTEL) || cpu.displayFamily != 6) {
+        return;
+    }
+    const auto setEvent = [&](HwEvent event, uint64_t umask) {
+        configs[static_cast<size_t>(event)] = (umask << 8) | 0x28;
+        supported[static_cast<size_t>(event)] = true;
+    };
+    switch (cpu.displayModel) {
+    case 0x55:  // Skylake-SP, Cascade Lake, Cooper Lake
+    case 0x6A:  // Ice Lake-SP
+    case 0x6C:  // Ice Lake-D
+        // LVL1_TURBO_LICENSE and LVL2_TURBO_LICENSE
+        setEvent(HwEvent::LICENSE_1_CYCLES, 0x18);
+        setEvent(HwEvent::LICENSE_2_CYCLES, 0x20);
+        break;
+    case 0x8F:  // Sapphire Rapids
+    case 0xCF:  // Emerald Rapids
+    case 0xAD:  // Granite Rapids
+    case 0xAE:  // Granite Rapids-D
+        // LICENSE_1, LICENSE_2 and LICENSE_3
+        setEvent(HwEvent::LICENSE_1_CYCLES, 0x02);
+        setEvent(HwEvent::LICENSE_2_CYCLES, 0x04);
+        setEvent(HwEvent::LICENSE_3_CYCLES, 0x08);
+        break;
+    default:
+        break;
+    }
+#    else
+    (void)configs;
+    (void)supported;
+#    endif
+}
+#endif
+}  // namespace
+
+HwPerfCounters::Ptr HwPerfCounters::get() {
+#if defined(__linux__)
+    static std::mutex mutex;
+    static std::weak_ptr<HwPerfCounters> instance;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto counters = instance.lock();
+    if (!counters) {
+        counters = std::shared_ptr<HwPerfCounters>(new HwPerfCounters());
+        instance = counters;
+    }
+    return counters;
+#else
+    OPENVINO_THROW("The hardware performance counters are supported on Linux only");
+#endif
+}
+
+HwPerfCounters::HwPerfCounters() {
+#if defined(__linux__)
+    std::array<bool, eventsCount> supported{};
+    const auto setEvent = [&](HwEvent event, uint32_t type, uint64_t config) {
+        m_types[static_cast<size_t>(event)] = type;
+        m_configs[static_cast<size_t>(event)] = config;
+        supported[static_cast<size_t>(event)] = true;
+    };
+    setEvent(HwEvent::CYCLES, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+    setEvent(HwEvent::INSTRUCTIONS, PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+    setEvent(HwEvent::LLC_LOAD_MISSES, PERF_TYPE_HW_CACHE, llcEvent(PERF_COUNT_HW_CACHE_OP_READ));
+    setEvent(HwEvent::LLC_STORE_MISSES, PERF_TYPE_HW_CACHE, llcEvent(PERF_COUNT_HW_CACHE_OP_WRITE));
+    setLicenseEvents(m_configs, supported);
+    for (auto event : {HwEvent::LICENSE_1_CYCLES, HwEvent::LICENSE_2_CYCLES, HwEvent::LICENSE_3_CYCLES}) {
+        m_types[static_cast<size_t>(event)] = PERF_TYPE_RAW;
+    }
+
+    // probe the events on the current thread: the events the kernel or the core does not support are skipped
+    errno = 0;
+    auto fds = open(0, supported);
+    const int lastError = errno;
+    for (size_t i = 0; i < eventsCount; i++) {
+        m_available[i] = fds[i] >= 0;
+    }
+    close(fds);
+    OPENVINO_ASSERT(std::any_of(m_available.begin(),
+                                m_available.end(),
+                                [](bool available) {
+                                    return available;
+                                }),
+                    "The hardware performance counters are not available: perf_event_open failed with '",
+                    std::strerror(lastError),
+                    "'. Please check /proc/sys/kernel/perf_event_paranoid");
+
+    attachNewThreads();
+#endif
+}
+
+HwPerfCounters::~HwPerfCounters() {
+    for (auto& thread : m_threads) {
+        close(thread.fds);
+    }
+}
+
+HwPerfCounters::EventFds HwPerfCounters::open([[maybe_unused]] int tid,
+                                              [[maybe_unused]] const std::array<bool, eventsCount>& events) const {
+    EventFds fds;
+    fds.fill(-1);
+#if defined(__linux__)
+    std::array<int, groupsCount> leaders;
+    leaders.fill(-1);
+    for (size_t i = 0; i < eventsCount; i++) {
+        if (!events[i]) {
+            continue;
+        }
+        auto& leader = leaders[eventGroups[i]];
+        fds[i] = openEvent(m_types[i], m_configs[i], tid, leader);
+        if (leader < 0) {
+            leader = fds[i];
+        }
+    }
+#endif
+    return fds;
+}
+
+void HwPerfCounters::close([[maybe_unused]] EventFds& fds) {
+#if defined(__linux__)
+    // the members of the groups are closed before the leaders
+    for (auto it = fds.rbegin(); it != fds.rend(); ++it) {
+        if (*it >= 0) {
+            ::close(*it);
+            *it = -1;
+        }
+    }
+#endif
+}
+
+void HwPerfCounters::attachNewThreads() {
+#if defined(__linux__)
+    std::vector<int> tids;
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::directory_iterator("/proc/self/task", ec)) {
+        tids.push_back(std::stoi(entry.path().filename().string()));
+    }
+    if (ec) {
+        return;
+    }
+    std::sort(tids.begin(), tids.end());
+    {
+        // the inferences of the other streams keep reading the events while the thread list stays the same
+        std::shared_lock<std::shared_mutex> lock(m_mutex);
+        if (tids == m_tids) {
+            return;
+        }
+    }
+
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    // keep the events of the exited threads, so the sum never goes back
+    for (auto it = m_threads.begin(); it != m_threads.end();) {
+        if (std::binary_search(tids.begin(), tids.end(), it->tid)) {
+            ++it;
+            continue;
+        }
+        const auto values = read(*it);
+        for (size_t i = 0; i < eventsCount; i++) {
+            m_retired[i] += values[i];
+        }
+        close(it->fds);
+        it = m_threads.erase(it);
+    }
+
+    for (const auto tid : tids) {
+        if (std::any_of(m_threads.begin(), m_threads.end(), [tid](const Thread& thread) {
+                return thread.tid == tid;
+            })) {
+            continue;
+        }
+        m_threads.push_back(Thread{tid, open(tid, m_available)});
+    }
+    m_tids = std::move(tids);
+#endif
+}
+
+size_t HwPerfCounters::groupOf(HwEvent event) {
+    return eventGroups[static_cast<size_t>(event)];
+}
+
+bool HwPerfCounters::accumulateGroup(const uint64_t* data,
+                                     size_t size,
+                                     size_t group,
+                                     const std::array<bool, eventsCount>& counted,
+                                     HwEventValues& values) {
+    size_t members = 0;
+    for (size_t i = 0; i < eventsCount; i++) {
+        members += eventGroups[i] == group && counted[i] ? 1 : 0;
+    }
+    if (members == 0 || size != 3 + members || data[0] != members || data[2] == 0) {
+        return false;
+    }
+    const auto enabled = data[1];
+    const auto running = data[2];
+    size_t member = 3;
+    for (size_t i = 0; i < eventsCount; i++) {
+        if (eventGroups[i] != group || !counted[i]) {
+            continue;
+        }
+        const auto value = data[member++];
+        values[i] += running < enabled ? static_cast<uint64_t>(static_cast<double>(value) * enabled / running) : value;
+    }
+    return true;
+}
+
+HwEventValues HwPerfCounters::read([[maybe_unused]] const Thread& thread) const {
+    HwEventValues values{};
+#if defined(__linux__)
+    std::array<bool, eventsCount> counted{};
+    for (size_t i = 0; i < eventsCount; i++) {
+        counted[i] = thread.fds[i] >= 0;
+    }
+    for (size_t group = 0; group < groupsCount; group++) {
+        // the first opened event of the group is its leader
+        int leader = -1;
+        size_t members = 0;
+        for (size_t i = 0; i < eventsCount; i++) {
+            if (eventGroups[i] == group && counted[i]) {
+                leader = leader < 0 ? thread.fds[i] : leader;
+                members++;
+            }
+        }
+        if (leader < 0) {
+            continue;
+        }
+        std::array<uint64_t, 3 + eventsCount> data{};
+        const auto size = static_cast<ssize_t>((3 + members) * sizeof(uint64_t));
+        if (::read(leader, data.data(), size) == size) {
+            accumulateGroup(data.data(), 3 + members, group, counted, values);
+        }
+    }
+#endif
+    return values;
+}
+
+HwEventValues HwPerfCounters::read() const {
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    auto values = m_retired;
+    for (const auto& thread : m_threads) {
+        const auto threadValues = read(thread);
+        for (size_t i = 0; i < eventsCount; i++) {
+            values[i] += threadValues[i];
+        }
+    }
+    return values;
+}
+
+std::vector<std::pair<const char*, double>> HwPerfCounters::derivedMetrics(const HwEventValues& values,
+                                                                            double durationUs) const {
+    const auto value = [&](HwEvent event) {
+        return static_cast<double>(values[static_cast<size_t>(event)]);
+    };
+
+    std::vector<std::pair<const char*, double>> metrics;
+    if (isAvailable(HwEvent::CYCLES) && isAvailable(HwEvent::INSTRUCTIONS) && value(HwEvent::CYCLES) > 0) {
+        metrics.emplace_back("ipc", value(HwEvent::INSTRUCTIONS) / value(HwEvent::CYCLES));
+    }
+    if (isAvailable(HwEvent::LLC_LOAD_MISSES)) {
+        const double misses = value(HwEvent::LLC_LOAD_MISSES) + value(HwEvent::LLC_STORE_MISSES);
+        if (isAvailable(HwEvent::INSTRUCTIONS) && value(HwEvent::INSTRUCTIONS) > 0) {
+            metrics.emplace_back("llc_mpki", 1000.0 * misses / value(HwEvent::INSTRUCTIONS));
+        }
+        // every miss transfers a cache line from the memory: a lower bound of the traffic without the prefetches
+        if (durationUs > 0) {
+            metrics.emplace_back("llc_miss_gbps", misses * cacheLineSize / durationUs / 1000.0);
+        }
+    }
+    return metrics;
+}
+
+ov::AnyMap HwPerfCounters::toAnyMap(const HwEventValues& values, double durationUs) const {
+    ov::AnyMap result;
+    for (size_t i = 0; i < eventsCount; i++) {
+        if (m_available[i]) {
+            result[eventNames[i]] = values[i];
+        }
+    }
+    for (const auto& [name, metric] : derivedMetrics(values, durationUs)) {
+        result[name] = metric;
+    }
+    return result;
+}
+
+std::string HwPerfCounters::format(const HwEventValues& values, double durationUs) const {
+    std::stringstream ss;
+    for (size_t i = 0; i < eventsCount; i++) {
+        if (m_available[i]) {
+            ss << (ss.tellp() > 0 ? " " : "") << eventNames[i] << "=" << values[i];
+        }
+    }
+    ss << std::fixed << std::setprecision(2);
+    for (const auto& [name, metric] : derivedMetrics(values, durationUs)) {
+        ss << " " << name << "=" << metric;
+    }
+    return ss.str();
+}
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,114 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "openvino/core/any.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief The hardware events counted around the execution of every node (see cpu_hw_perf_counters)
+ */
+enum class HwEvent : uint8_t {
+    CYCLES,
+    INSTRUCTIONS,
+    LLC_LOAD_MISSES,
+    LLC_STORE_MISSES,
+    // the cycles spent at the reduced frequency licenses: AVX2 heavy / AVX-512 light, AVX-512 heavy and AMX
+    LICENSE_1_CYCLES,
+    LICENSE_2_CYCLES,
+    LICENSE_3_CYCLES,
+    COUNT
+};
+
+using HwEventValues = std::array<uint64_t, static_cast<size_t>(HwEvent::COUNT)>;
+
+/**
+ * @brief The Linux perf events of all the threads of the process, counted in the user space only.
+ * The events of the worker threads are summed up, so the values read around a node execution include the work of the
+ * concurrently executed nodes (the other streams, the parallel branches) and of the spinning idle workers if any.
+ * The events of a thread are opened as groups, so a group is read by a single syscall.
+ */
+class HwPerfCounters {
+public:
+    using Ptr = std::shared_ptr<HwPerfCounters>;
+
+    // the counters are shared by all the compiled models of the process, throws if no event can be counted
+    static Ptr get();
+
+    HwPerfCounters(const HwPerfCounters&) = delete;
+    HwPerfCounters& operator=(const HwPerfCounters&) = delete;
+    ~HwPerfCounters();
+
+    // starts counting the events of the threads created since the previous call. The thread list of the process is
+    // scanned on every call, the exclusive lock is taken only if the list has changed
+    void attachNewThreads();
+
+    // the events are multiplexed if there are not enough hardware counters, so the values are extrapolated
+    [[nodiscard]] HwEventValues read() const;
+
+    [[nodiscard]] bool isAvailable(HwEvent event) const {
+        return m_available[static_cast<size_t>(event)];
+    }
+
+    // the available events and the derived metrics (IPC, LLC misses per 1000 instructions and the memory bandwidth
+    // estimated by the LLC misses) by name
+    [[nodiscard]] ov::AnyMap toAnyMap(const HwEventValues& values, double durationUs) const;
+
+    // the same as toAnyMap() as "name=value" pairs
+    [[nodiscard]] std::string format(const HwEventValues& values, double durationUs) const;
+
+    // the events counted by the same group are scheduled together (see HwEvent for the order)
+    [[nodiscard]] static size_t groupOf(HwEvent event);
+
+    // Adds the values of the group read from its leader to the counted events of the group, extrapolated if the group
+    // was multiplexed. The data is in the PERF_FORMAT_GROUP layout: the number of the events, the time enabled, the
+    // time running and the values of the counted events of the group in the HwEvent order. Returns false and adds
+    // nothing if the data does not match the counted events or the group has not run yet.
+    static bool accumulateGroup(const uint64_t* data,
+                                size_t size,
+                                size_t group,
+                                const std::array<bool, static_cast<size_t>(HwEvent::COUNT)>& counted,
+                                HwEventValues& values);
+
+private:
+    HwPerfCounters();
+
+    using EventFds = std::array<int, static_cast<size_t>(HwEvent::COUNT)>;
+
+    struct Thread {
+        int tid;
+        // per event, -1 if the event is not available. The first opened event of a group is its leader
+        EventFds fds;
+    };
+
+    [[nodiscard]] EventFds open(int tid, const std::array<bool, static_cast<size_t>(HwEvent::COUNT)>& events) const;
+    static void close(EventFds& fds);
+    [[nodiscard]] HwEventValues read(const Thread& thread) const;
+    [[nodiscard]] std::vector<std::pair<const char*, double>> derivedMetrics(const HwEventValues& values,
+                                                                             double durationUs) const;
+
+    // the threads are attached at the start of the inference, while the nodes of the other streams read the events
+    mutable std::shared_mutex m_mutex;
+    std::vector<Thread> m_threads;
+    // the sorted thread ids of the last attachNewThreads()
+    std::vector<int> m_tids;
+    // the events of the exited threads
+    HwEventValues m_retired{};
+    std::array<uint64_t, static_cast<size_t>(HwEvent::COUNT)> m_configs{};
+    std::array<uint32_t, static_cast<size_t>(HwEvent::COUNT)> m_types{};
+    std::array<bool, static_cast<size_t>(HwEvent::COUNT)> m_available{};
+};
+
+}  // namespace ov::intel_cpu
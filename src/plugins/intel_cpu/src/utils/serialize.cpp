@@ -5,6 +5,7 @@
 #include "serialize.hpp"
 
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
 #include <functional>
 #include <istream>
@@ -13,7 +14,9 @@
 #include <string>
 #include <utility>
 #include <variant>
+#include <vector>
 
+#include "cpu_memory.h"
 #include "openvino/core/except.hpp"
 #include "openvino/core/model.hpp"
 #include "openvino/core/shape.hpp"
@@ -22,20 +25,64 @@
 #include "openvino/runtime/aligned_buffer.hpp"
 #include "openvino/runtime/shared_buffer.hpp"
 #include "openvino/runtime/tensor.hpp"
+#include "packed_weights.hpp"
 #include "utils/codec_xor.hpp"
+#include "utils/general_utils.h"
 
 namespace ov::intel_cpu {
 
 ////////// ModelSerializer //////////
 
-ModelSerializer::ModelSerializer(std::ostream& ostream, const CacheEncrypt& encrypt_fn)
+ModelSerializer::ModelSerializer(std::ostream& ostream,
+                                 const CacheEncrypt& encrypt_fn,
+                                 PackedWeightsList packed_weights)
     : ov::pass::StreamSerialize(
           ostream,
-          [](std::ostream& stream) {
+          [packed_weights = std::move(packed_weights)](std::ostream& stream) {
               pugi::xml_document xml_doc;
               pugi::xml_node root = xml_doc.append_child("cnndata");
               root.append_child("outputs");
+              // The packed weights area ends the custom data section, so its size is enough to locate it.
+              // The area and every tensor inside it are aligned to the page boundary of the output stream.
+              std::vector<size_t> offsets;
+              size_t area_size = 0;
+              for (const auto& [key, memory] : packed_weights) {
+                  const auto offset = rnd_up(area_size, PackedWeightsBlob::alignment);
+                  offsets.push_back(offset);
+                  area_size = offset + memory->getSize();
+              }
+              if (!packed_weights.empty()) {
+                  auto packed_node = root.append_child("packed_weights");
+                  packed_node.append_attribute("size").set_value(static_cast<unsigned long long>(area_size));
+                  for (size_t i = 0; i < packed_weights.size(); i++) {
+                      auto entry = packed_node.append_child("entry");
+                      entry.append_attribute("key").set_value(static_cast<unsigned long long>(packed_weights[i].first));
+                      entry.append_attribute("offset").set_value(static_cast<unsigned long long>(offsets[i]));
+                      entry.append_attribute("size").set_value(
+                          static_cast<unsigned long long>(packed_weights[i].second->getSize()));
+                  }
+              }
               xml_doc.save(stream);
+              if (packed_weights.empty()) {
+                  return;
+              }
+
+              // the terminating zero separates the xml from the binary data
+              stream.put('\0');
+              auto pad = [&stream](size_t alignment) {
+                  const auto pos = static_cast<size_t>(stream.tellp());
+                  const std::vector<char> zeros(rnd_up(pos, alignment) - pos, 0);
+                  stream.write(zeros.data(), zeros.size());
+              };
+              pad(PackedWeightsBlob::alignment);
+              const auto area_begin = static_cast<size_t>(stream.tellp());
+              for (size_t i = 0; i < packed_weights.size(); i++) {
+                  pad(PackedWeightsBlob::alignment);
+                  OPENVINO_ASSERT(static_cast<size_t>(stream.tellp()) - area_begin == offsets[i],
+                                  "[CPU] Unexpected packed weights offset");
+                  const auto& memory = packed_weights[i].second;
+                  stream.write(memory->getDataAs<const char>(), memory->getSize());
+              }
           },
           encrypt_fn) {};
 
@@ -79,6 +126,30 @@ ModelDeserializer::ModelDeserializer(std::istream& model_stream,
 
 void ModelDeserializer::set_info(pugi::xml_node& root, std::shared_ptr<ov::Model>& model) {}
 
+void ModelDeserializer::set_packed_weights(pugi::xml_node& root, const std::shared_ptr<ov::AlignedBuffer>& custom_data) {
+    m_packed_weights = nullptr;
+
+    auto packed_node = root.child("packed_weights");
+    if (!packed_node || !custom_data) {
+        return;
+    }
+
+    const auto area_size = static_cast<size_t>(packed_node.attribute("size").as_ullong());
+    OPENVINO_ASSERT(area_size <= custom_data->size(), "[CPU] Could not deserialize packed weights.");
+    const auto* area = static_cast<const uint8_t*>(custom_data->get_ptr()) + custom_data->size() - area_size;
+
+    auto packed_weights = std::make_shared<PackedWeightsBlob>();
+    packed_weights->buffer = custom_data;
+    for (const auto& entry : packed_node.children("entry")) {
+        const auto offset = static_cast<size_t>(entry.attribute("offset").as_ullong());
+        const auto size = static_cast<size_t>(entry.attribute("size").as_ullong());
+        OPENVINO_ASSERT(offset <= area_size && size <= area_size - offset,
+                        "[CPU] Could not deserialize packed weights.");
+        packed_weights->entries[static_cast<size_t>(entry.attribute("key").as_ullong())] = {area + offset, size};
+    }
+    m_packed_weights = std::move(packed_weights);
+}
+
 void ModelDeserializer::operator>>(std::shared_ptr<ov::Model>& model) {
     std::visit(
         [&](auto&& arg) {
@@ -107,9 +178,15 @@ void ModelDeserializer::process_model(std::shared_ptr<ov::Model>& model,
 
     // Read model input/output precisions.
     pugi::xml_document xml_in_out_doc;
+    std::shared_ptr<ov::AlignedBuffer> custom_data;
     if (hdr.custom_data_size > 0LU) {
+        custom_data =
+            std::make_shared<ov::SharedBuffer<std::shared_ptr<ov::AlignedBuffer>>>(buffer_base + hdr.custom_data_offset,
+                                                                                   hdr.custom_data_size,
+                                                                                   model_buffer);
+        // the xml may be followed by the zero terminated binary data (packed weights)
         auto res = xml_in_out_doc.load_buffer(buffer_base + hdr.custom_data_offset,
-                                              hdr.custom_data_size,
+                                              strnlen(buffer_base + hdr.custom_data_offset, hdr.custom_data_size),
                                               pugi::parse_default,
                                               pugi::encoding_utf8);
         OPENVINO_ASSERT(res.status == pugi::status_ok, "[CPU] Could to deserialize custom data.");
@@ -145,6 +222,7 @@ void ModelDeserializer::process_model(std::shared_ptr<ov::Model>& model,
     // Set Info
     pugi::xml_node root = xml_in_out_doc.child("cnndata");
     set_info(root, model);
+    set_packed_weights(root, custom_data);
 }
 
 void ModelDeserializer::process_model(std::shared_ptr<ov::Model>& model,
@@ -170,11 +248,16 @@ void ModelDeserializer::process_model(std::shared_ptr<ov::Model>& model,
     model_stream.seekg(hdr.custom_data_offset);
 
     pugi::xml_document xmlInOutDoc;
+    std::shared_ptr<ov::AlignedBuffer> custom_data;
     if (hdr.custom_data_size > 0) {
-        std::string xmlInOutString;
-        xmlInOutString.resize(hdr.custom_data_size);
-        model_stream.read(const_cast<char*>(xmlInOutString.c_str()), hdr.custom_data_size);
-        auto res = xmlInOutDoc.load_string(xmlInOutString.c_str());
+        custom_data = std::make_shared<ov::AlignedBuffer>(hdr.custom_data_size, PackedWeightsBlob::alignment);
+        auto* custom_data_ptr = static_cast<char*>(custom_data->get_ptr());
+        model_stream.read(custom_data_ptr, hdr.custom_data_size);
+        // the xml may be followed by the zero terminated binary data (packed weights)
+        auto res = xmlInOutDoc.load_buffer(custom_data_ptr,
+                                           strnlen(custom_data_ptr, hdr.custom_data_size),
+                                           pugi::parse_default,
+                                           pugi::encoding_utf8);
         OPENVINO_ASSERT(res.status == pugi::status_ok,
                         "NetworkNotRead: The inputs and outputs information is invalid.");
     }
@@ -215,5 +298,6 @@ void ModelDeserializer::process_model(std::shared_ptr<ov::Model>& model,
     // Set Info
     pugi::xml_node root = xmlInOutDoc.child("cnndata");
     set_info(root, model);
+    set_packed_weights(root, custom_data);
 };
 }  // namespace ov::intel_cpu
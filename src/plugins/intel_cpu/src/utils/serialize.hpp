@@ -3,17 +3,22 @@
 //
 #pragma once
 
+#include <cstddef>
 #include <functional>
 #include <istream>
 #include <memory>
 #include <ostream>
 #include <pugixml.hpp>
 #include <string>
+#include <utility>
 #include <variant>
+#include <vector>
 
+#include "cpu_memory.h"
 #include "openvino/core/model.hpp"
 #include "openvino/pass/serialize.hpp"
 #include "openvino/runtime/aligned_buffer.hpp"
+#include "packed_weights.hpp"
 #include "utils/codec_xor.hpp"
 
 namespace ov::intel_cpu {
@@ -22,7 +27,11 @@ class ModelSerializer : private ov::pass::StreamSerialize {
 public:
     using CacheEncrypt = std::function<std::string(const std::string&)>;
 
-    explicit ModelSerializer(std::ostream& ostream, const CacheEncrypt& encrypt_fn = {});
+    using PackedWeightsList = std::vector<std::pair<size_t, MemoryCPtr>>;
+
+    explicit ModelSerializer(std::ostream& ostream,
+                             const CacheEncrypt& encrypt_fn = {},
+                             PackedWeightsList packed_weights = {});
 
     void operator<<(const std::shared_ptr<ov::Model>& model);
 
@@ -49,8 +58,16 @@ public:
 
     void operator>>(std::shared_ptr<ov::Model>& model);
 
+    /**
+     * @brief Returns the packed weights stored in the blob, nullptr if the blob has none
+     */
+    const PackedWeightsBlob::CPtr& get_packed_weights() const {
+        return m_packed_weights;
+    }
+
 protected:
     static void set_info(pugi::xml_node& root, std::shared_ptr<ov::Model>& model);
+    void set_packed_weights(pugi::xml_node& root, const std::shared_ptr<ov::AlignedBuffer>& custom_data);
 
     void process_model(std::shared_ptr<ov::Model>& model, const std::shared_ptr<ov::AlignedBuffer>& model_buffer);
     void process_model(std::shared_ptr<ov::Model>& model, std::reference_wrapper<std::istream> model_stream);
@@ -59,6 +76,7 @@ protected:
     ModelBuilder m_model_builder;
     CacheDecrypt m_cache_decrypt;
     bool m_decript_from_string;
+    PackedWeightsBlob::CPtr m_packed_weights;
 };
 
 }  // namespace ov::intel_cpu
@@ -190,6 +190,9 @@ void Verbose::printInfo() {
 void Verbose::printDuration() {
     const auto& duration = node->PerfCounter().duration().count();
     stream << duration << "ms";
+    if (const auto* hw = node->PerfCounter().hw()) {
+        stream << ',' << hw->format(node->PerfCounter().hw_last_itr(), duration * 1000.0);
+    }
 }
 
 void Verbose::flush() const {
@@ -2,11 +2,16 @@
 // SPDX-License-corer: Apache-2.0
 //
 
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+
 #include "openvino/runtime/core.hpp"
 #include "openvino/runtime/compiled_model.hpp"
 #include "common_test_utils/test_common.hpp"
 #include "common_test_utils/node_builders/eltwise.hpp"
 #include "common_test_utils/node_builders/constant.hpp"
+#include "common_test_utils/ov_tensor_utils.hpp"
 #include "functional_test_utils/skip_tests_config.hpp"
 #include "openvino/opsets/opset9_decl.hpp"
 #include "openvino/op/matmul.hpp"
@@ -94,6 +99,57 @@ TEST_P(ExportOptimalNumStreams, OptimalNumStreams) {
     }
 }
 
+TEST(ExportImportTest, ImportedModelWithPackedWeights) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    ov::Core core;
+    auto model = MakeMatMulModel();
+    auto compiled_model = core.compile_model(model, "CPU");
+    auto packed_compiled_model = core.compile_model(model, "CPU", {{"CPU_CACHE_PACKED_WEIGHTS", true}});
+
+    std::stringstream exported_model;
+    compiled_model.export_model(exported_model);
+    std::stringstream packed_exported_model;
+    packed_compiled_model.export_model(packed_exported_model);
+    const auto packed_blob = packed_exported_model.str();
+    EXPECT_GT(packed_blob.size(), exported_model.str().size());
+
+    auto input = ov::test::utils::create_and_fill_tensor(model->input().get_element_type(), model->input().get_shape());
+    auto infer = [&input](ov::CompiledModel& model) {
+        auto request = model.create_infer_request();
+        request.set_input_tensor(input);
+        request.infer();
+        return request.get_output_tensor();
+    };
+    const auto reference = infer(compiled_model);
+
+    auto check = [&](ov::CompiledModel imported_model) {
+        const auto output = infer(imported_model);
+        EXPECT_EQ(output.get_byte_size(), reference.get_byte_size());
+        EXPECT_EQ(0, std::memcmp(output.data(), reference.data(), reference.get_byte_size()));
+        return imported_model.get_property("CPU_PACKED_WEIGHTS_STATISTICS").as<ov::AnyMap>();
+    };
+    // the blob read from the stream: the packed weights are used, copied if the stream offset breaks the alignment
+    {
+        const auto stats = check(core.import_model(packed_exported_model, "CPU"));
+        EXPECT_GT(stats.at("IN_PLACE").as<uint64_t>() + stats.at("COPIED").as<uint64_t>(), 0U);
+        EXPECT_EQ(stats.at("REPACKED").as<uint64_t>(), 0U);
+    }
+    // the page aligned blob referenced in place (as an mmapped cache file): the packed weights are never copied
+    {
+        constexpr size_t page_size = 4096;
+        std::unique_ptr<void, decltype(&std::free)> aligned_data(
+            std::aligned_alloc(page_size, (packed_blob.size() + page_size - 1) / page_size * page_size),
+            &std::free);
+        ASSERT_NE(aligned_data, nullptr);
+        std::memcpy(aligned_data.get(), packed_blob.data(), packed_blob.size());
+        ov::Tensor blob(ov::element::u8, ov::Shape{packed_blob.size()}, aligned_data.get());
+        const auto stats = check(core.import_model(blob, "CPU"));
+        EXPECT_GT(stats.at("IN_PLACE").as<uint64_t>(), 0U);
+        EXPECT_EQ(stats.at("COPIED").as<uint64_t>(), 0U);
+        EXPECT_EQ(stats.at("REPACKED").as<uint64_t>(), 0U);
+    }
+}
+
 const std::vector<ov::AnyMap> testing_property_for_streams = {{ov::num_streams(1)}, {ov::num_streams(2)}};
 
 const std::vector<ov::AnyMap> testing_property_for_threads = {{ov::inference_num_threads(1)},
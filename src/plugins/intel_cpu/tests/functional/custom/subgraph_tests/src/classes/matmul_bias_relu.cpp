@@ -0,0 +1,27 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "matmul_bias_relu.hpp"
+
+#include "common_test_utils/node_builders/constant.hpp"
+#include "common_test_utils/node_builders/eltwise.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/relu.hpp"
+
+namespace ov {
+namespace test {
+
+std::shared_ptr<ov::Node> makeMatMulBiasRelu(const ov::Output<ov::Node>& input,
+                                             size_t outputSize,
+                                             ov::element::Type precision) {
+    const auto inputSize = static_cast<size_t>(input.get_partial_shape().rbegin()->get_length());
+    auto weights = ov::test::utils::make_constant(precision, ov::Shape{inputSize, outputSize});
+    auto matmul = std::make_shared<ov::op::v0::MatMul>(input, weights);
+    auto bias = ov::test::utils::make_constant(precision, ov::Shape{1, outputSize});
+    auto add = utils::make_eltwise(matmul, bias, utils::EltwiseTypes::ADD);
+    return std::make_shared<ov::op::v0::Relu>(add);
+}
+
+}  // namespace test
+}  // namespace ov
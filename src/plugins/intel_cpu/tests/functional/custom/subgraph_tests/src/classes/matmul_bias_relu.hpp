@@ -0,0 +1,31 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+
+#include "openvino/core/node.hpp"
+#include "openvino/core/node_output.hpp"
+#include "openvino/core/type/element_type.hpp"
+
+namespace ov {
+namespace test {
+
+/* Builds the fully connected layer used by the tests of the runtime features:
+
+                 input
+                   |
+        MatMul (random weights)
+                   |
+          Add (random bias)
+                   |
+                  Relu
+*/
+std::shared_ptr<ov::Node> makeMatMulBiasRelu(const ov::Output<ov::Node>& input,
+                                             size_t outputSize,
+                                             ov::element::Type precision = ov::element::f32);
+
+}  // namespace test
+}  // namespace ov
@@ -519,6 +519,67 @@ INSTANTIATE_TEST_SUITE_P(smoke_ConcatSDPTransposeTestSetState,
                                             ::testing::Values(0)),
                          ConcatSDPTransposeTest::getTestCaseName);
 
+class ConcatSDPTransposeTestSharedPrefix : public ConcatSDPTransposeTestBase {
+public:
+    std::vector<ov::Tensor> run_steps(ov::InferRequest& request, size_t begin, size_t end) {
+        std::vector<ov::Tensor> outputs;
+        for (size_t idx = begin; idx < end; idx++) {
+            generate(static_cast<int>(idx), targetStaticShapes[idx]);
+            for (const auto& input : inputs) {
+                request.set_tensor(input.first, input.second);
+            }
+            request.infer();
+            auto outputTensor = request.get_output_tensor(0);
+            ov::Tensor copy{outputTensor.get_element_type(), outputTensor.get_shape()};
+            outputTensor.copy_to(copy);
+            outputs.push_back(copy);
+        }
+        return outputs;
+    }
+};
+
+TEST_P(ConcatSDPTransposeTestSharedPrefix, CompareWithOrigin) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    configuration[ov::hint::kv_cache_precision.name()] = "f32";
+    prepare();
+    // the prompt is computed once, its cache is shared with the second request without copies
+    run_steps(inferRequest, 0, 1);
+    auto sharedRequest = compiledModel.create_infer_request();
+    std::vector<ov::Tensor> prefix;
+    std::vector<ov::Tensor> prefixCopy;
+    for (auto&& state : inferRequest.query_state()) {
+        for (auto&& sharedState : sharedRequest.query_state()) {
+            if (sharedState.get_name() == state.get_name()) {
+                sharedState.set_state(state.get_state());
+            }
+        }
+        prefix.push_back(state.get_state());
+        auto snapshot = state.get_state();
+        prefixCopy.emplace_back(snapshot.get_element_type(), snapshot.get_shape());
+        snapshot.copy_to(prefixCopy.back());
+    }
+
+    // both requests continue the same prompt, neither of them may change the shared cache
+    auto expectedOutputs = run_steps(inferRequest, 1, targetStaticShapes.size());
+    auto actualOutputs = run_steps(sharedRequest, 1, targetStaticShapes.size());
+    ASSERT_EQ(expectedOutputs.size(), actualOutputs.size());
+    for (size_t i = 0; i < actualOutputs.size(); i++) {
+        ov::test::utils::compare(expectedOutputs[i], actualOutputs[i], abs_threshold, rel_threshold);
+    }
+    for (size_t i = 0; i < prefix.size(); i++) {
+        ov::test::utils::compare(prefixCopy[i], prefix[i], 0.0f, 0.0f);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_ConcatSDPTransposeTestSharedPrefix,
+                         ConcatSDPTransposeTestSharedPrefix,
+                         ::testing::Combine(::testing::Values(ElementType::f32),
+                                            ::testing::ValuesIn(inputShapeAndReorders),
+                                            ::testing::Values(false),
+                                            ::testing::Values(false),
+                                            ::testing::Values(0)),
+                         ConcatSDPTransposeTest::getTestCaseName);
+
 class ConcatSDPTransposeTestWrongBeamIdx : public ConcatSDPTransposeTest {
 public:
     void generate(int idx, const std::vector<ov::Shape>& targetInputStaticShapes) override {
@@ -0,0 +1,101 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+
+#include "custom/subgraph_tests/src/classes/matmul_bias_relu.hpp"
+#include "internal_properties.hpp"
+#include "openvino/op/concat.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/op/reshape.hpp"
+#include "openvino/runtime/core.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+
+/*This test runs the following subgraph:
+
+                 param0     param1
+                   |          |
+                 MatMul      Relu
+                   |          |
+                  Add         |
+                   |          |
+                  Relu        |
+                     \       /
+                       Concat
+                         |
+                       Result
+
+The input shapes alternate between two signatures, so the output shapes of the nodes are resolved once per signature
+and replayed by the following inferences with the same signature.
+*/
+
+namespace ov {
+namespace test {
+
+class DynamicShapePlansCPUTest : virtual public ov::test::SubgraphBaseTest {
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        configuration.insert(ov::num_streams(1));
+        configuration.insert({ov::intel_cpu::cpu_dynamic_shape_plans_capacity.name(), 4});
+
+        const auto precision = ov::element::f32;
+        const std::vector<InputShape> input_shapes = {
+            {{-1, 64}, {{4, 64}, {8, 64}, {4, 64}, {8, 64}, {4, 64}}},
+            {{-1, 16}, {{2, 16}, {8, 16}, {2, 16}, {8, 16}, {2, 16}}},
+        };
+        init_input_shapes(input_shapes);
+
+        ov::ParameterVector params;
+        for (const auto& shape : inputDynamicShapes) {
+            params.push_back(std::make_shared<ov::op::v0::Parameter>(precision, shape));
+        }
+        auto relu0 = makeMatMulBiasRelu(params[0], 16);
+        auto relu1 = std::make_shared<ov::op::v0::Relu>(params[1]);
+        auto concat = std::make_shared<ov::op::v0::Concat>(ov::OutputVector{relu0, relu1}, 0);
+
+        function = std::make_shared<ov::Model>(ov::OutputVector{concat}, params, "DynamicShapePlans");
+    }
+};
+
+TEST_F(DynamicShapePlansCPUTest, smoke_CompareWithRefs) {
+    run();
+
+    const auto stats = compiledModel.get_property(ov::intel_cpu::cpu_dynamic_shape_plans_statistics);
+    EXPECT_EQ(stats.at("MISSES").as<uint64_t>(), 2);
+    EXPECT_EQ(stats.at("HITS").as<uint64_t>(), 3);
+    EXPECT_EQ(stats.at("RECORDS").as<uint64_t>(), 2);
+    EXPECT_EQ(stats.at("EVICTIONS").as<uint64_t>(), 0);
+}
+
+// The target shape of Reshape is not a part of the input shapes signature, so the same input shapes with another
+// target shape must not replay the shapes recorded for the previous one
+TEST(DynamicShapePlansValuesCPUTest, smoke_ShapeInputValues) {
+    auto data = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{-1, 8});
+    auto target = std::make_shared<ov::op::v0::Parameter>(ov::element::i64, ov::Shape{2});
+    auto reshape = std::make_shared<ov::op::v1::Reshape>(data, target, false);
+    auto relu = std::make_shared<ov::op::v0::Relu>(reshape);
+    auto model = std::make_shared<ov::Model>(ov::OutputVector{relu}, ov::ParameterVector{data, target});
+
+    ov::Core core;
+    auto compiledModel = core.compile_model(model,
+                                            ov::test::utils::DEVICE_CPU,
+                                            {ov::num_streams(1),
+                                             {ov::intel_cpu::cpu_dynamic_shape_plans_capacity.name(), 4}});
+    auto inferRequest = compiledModel.create_infer_request();
+    ov::Tensor dataTensor(ov::element::f32, ov::Shape{2, 8});
+    std::fill_n(dataTensor.data<float>(), dataTensor.get_size(), 1.F);
+    inferRequest.set_input_tensor(0, dataTensor);
+
+    for (const auto& targetShape : {ov::Shape{4, 4}, ov::Shape{16, 1}, ov::Shape{4, 4}, ov::Shape{2, 8}}) {
+        ov::Tensor targetTensor(ov::element::i64, ov::Shape{2});
+        std::copy(targetShape.begin(), targetShape.end(), targetTensor.data<int64_t>());
+        inferRequest.set_input_tensor(1, targetTensor);
+        inferRequest.infer();
+        EXPECT_EQ(inferRequest.get_output_tensor().get_shape(), targetShape);
+    }
+}
+
+}  // namespace test
+}  // namespace ov
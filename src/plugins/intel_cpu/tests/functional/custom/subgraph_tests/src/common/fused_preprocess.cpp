@@ -0,0 +1,158 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/divide.hpp"
+#include "openvino/op/interpolate.hpp"
+#include "openvino/op/nv12_to_bgr.hpp"
+#include "openvino/op/nv12_to_rgb.hpp"
+#include "openvino/op/subtract.hpp"
+#include "openvino/op/transpose.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "utils/cpu_test_utils.hpp"
+
+/*This test runs the preprocessing chain produced by PrePostProcessor for the NV12 images:
+
+        Y,UV or Y/UV (u8)
+               |
+         NV12toRGB/BGR
+               |
+         Convert (f32)
+               |
+    Interpolate (nearest/linear)
+               |
+           Subtract
+               |
+            Divide
+               |
+     [Transpose NHWC->NCHW]
+               |
+             Result
+
+The chain is fused into a single FusedPreprocess node, its output is compared with the reference of the unfused
+chain.
+*/
+
+using namespace CPUTestUtils;
+
+namespace ov {
+namespace test {
+
+using FusedPreprocessParams = std::tuple<ov::op::util::InterpolateBase::InterpolateMode,  // resize mode
+                                         bool,                                            // BGR
+                                         bool,                                            // single plane
+                                         bool>;                                           // planar output
+
+class FusedPreprocessCPUTest : public testing::WithParamInterface<FusedPreprocessParams>,
+                               virtual public SubgraphBaseTest,
+                               public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<FusedPreprocessParams>& obj) {
+        const auto& [mode, bgr, singlePlane, planar] = obj.param;
+        std::ostringstream result;
+        result << "Mode=" << mode << "_";
+        result << (bgr ? "BGR" : "RGB") << "_";
+        result << (singlePlane ? "SinglePlane" : "TwoPlanes") << "_";
+        result << (planar ? "Planar" : "Interleaved");
+        return result.str();
+    }
+
+    void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override {
+        inputs.clear();
+        const auto& funcInputs = function->inputs();
+        for (size_t i = 0; i < funcInputs.size(); ++i) {
+            const auto& funcInput = funcInputs[i];
+            ov::test::utils::InputGenerateData in_data;
+            in_data.start_from = 0;
+            in_data.range = 256;
+            auto tensor = ov::test::utils::create_and_fill_tensor(funcInput.get_element_type(),
+                                                                  targetInputStaticShapes[i],
+                                                                  in_data);
+            inputs.insert({funcInput.get_node_shared_ptr(), tensor});
+        }
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        const auto& [mode, bgr, singlePlane, planar] = this->GetParam();
+
+        constexpr size_t height = 16;
+        constexpr size_t width = 16;
+        const std::vector<float> mean = {123.675F, 116.28F, 103.53F};
+        const std::vector<float> scale = {58.395F, 57.12F, 57.375F};
+        // NV12 conversion can use various algorithms, so a deviation by 1 before the normalization is allowed
+        abs_threshold = 1.1F / *std::min_element(scale.begin(), scale.end());
+
+        if (singlePlane) {
+            init_input_shapes(static_shapes_to_test_representation({{1, height * 3 / 2, width, 1}}));
+        } else {
+            init_input_shapes(
+                static_shapes_to_test_representation({{1, height, width, 1}, {1, height / 2, width / 2, 2}}));
+        }
+        ov::ParameterVector params;
+        ov::OutputVector planes;
+        for (const auto& shape : inputDynamicShapes) {
+            params.push_back(std::make_shared<ov::op::v0::Parameter>(ov::element::u8, shape));
+            planes.push_back(params.back());
+        }
+
+        std::shared_ptr<ov::Node> color;
+        if (bgr) {
+            color = singlePlane ? std::make_shared<ov::op::v8::NV12toBGR>(planes[0])
+                                : std::make_shared<ov::op::v8::NV12toBGR>(planes[0], planes[1]);
+        } else {
+            color = singlePlane ? std::make_shared<ov::op::v8::NV12toRGB>(planes[0])
+                                : std::make_shared<ov::op::v8::NV12toRGB>(planes[0], planes[1]);
+        }
+        auto convert = std::make_shared<ov::op::v0::Convert>(color, ov::element::f32);
+
+        // downscale the height and upscale the width
+        ov::op::util::InterpolateBase::InterpolateAttrs attrs;
+        attrs.mode = mode;
+        attrs.shape_calculation_mode = ov::op::util::InterpolateBase::ShapeCalcMode::SIZES;
+        attrs.coordinate_transformation_mode = ov::op::util::InterpolateBase::CoordinateTransformMode::HALF_PIXEL;
+        attrs.nearest_mode = ov::op::util::InterpolateBase::NearestMode::ROUND_PREFER_FLOOR;
+        auto sizes = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{2}, {12, 20});
+        auto axes = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{2}, {1, 2});
+        auto interpolate = std::make_shared<ov::op::v11::Interpolate>(convert, sizes, axes, attrs);
+
+        auto meanConst = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{1, 1, 1, 3}, mean);
+        auto subtract = std::make_shared<ov::op::v1::Subtract>(interpolate, meanConst);
+        auto scaleConst = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{1, 1, 1, 3}, scale);
+        std::shared_ptr<ov::Node> last = std::make_shared<ov::op::v1::Divide>(subtract, scaleConst);
+        if (planar) {
+            auto order = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{4}, {0, 3, 1, 2});
+            last = std::make_shared<ov::op::v1::Transpose>(last, order);
+        }
+
+        function = std::make_shared<ov::Model>(ov::OutputVector{last}, params, "FusedPreprocess");
+    }
+};
+
+TEST_P(FusedPreprocessCPUTest, CompareWithRefs) {
+    run();
+    CheckNumberOfNodesWithType(compiledModel, "FusedPreprocess", 1);
+    CheckNumberOfNodesWithType(compiledModel, "Interpolate", 0);
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_FusedPreprocess,
+                         FusedPreprocessCPUTest,
+                         ::testing::Combine(::testing::Values(ov::op::util::InterpolateBase::InterpolateMode::NEAREST,
+                                                              ov::op::util::InterpolateBase::InterpolateMode::LINEAR),
+                                            ::testing::Bool(),
+                                            ::testing::Bool(),
+                                            ::testing::Bool()),
+                         FusedPreprocessCPUTest::getTestCaseName);
+
+}  // namespace
+
+}  // namespace test
+}  // namespace ov
@@ -0,0 +1,80 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "custom/subgraph_tests/src/classes/matmul_bias_relu.hpp"
+#include "internal_properties.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+
+/*This test runs the following subgraph:
+
+                 param
+                   |
+                 MatMul
+                   |
+                  Add
+                   |
+                  Relu
+                   |
+                 Result
+
+The model is profiled with the hardware events counted, so every executed node has the values of the events in the
+statistics of the compiled model, while the profiling info is kept as is. The test is skipped if the host does not
+allow to count the events.
+*/
+
+namespace ov {
+namespace test {
+
+class HwPerfCountersCPUTest : virtual public ov::test::SubgraphBaseTest {
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        configuration.insert(ov::enable_profiling(true));
+        configuration.insert({ov::intel_cpu::cpu_hw_perf_counters.name(), true});
+
+        const auto precision = ov::element::f32;
+        init_input_shapes(static_shapes_to_test_representation({{4, 64}}));
+
+        auto param = std::make_shared<ov::op::v0::Parameter>(precision, inputDynamicShapes.front());
+        auto relu = makeMatMulBiasRelu(param, 16, precision);
+
+        function = std::make_shared<ov::Model>(ov::OutputVector{relu}, ov::ParameterVector{param}, "HwPerfCounters");
+    }
+};
+
+TEST_F(HwPerfCountersCPUTest, smoke_CompareWithRefs) {
+    try {
+        core->compile_model(function, targetDevice, configuration);
+    } catch (const ov::Exception& ex) {
+        GTEST_SKIP() << ex.what();
+    }
+
+    run();
+
+    const auto statistics = compiledModel.get_property(ov::intel_cpu::cpu_hw_perf_counters_statistics);
+    size_t executed = 0;
+    for (const auto& info : inferRequest.get_profiling_info()) {
+        if (info.status != ov::ProfilingInfo::Status::EXECUTED) {
+            continue;
+        }
+        executed++;
+        // the tools parse the execution type, so the events are reported apart from it
+        EXPECT_EQ(info.exec_type.find('='), std::string::npos) << info.node_name << ": " << info.exec_type;
+        const auto node = statistics.find(info.node_name);
+        ASSERT_NE(node, statistics.end()) << info.node_name;
+        const auto events = node->second.as<ov::AnyMap>();
+        EXPECT_FALSE(events.empty()) << info.node_name;
+    }
+    EXPECT_GT(executed, 0U);
+}
+
+TEST_F(HwPerfCountersCPUTest, smoke_NoStatisticsWithoutEvents) {
+    configuration.erase(ov::intel_cpu::cpu_hw_perf_counters.name());
+    run();
+
+    EXPECT_TRUE(compiledModel.get_property(ov::intel_cpu::cpu_hw_perf_counters_statistics).empty());
+}
+
+}  // namespace test
+}  // namespace ov
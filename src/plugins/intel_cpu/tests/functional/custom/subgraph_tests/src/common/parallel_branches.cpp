@@ -0,0 +1,85 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/node_builders/constant.hpp"
+#include "common_test_utils/node_builders/eltwise.hpp"
+#include "internal_properties.hpp"
+#include "openvino/core/parallel.hpp"
+#include "openvino/op/concat.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/relu.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+
+/*This test runs the following subgraph:
+
+                          param
+                        /   |   \
+                  MatMul  MatMul  MatMul
+                    |       |       |
+                   Add     Add     Add
+                    |       |       |
+                   Relu    Relu     |
+                     \      |      /  \
+                         Concat     Result
+                           |
+                         MatMul
+                           |
+                         Result
+
+The branches are independent, so they are executed concurrently when CPU_PARALLEL_BRANCHES is set.
+The memory of the intermediate edges is reused across the branches in the sequential order,
+so the test checks the dependencies the memory reuse adds to the data ones. The branches have equal shapes, so their
+nodes would share the cached executors and the scratchpads if they were not private in this mode.
+*/
+
+namespace ov {
+namespace test {
+
+class ParallelBranchesCPUTest : virtual public ov::test::SubgraphBaseStaticTest {
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        configuration.insert({ov::intel_cpu::cpu_parallel_branches.name(), true});
+        configuration.insert(ov::hint::performance_mode(ov::hint::PerformanceMode::LATENCY));
+
+        const auto precision = ov::element::f32;
+        init_input_shapes(static_shapes_to_test_representation({{8, 64}}));
+
+        auto param = std::make_shared<ov::op::v0::Parameter>(precision, inputDynamicShapes.front());
+        ov::OutputVector branches;
+        ov::ResultVector results;
+        for (size_t i = 0; i < 3; i++) {
+            auto weights = ov::test::utils::make_constant(precision, ov::Shape{64, 64});
+            auto matmul = std::make_shared<ov::op::v0::MatMul>(param, weights);
+            auto bias = ov::test::utils::make_constant(precision, ov::Shape{1, 64});
+            std::shared_ptr<ov::Node> branch = utils::make_eltwise(matmul, bias, utils::EltwiseTypes::ADD);
+            if (i < 2) {
+                branch = std::make_shared<ov::op::v0::Relu>(branch);
+            } else {
+                results.push_back(std::make_shared<ov::op::v0::Result>(branch));
+            }
+            branches.push_back(branch);
+        }
+        auto concat = std::make_shared<ov::op::v0::Concat>(branches, 1);
+        auto weights = ov::test::utils::make_constant(precision, ov::Shape{192, 16});
+        auto matmul = std::make_shared<ov::op::v0::MatMul>(concat, weights);
+        results.push_back(std::make_shared<ov::op::v0::Result>(matmul));
+
+        function = std::make_shared<ov::Model>(results, ov::ParameterVector{param}, "ParallelBranches");
+    }
+};
+
+TEST_F(ParallelBranchesCPUTest, smoke_CompareWithRefs) {
+    run();
+
+    const auto inferences = compiledModel.get_property(ov::intel_cpu::cpu_parallel_branches_inferences);
+#if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
+    EXPECT_GT(inferences, 0U);
+#else
+    EXPECT_EQ(inferences, 0U);
+#endif
+}
+
+}  // namespace test
+}  // namespace ov
@@ -0,0 +1,87 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/node_builders/constant.hpp"
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "custom/subgraph_tests/src/classes/matmul_bias_relu.hpp"
+#include "internal_properties.hpp"
+#include "openvino/op/matmul.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+
+/*This test runs the following subgraph:
+
+                 param
+                   |
+                 MatMul
+                   |
+                  Add
+                   |
+                  Relu
+                   |
+                 MatMul
+                   |
+                 Result
+
+The model is compiled in the same shared activations group as another bigger model, so the intermediate tensors of
+both models are located in one workspace. Both models must produce the same results as if they had their own
+workspaces, and both must report the same workspace sized for the bigger model.
+*/
+
+namespace ov {
+namespace test {
+
+namespace {
+std::shared_ptr<ov::Model> makeMatMulChain(const ov::Shape& shape, size_t hidden, const std::string& name) {
+    const auto precision = ov::element::f32;
+    auto param = std::make_shared<ov::op::v0::Parameter>(precision, shape);
+    auto relu = makeMatMulBiasRelu(param, hidden, precision);
+    auto weights1 = ov::test::utils::make_constant(precision, ov::Shape{hidden, 16});
+    auto matmul1 = std::make_shared<ov::op::v0::MatMul>(relu, weights1);
+
+    return std::make_shared<ov::Model>(ov::OutputVector{matmul1}, ov::ParameterVector{param}, name);
+}
+}  // namespace
+
+class SharedActivationsCPUTest : virtual public ov::test::SubgraphBaseTest {
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        configuration.insert(ov::num_streams(1));
+        configuration.insert({ov::intel_cpu::cpu_shared_activations_group.name(), "SharedActivationsCPUTest"});
+
+        init_input_shapes(static_shapes_to_test_representation({{4, 64}}));
+        function = makeMatMulChain({4, 64}, 32, "SharedActivations");
+    }
+};
+
+TEST_F(SharedActivationsCPUTest, smoke_CompareWithRefs) {
+    auto otherModel = makeMatMulChain({32, 64}, 256, "SharedActivationsOther");
+    auto other = core->compile_model(otherModel, targetDevice, configuration);
+    auto otherRequest = other.create_infer_request();
+    otherRequest.set_input_tensor(ov::test::utils::create_and_fill_tensor(ov::element::f32, ov::Shape{32, 64}));
+    otherRequest.infer();
+    const auto expected = otherRequest.get_output_tensor();
+    const auto expectedCopy = ov::Tensor(expected.get_element_type(), expected.get_shape());
+    expected.copy_to(expectedCopy);
+
+    run();
+
+    // the workspace was overwritten by the model under test in between
+    otherRequest.infer();
+    ov::test::utils::compare(expectedCopy, otherRequest.get_output_tensor());
+
+    // both models report the one workspace, which is sized for the bigger model
+    const auto workspaceSize = compiledModel.get_property(ov::intel_cpu::cpu_shared_activations_workspace_size);
+    EXPECT_GT(workspaceSize, 0U);
+    EXPECT_EQ(workspaceSize, other.get_property(ov::intel_cpu::cpu_shared_activations_workspace_size));
+
+    auto alone = core->compile_model(makeMatMulChain({4, 64}, 32, "SharedActivationsAlone"),
+                                     targetDevice,
+                                     {ov::num_streams(1)});
+    alone.create_infer_request().infer();
+    EXPECT_EQ(alone.get_property(ov::intel_cpu::cpu_shared_activations_workspace_size), 0U);
+}
+
+}  // namespace test
+}  // namespace ov
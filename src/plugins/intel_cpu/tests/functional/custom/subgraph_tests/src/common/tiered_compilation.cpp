@@ -0,0 +1,94 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <chrono>
+#include <thread>
+
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "custom/subgraph_tests/src/classes/matmul_bias_relu.hpp"
+#include "internal_properties.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+
+/*This test runs the following subgraph:
+
+                 param
+                   |
+                 MatMul
+                   |
+                  Add
+                   |
+                  Relu
+                   |
+                 Result
+
+The model is compiled in the tiered mode, so the first request is served by the quick tier. The request created
+after the optimized tier is ready must produce the same results, while the quick tier request keeps working. The
+quick tier is released once its last request is destroyed.
+*/
+
+namespace ov {
+namespace test {
+
+class TieredCompilationCPUTest : virtual public ov::test::SubgraphBaseTest {
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        configuration.insert({ov::intel_cpu::cpu_tiered_compilation.name(), true});
+
+        const auto precision = ov::element::f32;
+        init_input_shapes(static_shapes_to_test_representation({{4, 64}}));
+
+        auto param = std::make_shared<ov::op::v0::Parameter>(precision, inputDynamicShapes.front());
+        auto relu = makeMatMulBiasRelu(param, 16, precision);
+
+        function = std::make_shared<ov::Model>(ov::OutputVector{relu}, ov::ParameterVector{param}, "TieredCompilation");
+    }
+
+    void waitOptimizedTier() {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::minutes(1);
+        while (!compiledModel.get_property(ov::intel_cpu::cpu_optimized_tier_ready)) {
+            ASSERT_LT(std::chrono::steady_clock::now(), deadline) << "The optimized tier is not ready";
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    }
+};
+
+TEST_F(TieredCompilationCPUTest, smoke_CompareWithRefs) {
+    run();
+    waitOptimizedTier();
+
+    // the quick tier request is alive, so the quick tier is kept
+    EXPECT_FALSE(compiledModel.get_property(ov::intel_cpu::cpu_quick_tier_released));
+    auto optimizedRequest = compiledModel.create_infer_request();
+    for (const auto& input : compiledModel.inputs()) {
+        optimizedRequest.set_tensor(input, inferRequest.get_tensor(input));
+    }
+    optimizedRequest.infer();
+    ov::test::utils::compare(inferRequest.get_output_tensor(), optimizedRequest.get_output_tensor());
+
+    // the quick tier request still refers to its own graph after the swap
+    const auto quickOutput = inferRequest.get_output_tensor();
+    ov::Tensor expected(quickOutput.get_element_type(), quickOutput.get_shape());
+    quickOutput.copy_to(expected);
+    inferRequest.infer();
+    ov::test::utils::compare(expected, inferRequest.get_output_tensor());
+
+    inferRequest = {};
+    EXPECT_TRUE(compiledModel.get_property(ov::intel_cpu::cpu_quick_tier_released));
+    optimizedRequest.infer();
+    ov::test::utils::compare(expected, optimizedRequest.get_output_tensor());
+    OV_ASSERT_NO_THROW(compiledModel.get_runtime_model());
+}
+
+TEST_F(TieredCompilationCPUTest, smoke_DestroyBeforeOptimizedTier) {
+    // the compiled model waits for the background compilation or cancels it, whatever stage it is at
+    for (size_t i = 0; i < 4; i++) {
+        auto model = core->compile_model(function, targetDevice, configuration);
+        auto request = model.create_infer_request();
+        request.infer();
+    }
+}
+
+}  // namespace test
+}  // namespace ov
@@ -0,0 +1,84 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <vector>
+
+#include "utils/hw_perf_counters.h"
+
+using namespace ov::intel_cpu;
+
+namespace {
+constexpr size_t eventsCount = static_cast<size_t>(HwEvent::COUNT);
+
+uint64_t valueOf(const HwEventValues& values, HwEvent event) {
+    return values[static_cast<size_t>(event)];
+}
+
+std::array<bool, eventsCount> countedEvents(std::initializer_list<HwEvent> events) {
+    std::array<bool, eventsCount> counted{};
+    for (auto event : events) {
+        counted[static_cast<size_t>(event)] = true;
+    }
+    return counted;
+}
+}  // namespace
+
+TEST(HwPerfCountersTest, GroupValuesFollowEventsOrder) {
+    const auto group = HwPerfCounters::groupOf(HwEvent::CYCLES);
+    ASSERT_EQ(HwPerfCounters::groupOf(HwEvent::INSTRUCTIONS), group);
+    ASSERT_EQ(HwPerfCounters::groupOf(HwEvent::LLC_STORE_MISSES), group);
+    // the LLC load misses are not counted, so the store misses follow the instructions
+    const auto counted = countedEvents({HwEvent::CYCLES, HwEvent::INSTRUCTIONS, HwEvent::LLC_STORE_MISSES});
+    const std::vector<uint64_t> data = {3, 1000, 1000, 100, 200, 7};
+
+    HwEventValues values{};
+    ASSERT_TRUE(HwPerfCounters::accumulateGroup(data.data(), data.size(), group, counted, values));
+    EXPECT_EQ(valueOf(values, HwEvent::CYCLES), 100U);
+    EXPECT_EQ(valueOf(values, HwEvent::INSTRUCTIONS), 200U);
+    EXPECT_EQ(valueOf(values, HwEvent::LLC_LOAD_MISSES), 0U);
+    EXPECT_EQ(valueOf(values, HwEvent::LLC_STORE_MISSES), 7U);
+    EXPECT_EQ(valueOf(values, HwEvent::LICENSE_1_CYCLES), 0U);
+}
+
+TEST(HwPerfCountersTest, MultiplexedGroupIsExtrapolated) {
+    const auto group = HwPerfCounters::groupOf(HwEvent::LICENSE_1_CYCLES);
+    ASSERT_NE(HwPerfCounters::groupOf(HwEvent::CYCLES), group);
+    const auto counted = countedEvents({HwEvent::CYCLES, HwEvent::LICENSE_1_CYCLES, HwEvent::LICENSE_2_CYCLES});
+    // the group has run a quarter of the time it was enabled
+    const std::vector<uint64_t> data = {2, 1000, 250, 10, 30};
+
+    HwEventValues values{};
+    values[static_cast<size_t>(HwEvent::LICENSE_1_CYCLES)] = 5;
+    ASSERT_TRUE(HwPerfCounters::accumulateGroup(data.data(), data.size(), group, counted, values));
+    // the values of the other threads are kept, the events of the other groups are not touched
+    EXPECT_EQ(valueOf(values, HwEvent::LICENSE_1_CYCLES), 45U);
+    EXPECT_EQ(valueOf(values, HwEvent::LICENSE_2_CYCLES), 120U);
+    EXPECT_EQ(valueOf(values, HwEvent::CYCLES), 0U);
+}
+
+TEST(HwPerfCountersTest, MismatchedReadIsSkipped) {
+    const auto group = HwPerfCounters::groupOf(HwEvent::CYCLES);
+    const auto counted = countedEvents({HwEvent::CYCLES, HwEvent::INSTRUCTIONS});
+    HwEventValues values{};
+
+    const std::vector<uint64_t> wrongNumber = {3, 1000, 1000, 100, 200};
+    EXPECT_FALSE(HwPerfCounters::accumulateGroup(wrongNumber.data(), wrongNumber.size(), group, counted, values));
+    const std::vector<uint64_t> truncated = {2, 1000, 1000, 100};
+    EXPECT_FALSE(HwPerfCounters::accumulateGroup(truncated.data(), truncated.size(), group, counted, values));
+    const std::vector<uint64_t> notRun = {2, 1000, 0, 0, 0};
+    EXPECT_FALSE(HwPerfCounters::accumulateGroup(notRun.data(), notRun.size(), group, counted, values));
+    const std::vector<uint64_t> noMembers = {0, 1000, 1000};
+    EXPECT_FALSE(HwPerfCounters::accumulateGroup(noMembers.data(),
+                                                 noMembers.size(),
+                                                 HwPerfCounters::groupOf(HwEvent::LICENSE_1_CYCLES),
+                                                 counted,
+                                                 values));
+    EXPECT_EQ(values, HwEventValues{});
+}
@@ -0,0 +1,57 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+#include "cpu_memory.h"
+#include "kv_cache_memory.hpp"
+#include "memory_desc/cpu_blocked_memory_desc.h"
+
+using namespace ov::intel_cpu;
+
+TEST(KVCacheMemoryTest, SpillsAboveBudget) {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    // 4 KB per buffer
+    auto desc = std::make_shared<CpuBlockedMemoryDesc>(ov::element::f32, Shape{1024});
+    KVCacheMemory kvCacheMemory(6 * 1024, "");
+
+    auto resident = kvCacheMemory.allocate(desc, eng);
+    auto spilled = kvCacheMemory.allocate(desc, eng);
+    std::memset(spilled->getData(), 1, spilled->getSize());
+    kvCacheMemory.prefetch(resident);
+    kvCacheMemory.prefetch(spilled);
+
+    auto stats = kvCacheMemory.getStatistics();
+    EXPECT_EQ(stats.residentBytes, 4096);
+#if defined(__linux__)
+    EXPECT_EQ(stats.spilledBytes, 4096);
+    EXPECT_EQ(stats.spills, 1);
+    EXPECT_EQ(stats.refetches, 1);
+    EXPECT_EQ(static_cast<uint8_t*>(spilled->getData())[4095], 1);
+#endif
+
+    // the released buffers return to the budget
+    resident.reset();
+    spilled.reset();
+    stats = kvCacheMemory.getStatistics();
+    EXPECT_EQ(stats.residentBytes, 0);
+    EXPECT_EQ(stats.spilledBytes, 0);
+
+    auto next = kvCacheMemory.allocate(desc, eng);
+    EXPECT_EQ(kvCacheMemory.getStatistics().residentBytes, 4096);
+}
+
+TEST(KVCacheMemoryTest, NoBudget) {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    auto desc = std::make_shared<CpuBlockedMemoryDesc>(ov::element::f32, Shape{1024});
+    KVCacheMemory kvCacheMemory(0, "");
+
+    auto first = kvCacheMemory.allocate(desc, eng);
+    auto second = kvCacheMemory.allocate(desc, eng);
+    const auto stats = kvCacheMemory.getStatistics();
+    EXPECT_EQ(stats.residentBytes, 8192);
+    EXPECT_EQ(stats.spills, 0);
+}
@@ -0,0 +1,80 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/result.hpp"
+#include "pipeline_stages.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+// param -> MatMul -> MatMul -> MatMul -> MatMul -> Add(param) -> Result
+std::shared_ptr<ov::Model> makeMatMulChain() {
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, 16});
+    ov::Output<ov::Node> input = param;
+    for (size_t i = 0; i < 4; i++) {
+        auto weights = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{16, 16}, std::vector<float>(256, 1.0F));
+        input = std::make_shared<ov::op::v0::MatMul>(input, weights);
+    }
+    auto add = std::make_shared<ov::op::v1::Add>(input, param);
+    auto result = std::make_shared<ov::op::v0::Result>(add);
+    return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param});
+}
+
+}  // namespace
+
+TEST(PipelineStagesTest, SplitsByWeights) {
+    const auto model = makeMatMulChain();
+    const auto stages = splitIntoPipelineStages(model, 2);
+
+    ASSERT_EQ(stages.models.size(), 2);
+    // the model input is consumed by both stages
+    ASSERT_EQ(stages.inputs[0].size(), 1);
+    EXPECT_EQ(stages.inputs[0][0].stage, -1);
+    ASSERT_EQ(stages.inputs[1].size(), 2);
+    // the second stage gets the activation from the first one and the model input
+    EXPECT_EQ(stages.inputs[1][0].stage, 0);
+    EXPECT_EQ(stages.inputs[1][0].index, 0);
+    EXPECT_EQ(stages.inputs[1][1].stage, -1);
+    ASSERT_EQ(stages.outputs.size(), 1);
+    EXPECT_EQ(stages.outputs[0].stage, 1);
+
+    for (const auto& stage : stages.models) {
+        size_t matmuls = 0;
+        for (const auto& op : stage->get_ops()) {
+            matmuls += ov::is_type<ov::op::v0::MatMul>(op) ? 1 : 0;
+        }
+        EXPECT_EQ(matmuls, 2);
+    }
+    // the original model is not modified
+    EXPECT_EQ(model->get_parameters()[0]->get_output_target_inputs(0).size(), 2);
+}
+
+TEST(PipelineStagesTest, DropsEmptyStages) {
+    const auto stages = splitIntoPipelineStages(makeMatMulChain(), 16);
+
+    // one stage per MatMul and one more for the Add
+    EXPECT_EQ(stages.models.size(), 5);
+    EXPECT_EQ(stages.outputs[0].stage, static_cast<int>(stages.models.size()) - 1);
+    for (size_t i = 0; i < stages.inputs.size(); i++) {
+        for (const auto& input : stages.inputs[i]) {
+            EXPECT_LT(input.stage, static_cast<int>(i));
+        }
+    }
+}
+
+TEST(PipelineStagesTest, DynamicModelIsNotPipelined) {
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{-1, 16});
+    auto result = std::make_shared<ov::op::v0::Result>(param);
+    const auto model = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param});
+
+    EXPECT_FALSE(canBePipelined(*model));
+    EXPECT_TRUE(canBePipelined(*makeMatMulChain()));
+}
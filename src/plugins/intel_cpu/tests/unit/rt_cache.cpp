@@ -9,6 +9,7 @@
 
 #include "cache/lru_cache.h"
 #include "cache/multi_cache.h"
+#include "cache/sharded_lru_cache.h"
 #include "common_test_utils/test_assertions.hpp"
 
 using namespace ov::intel_cpu;
@@ -24,8 +25,16 @@ struct IntKey {
 
     int data;
 };
+
+// stands for a value without a state modified during the execution, e.g. a oneDNN primitive
+struct StatelessValue {
+    int data = 0;
+};
 } // namespace
 
+template <>
+struct ov::intel_cpu::IsShareableCacheValue<std::shared_ptr<StatelessValue>> : std::true_type {};
+
 TEST(LruCacheTests, Evict) {
     constexpr size_t capacity = 10;
     LruCache<IntKey, int> cache(capacity);
@@ -380,3 +389,143 @@ TEST(MultiCacheTests, SmokeTypeIdSync) {
         vecThreads.emplace_back(std::thread(testRoutine, std::ref(vecCache[i])));
     }
 }
+
+TEST(ShardedLruCacheTests, PutGet) {
+    constexpr int capacity = 64;
+    // enough room in every shard regardless of the keys distribution
+    ShardedLruCache<IntKey, int> cache(ShardedLruCache<IntKey, int>::numShards * capacity);
+    for (int i = 1; i < capacity / 2; ++i) {
+        OV_ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    for (int i = 1; i < capacity / 2; ++i) {
+        ASSERT_EQ(cache.get({i}), i);
+    }
+    ASSERT_EQ(cache.get({capacity}), int());
+}
+
+TEST(ShardedLruCacheTests, Capacity) {
+    constexpr int capacity = 32;
+    ShardedLruCache<IntKey, int> cache(capacity);
+    size_t evicted = 0;
+    for (int i = 1; i < 10 * capacity; ++i) {
+        evicted += cache.put({i}, i);
+    }
+
+    ASSERT_EQ(cache.getCapacity(), static_cast<size_t>(capacity));
+    ASSERT_LE(cache.size(), static_cast<size_t>(capacity));
+    ASSERT_EQ(cache.size() + evicted, static_cast<size_t>(10 * capacity - 1));
+}
+
+TEST(ShardedLruCacheTests, Empty) {
+    constexpr size_t capacity = 0;
+    constexpr int attempts = 10;
+    ShardedLruCache<IntKey, int> cache(capacity);
+    for (int i = 1; i < attempts; ++i) {
+        OV_ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    for (int i = 1; i < attempts; ++i) {
+        ASSERT_EQ(cache.get({i}), int());
+    }
+}
+
+TEST(MultiCacheTests, Statistics) {
+    constexpr int capacity = 10;
+    auto intBuilder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+    auto strBuilder = [&](const StringKey& key) { return std::make_shared<std::string>(key.data); };
+
+    MultiCache cache(capacity);
+    for (int i = 0; i < 2 * capacity; ++i) {
+        cache.getOrCreate(IntKey{i}, intBuilder);
+    }
+    for (int i = 0; i < capacity; ++i) {
+        cache.getOrCreate(StringKey{std::to_string(i)}, strBuilder);
+        cache.getOrCreate(StringKey{std::to_string(i)}, strBuilder);
+    }
+
+    const auto stats = cache.getStatistics();
+    ASSERT_EQ(stats.hits, static_cast<size_t>(capacity));
+    ASSERT_EQ(stats.misses, static_cast<size_t>(3 * capacity));
+    ASSERT_EQ(stats.evictions, static_cast<size_t>(capacity));
+    ASSERT_EQ(stats.records, static_cast<size_t>(2 * capacity));
+}
+
+TEST(MultiCacheTests, SmokeThreadSafeShared) {
+    using IntValueType = std::shared_ptr<int>;
+
+    constexpr int capacity = 100;
+    constexpr size_t numThreads = 16;
+    constexpr int numIterations = 1000;
+
+    auto intBuilder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+
+    MultiCache cache(capacity, true);
+    ASSERT_TRUE(cache.isThreadSafe());
+
+    auto testRoutine = [&]() {
+        for (int i = 0; i < numIterations; ++i) {
+            // the key range exceeds the capacity to exercise eviction under contention
+            const int key = i % (2 * capacity);
+            auto intResult = cache.getOrCreate(IntKey{key}, intBuilder);
+            ASSERT_NE(intResult.first, IntValueType());
+            ASSERT_EQ(*intResult.first, key);
+        }
+    };
+
+    {
+        std::vector<ScopedThread> vecThreads;
+        vecThreads.reserve(numThreads);
+        for (size_t i = 0; i < numThreads; ++i) {
+            vecThreads.emplace_back(std::thread(testRoutine));
+        }
+    }
+
+    const auto stats = cache.getStatistics();
+    ASSERT_EQ(stats.hits + stats.misses, numThreads * numIterations);
+    // the capacity of the thread safe storage is rounded up to a multiple of the shards number
+    ASSERT_LE(stats.records, (ShardedLruCache<IntKey, IntValueType>(capacity).getCapacity()));
+}
+
+TEST(MultiCacheTests, SharedBackendKeepsStatefulValuesPerCache) {
+    constexpr int capacity = 10;
+    auto statelessBuilder = [&](const IntKey& key) {
+        return std::make_shared<StatelessValue>(StatelessValue{key.data});
+    };
+    auto statefulBuilder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+
+    auto shared = std::make_shared<MultiCache>(capacity, true);
+    MultiCache streamCache0(capacity, shared);
+    MultiCache streamCache1(capacity, shared);
+
+    const auto stateless0 = streamCache0.getOrCreate(IntKey{1}, statelessBuilder);
+    const auto stateless1 = streamCache1.getOrCreate(IntKey{1}, statelessBuilder);
+    ASSERT_EQ(stateless0.second, CacheEntryBase::LookUpStatus::Miss);
+    ASSERT_EQ(stateless1.second, CacheEntryBase::LookUpStatus::Hit);
+    ASSERT_EQ(stateless0.first, stateless1.first);
+
+    const auto stateful0 = streamCache0.getOrCreate(IntKey{1}, statefulBuilder);
+    const auto stateful1 = streamCache1.getOrCreate(IntKey{1}, statefulBuilder);
+    ASSERT_EQ(stateful0.second, CacheEntryBase::LookUpStatus::Miss);
+    ASSERT_EQ(stateful1.second, CacheEntryBase::LookUpStatus::Miss);
+    ASSERT_NE(stateful0.first, stateful1.first);
+    ASSERT_EQ(streamCache0.getOrCreate(IntKey{1}, statefulBuilder).first, stateful0.first);
+
+    ASSERT_EQ(shared->getStatistics().records, 1U);
+    ASSERT_EQ(streamCache0.getStatistics().records, 1U);
+}
+
+TEST(MultiCacheTests, ProcessSharedPerCapacity) {
+    auto shared0 = MultiCache::getProcessShared(10);
+    auto shared1 = MultiCache::getProcessShared(10);
+    auto other = MultiCache::getProcessShared(20);
+    ASSERT_TRUE(shared0->isThreadSafe());
+    ASSERT_EQ(shared0, shared1);
+    ASSERT_NE(shared0, other);
+
+    // the cache is released with its last user
+    std::weak_ptr<MultiCache> released = other;
+    other.reset();
+    ASSERT_TRUE(released.expired());
+    ASSERT_EQ(MultiCache::getProcessShared(10), shared0);
+}
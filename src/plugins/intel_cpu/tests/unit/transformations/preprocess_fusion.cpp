@@ -0,0 +1,102 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "common_test_utils/ov_test_utils.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/divide.hpp"
+#include "openvino/op/interpolate.hpp"
+#include "openvino/op/nv12_to_bgr.hpp"
+#include "openvino/op/nv12_to_rgb.hpp"
+#include "openvino/op/subtract.hpp"
+#include "openvino/op/transpose.hpp"
+#include "transformations/cpu_opset/common/op/fused_preprocess.hpp"
+#include "transformations/cpu_opset/common/pass/preprocess_fusion.hpp"
+
+using namespace testing;
+using InterpolateBase = ov::op::util::InterpolateBase;
+
+class PreprocessFusionTest : public TransformationTestsF {
+public:
+    PreprocessFusionTest() : TransformationTestsF() {
+        comparator.enable(FunctionsComparator::CmpValues::ATTRIBUTES);
+    }
+};
+
+static std::shared_ptr<ov::Node> make_resize(const ov::Output<ov::Node>& input, InterpolateBase::InterpolateMode mode) {
+    auto sizes = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{2}, {224, 224});
+    auto axes = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{2}, {1, 2});
+    InterpolateBase::InterpolateAttrs attrs(mode, InterpolateBase::ShapeCalcMode::SIZES, {0, 0}, {0, 0});
+    return std::make_shared<ov::op::v11::Interpolate>(input, sizes, axes, attrs);
+}
+
+TEST_F(PreprocessFusionTest, NV12ResizeMeanScaleLayout) {
+    const std::vector<float> mean{123.675f, 116.28f, 103.53f};
+    const std::vector<float> scale{58.395f, 57.12f, 57.375f};
+    {
+        auto y = std::make_shared<ov::op::v0::Parameter>(ov::element::u8, ov::Shape{1, 480, 640, 1});
+        auto uv = std::make_shared<ov::op::v0::Parameter>(ov::element::u8, ov::Shape{1, 240, 320, 2});
+        auto nv12 = std::make_shared<ov::op::v8::NV12toBGR>(y, uv);
+        auto convert = std::make_shared<ov::op::v0::Convert>(nv12, ov::element::f32);
+        auto resize = make_resize(convert, InterpolateBase::InterpolateMode::LINEAR);
+        auto mean_const = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{1, 1, 1, 3}, mean);
+        auto subtract = std::make_shared<ov::op::v1::Subtract>(resize, mean_const);
+        auto scale_const = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{1, 1, 1, 3}, scale);
+        auto divide = std::make_shared<ov::op::v1::Divide>(subtract, scale_const);
+        auto order = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{4}, {0, 3, 1, 2});
+        auto transpose = std::make_shared<ov::op::v1::Transpose>(divide, order);
+
+        model = std::make_shared<ov::Model>(ov::OutputVector{transpose}, ov::ParameterVector{y, uv});
+        manager.register_pass<ov::intel_cpu::PreprocessFusion>();
+    }
+    {
+        auto y = std::make_shared<ov::op::v0::Parameter>(ov::element::u8, ov::Shape{1, 480, 640, 1});
+        auto uv = std::make_shared<ov::op::v0::Parameter>(ov::element::u8, ov::Shape{1, 240, 320, 2});
+        ov::intel_cpu::FusedPreprocessNode::Config cfg;
+        cfg.bgr = true;
+        cfg.resize_mode = "linear";
+        cfg.out_h = 224;
+        cfg.out_w = 224;
+        for (size_t c = 0; c < 3; c++) {
+            cfg.scale[c] = 1.f / scale[c];
+            cfg.shift[c] = -mean[c] / scale[c];
+        }
+        cfg.planar = true;
+        auto fused = std::make_shared<ov::intel_cpu::FusedPreprocessNode>(ov::OutputVector{y, uv}, cfg);
+
+        model_ref = std::make_shared<ov::Model>(ov::OutputVector{fused}, ov::ParameterVector{y, uv});
+    }
+}
+
+TEST_F(PreprocessFusionTest, NV12StopsAtUnsupportedResize) {
+    {
+        auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::u8, ov::Shape{1, 720, 640, 1});
+        auto nv12 = std::make_shared<ov::op::v8::NV12toRGB>(input);
+        auto convert = std::make_shared<ov::op::v0::Convert>(nv12, ov::element::f32);
+        auto resize = make_resize(convert, InterpolateBase::InterpolateMode::CUBIC);
+
+        model = std::make_shared<ov::Model>(ov::OutputVector{resize}, ov::ParameterVector{input});
+        manager.register_pass<ov::intel_cpu::PreprocessFusion>();
+    }
+    {
+        auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::u8, ov::Shape{1, 720, 640, 1});
+        auto fused = std::make_shared<ov::intel_cpu::FusedPreprocessNode>(ov::OutputVector{input},
+                                                                          ov::intel_cpu::FusedPreprocessNode::Config{});
+        auto resize = make_resize(fused, InterpolateBase::InterpolateMode::CUBIC);
+
+        model_ref = std::make_shared<ov::Model>(ov::OutputVector{resize}, ov::ParameterVector{input});
+    }
+}
+
+TEST_F(PreprocessFusionTest, NV12ConvertToIntegerNotFused) {
+    {
+        auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::u8, ov::Shape{1, 720, 640, 1});
+        auto nv12 = std::make_shared<ov::op::v8::NV12toRGB>(input);
+        auto convert = std::make_shared<ov::op::v0::Convert>(nv12, ov::element::i32);
+
+        model = std::make_shared<ov::Model>(ov::OutputVector{convert}, ov::ParameterVector{input});
+        manager.register_pass<ov::intel_cpu::PreprocessFusion>();
+    }
+}
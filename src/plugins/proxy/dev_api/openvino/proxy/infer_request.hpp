@@ -45,6 +45,10 @@ public:
 
     std::vector<ov::SoPtr<ov::IVariableState>> query_state() const override;
 
+    void set_property(const ov::AnyMap& properties) override;
+
+    ov::Any get_property(const std::string& name) const override;
+
     const std::shared_ptr<const ov::ICompiledModel>& get_compiled_model() const override;
 
     const std::vector<ov::Output<const ov::Node>>& get_inputs() const override;
@@ -96,6 +96,14 @@ std::vector<ov::SoPtr<ov::IVariableState>> ov::proxy::InferRequest::query_state(
     return states;
 }
 
+void ov::proxy::InferRequest::set_property(const ov::AnyMap& properties) {
+    m_infer_request->set_property(properties);
+}
+
+ov::Any ov::proxy::InferRequest::get_property(const std::string& name) const {
+    return m_infer_request->get_property(name);
+}
+
 const std::shared_ptr<const ov::ICompiledModel>& ov::proxy::InferRequest::get_compiled_model() const {
     return m_compiled_model;
 }
@@ -41,6 +41,7 @@ protected:
     size_t num_streams;
     size_t num_requests;
     size_t num_batch;
+    bool dynamic_batch = false;
     std::vector<std::shared_ptr<ov::Model>> fn_ptrs;
 
     void SetUp() override {
@@ -56,6 +57,7 @@ protected:
         std::vector<std::pair<std::shared_ptr<ov::Model>, ov::InferRequest>> irs;
         std::vector<ov::InferRequest> irs_ref;
         std::vector<size_t> outElementsCount;
+        std::vector<ov::CompiledModel> compiled_models;
 
         for (size_t i = 0; i < fn_ptrs.size(); ++i) {
             auto model = fn_ptrs[i];
@@ -76,9 +78,22 @@ protected:
             // minimize timeout to reduce test time
             config.insert(ov::auto_batch_timeout(1));
 
-            auto compiled_model = core->compile_model(model, std::string(ov::test::utils::DEVICE_BATCH) + ":" +
+            auto batched_model = model;
+            if (dynamic_batch) {
+                batched_model = model->clone();
+                std::map<ov::Output<ov::Node>, ov::PartialShape> dynamic_shapes;
+                for (auto&& input : batched_model->inputs()) {
+                    auto shape = input.get_partial_shape();
+                    shape[0] = ov::Dimension::dynamic();
+                    dynamic_shapes[input] = shape;
+                }
+                batched_model->reshape(dynamic_shapes);
+            }
+            auto compiled_model = core->compile_model(batched_model,
+                                                      std::string(ov::test::utils::DEVICE_BATCH) + ":" +
                                                       target_device + "(" + std::to_string(num_batch) + ")",
                                                       config);
+            compiled_models.push_back(compiled_model);
 
             auto network_outputs = model->outputs();
             ASSERT_EQ(network_outputs.size(), 1) << " Auto-Batching tests use networks with single output";
@@ -132,6 +147,13 @@ protected:
             auto out_ref = irs_ref[i].get_tensor(output);
             ov::test::utils::compare(out_ref, out);
         }
+
+        // the requests are stitched into the inferences of the model with the dynamic batch, not executed one by one
+        if (dynamic_batch && num_batch > 1) {
+            for (auto& compiled_model : compiled_models) {
+                EXPECT_GT(compiled_model.get_property("AUTO_BATCH_DYNAMIC_BATCH_EXECUTIONS").as<uint64_t>(), 0u);
+            }
+        }
     }
 };
 
@@ -148,6 +170,18 @@ public:
     }
 };
 
+class AutoBatching_Test_DynamicBatch : public AutoBatching_Test {
+public:
+    void SetUp() override {
+        AutoBatching_Test::SetUp();
+        dynamic_batch = true;
+    };
+
+    static std::string getTestCaseName(const testing::TestParamInfo<AutoBatchTwoNetsParams> &obj) {
+        return AutoBatching_Test::getTestCaseName(obj);
+    }
+};
+
 TEST_P(AutoBatching_Test, compareAutoBatchingToSingleBatch) {
     SKIP_IF_CURRENT_TEST_IS_DISABLED()
     TestAutoBatch();
@@ -157,6 +191,11 @@ TEST_P(AutoBatching_Test_DetectionOutput, compareAutoBatchingToSingleBatch) {
     SKIP_IF_CURRENT_TEST_IS_DISABLED()
     TestAutoBatch();
 }
+
+TEST_P(AutoBatching_Test_DynamicBatch, compareAutoBatchingToSingleBatch) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    TestAutoBatch();
+}
 }  // namespace behavior
 }  // namespace test
 }  // namespace ov
@@ -35,6 +35,8 @@ public:
     MOCK_METHOD(void, set_tensors, (const ov::Output<const ov::Node>&, const std::vector<ov::SoPtr<ov::ITensor>>&));
     MOCK_METHOD(const std::vector<ov::Output<const ov::Node>>&, get_inputs, (), (const));
     MOCK_METHOD(const std::vector<ov::Output<const ov::Node>>&, get_outputs, (), (const));
+    MOCK_METHOD(void, set_property, (const ov::AnyMap&));
+    MOCK_METHOD(ov::Any, get_property, (const std::string&), (const));
 };
 
 }  // namespace ov
@@ -284,3 +284,53 @@ def test_benchmark_app_no_warmup_with_api_modes(sample_language, device, api, ca
     assert 'FPS' in output
     assert 'Skipping warmup inference due to -no_warmup flag' in output
     assert 'First inference took' not in output
+
+
+@pytest.mark.parametrize('arrival, rates', [('constant', '20,40'), ('trace', ''), ('trace', '50')])
+@pytest.mark.parametrize('json_stats', [False, True])
+@pytest.mark.parametrize('device', get_devices())
+def test_open_loop_load(arrival, rates, json_stats, device, cache, tmp_path):
+    '''
+    Tests the load curve of the open-loop load (-arrival and -rates options of the C++ benchmark_app): a point per rate,
+    or the only point of the trace replayed as recorded, each with the -niter requests.
+    '''
+    niter = 8
+    if arrival == 'trace':
+        trace = tmp_path / 'arrivals.txt'
+        trace.write_text('\n'.join(str(timestamp) for timestamp in [0.0, 0.01, 0.02, 0.03, 0.031, 0.032, 0.033, 0.06, 0.08, 0.09]))
+        arrival = f'trace:{trace}'
+    output = get_cmd_output(
+        get_executable('C++'),
+        *prepend(cache, 'dog-224x224.bmp', 'bvlcalexnet-12.onnx', tmp_path),
+        '-d', device,
+        '-api', 'async',
+        '-niter', str(niter),
+        '-arrival', arrival,
+        *('-rates', rates) if rates else '',
+        '-report_type', 'no_counters',
+        '-report_folder', tmp_path,
+        *('-json_stats',) if json_stats else ''
+    )
+    assert 'Load curve (latencies in ms):' in output
+
+    if json_stats:
+        with (tmp_path / 'benchmark_load_curve.json').open(encoding='utf-8') as file:
+            curve = json.load(file)['load_curve']
+    else:
+        with (tmp_path / 'benchmark_load_curve.csv').open(encoding='utf-8') as file:
+            lines = [line.rstrip('\n').rstrip(';').split(';') for line in file if line.strip()]
+        keys = ['offered_rate', 'throughput', 'count', 'latency_avg', 'latency_p50', 'latency_p99', 'latency_p999', 'latency_max']
+        assert len(lines[0]) == len(keys)
+        curve = [dict(zip(keys, map(float, line))) for line in lines[1:]]
+
+    expected_rates = [float(rate) for rate in rates.split(',')] if rates else None
+    assert len(curve) == (len(expected_rates) if expected_rates else 1)
+    for i, point in enumerate(curve):
+        if expected_rates:
+            assert point['offered_rate'] == pytest.approx(expected_rates[i])
+        else:
+            assert point['offered_rate'] > 0
+        assert point['count'] == niter
+        assert point['throughput'] > 0
+        assert 0 < point['latency_p50'] <= point['latency_p99'] <= point['latency_p999'] <= point['latency_max']
+        assert point['latency_avg'] <= point['latency_max']